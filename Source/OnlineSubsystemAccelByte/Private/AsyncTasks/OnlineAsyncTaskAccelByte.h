@@ -11,10 +11,11 @@
 #include <OnlineSubsystemAccelByteTypes.h>
 #include <OnlineIdentityInterfaceAccelByte.h>
 #include <OnlineSubsystemAccelByte.h>
+#include <OnlineAsyncTaskMetricsAccelByte.h>
 
-#define AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s::%s (AsyncTask method) was called. Args: ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s::%s (AsyncTask method) was called. Args: ") Format, *GetTaskName(), ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 #define AB_OSS_ASYNC_TASK_TRACE_BEGIN(Format, ...) AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbose, Format, ##__VA_ARGS__)
-#define AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s::%s (AsyncTask method) has finished execution. ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s::%s (AsyncTask method) has finished execution. ") Format, *GetTaskName(), ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 #define AB_OSS_ASYNC_TASK_TRACE_END(Format, ...) AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbose, Format, ##__VA_ARGS__)
 
 /**
@@ -88,6 +89,25 @@ public:
 		// than the SDK HTTP timeout to give the SDK a chance to fire off its delegates for a timeout.
 		// Fix this once https://accelbyte.atlassian.net/browse/OSS-193 is implemented.
 		TaskTimeoutInSeconds = static_cast<double>(AccelByte::FHttpRetryScheduler::TotalTimeout) + 1.0;
+		CreatedTimeInSeconds = FPlatformTime::Seconds();
+	}
+
+	/**
+	 * Tasks that are cancelled or destroyed before completing never go through CompleteTask, so the in flight count is
+	 * released here rather than on completion.
+	 */
+	virtual ~FOnlineAsyncTaskAccelByte()
+	{
+		if (TaskTraceId == 0)
+		{
+			return;
+		}
+
+		const FOnlineAsyncTaskMetricsAccelBytePtr TaskMetrics = Subsystem->GetAsyncTaskMetrics();
+		if (TaskMetrics.IsValid())
+		{
+			TaskMetrics->RecordTaskReleased(TaskTraceId, bIsComplete);
+		}
 	}
 
 	/**
@@ -105,6 +125,7 @@ public:
 		if (CurrentState != EAccelByteAsyncTaskState::Working)
 		{
 			CurrentState = EAccelByteAsyncTaskState::Working;
+			StartedWorkingTimeInSeconds = FPlatformTime::Seconds();
 			OnTaskStartWorking();
 		}
 	}
@@ -116,6 +137,13 @@ public:
 	virtual void Initialize() override
 	{
 		CurrentState = EAccelByteAsyncTaskState::Initializing;
+		InitializedTimeInSeconds = FPlatformTime::Seconds();
+
+		const FOnlineAsyncTaskMetricsAccelBytePtr TaskMetrics = Subsystem->GetAsyncTaskMetrics();
+		if (TaskMetrics.IsValid())
+		{
+			TaskTraceId = TaskMetrics->RecordTaskStarted(GetTaskName());
+		}
 
 		// We only care about setting the last update time if we are using a timeout
 		if (bShouldUseTimeout)
@@ -162,6 +190,18 @@ protected:
 	/** Time in seconds that we should timeout this request, set to 30 seconds by default */
 	double TaskTimeoutInSeconds = 30.0;
 
+	/** Time in seconds that this task was created, used to report how long the task waited in the queue */
+	double CreatedTimeInSeconds = 0.0;
+
+	/** Time in seconds that the task manager initialized this task, zero if it has not been initialized yet */
+	double InitializedTimeInSeconds = 0.0;
+
+	/** Time in seconds that this task entered the working state, zero if the task completed before its first tick */
+	double StartedWorkingTimeInSeconds = 0.0;
+
+	/** ID of this task in the task begin and end trace events, zero until the task has been reported as in flight */
+	uint32 TaskTraceId = 0;
+
 	/** Critical section for locking the last update time in seconds */
 	FCriticalSection TimeoutLock;
 
@@ -206,6 +246,30 @@ protected:
 		CompleteState = InCompleteState;
 		bWasSuccessful = (CompleteState == EAccelByteAsyncTaskCompleteState::Success);
 		bIsComplete = true;
+
+		RecordTaskMetrics();
+	}
+
+	/**
+	 * Report timings for this task to the subsystem's task metrics registry once the task has completed. Tasks that are
+	 * completed before being initialized by the task manager are not reported, as they never counted as in flight.
+	 */
+	void RecordTaskMetrics() const
+	{
+		const FOnlineAsyncTaskMetricsAccelBytePtr TaskMetrics = Subsystem->GetAsyncTaskMetrics();
+		if (!TaskMetrics.IsValid() || InitializedTimeInSeconds <= 0.0)
+		{
+			return;
+		}
+
+		const double CompletedTimeInSeconds = FPlatformTime::Seconds();
+		const double WorkStartTimeInSeconds = (StartedWorkingTimeInSeconds > 0.0) ? StartedWorkingTimeInSeconds : InitializedTimeInSeconds;
+		TaskMetrics->RecordTaskCompleted(GetTaskName()
+			, TaskTraceId
+			, static_cast<uint8>(CompleteState)
+			, InitializedTimeInSeconds - CreatedTimeInSeconds
+			, CompletedTimeInSeconds - WorkStartTimeInSeconds
+			, CompletedTimeInSeconds - CreatedTimeInSeconds);
 	}
 
 	/**
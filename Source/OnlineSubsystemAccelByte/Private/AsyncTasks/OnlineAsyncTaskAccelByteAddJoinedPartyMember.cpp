@@ -29,10 +29,12 @@ void FOnlineAsyncTaskAccelByteAddJoinedPartyMember::Initialize()
 		return;
 	}
 
-	FOnQueryUsersComplete OnQueryJoinedPartyMemberCompleteDelegate = FOnQueryUsersComplete::CreateRaw(this, &FOnlineAsyncTaskAccelByteAddJoinedPartyMember::OnQueryJoinedPartyMemberComplete);
-	UserStore->QueryUsersByAccelByteIds(LocalUserNum, { JoinedAccelByteId }, OnQueryJoinedPartyMemberCompleteDelegate, true);
+	// Queued so that members joining in quick succession share one query, a member already in the cache is handed back
+	// straight away and the join is reported on the next tick without a round trip
+	FOnQueryUsersComplete OnQueryJoinedPartyMemberCompleteDelegate = TDelegateUtils<FOnQueryUsersComplete>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteAddJoinedPartyMember::OnQueryJoinedPartyMemberComplete);
+	UserStore->QueueQueryUsersByAccelByteIds(LocalUserNum, { JoinedAccelByteId }, OnQueryJoinedPartyMemberCompleteDelegate, true);
 
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Sent request to get further data on joined party member!"));
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Queued request to get further data on joined party member!"));
 }
 
 void FOnlineAsyncTaskAccelByteAddJoinedPartyMember::Tick()
@@ -4,13 +4,14 @@
 #pragma once
 
 #include "OnlineAsyncTaskAccelByte.h"
+#include "OnlineAsyncTaskAccelByteUtils.h"
 #include "OnlineSubsystemAccelByteTypes.h"
 #include "OnlinePartyInterfaceAccelByte.h"
 
 /**
  * Fill out information about your async task here.
  */
-class FOnlineAsyncTaskAccelByteAddJoinedPartyMember : public FOnlineAsyncTaskAccelByte
+class FOnlineAsyncTaskAccelByteAddJoinedPartyMember : public FOnlineAsyncTaskAccelByte, public TSelfPtr<FOnlineAsyncTaskAccelByteAddJoinedPartyMember, ESPMode::ThreadSafe>
 {
 public:
 
@@ -70,7 +70,8 @@ void FOnlineAsyncTaskAccelByteBlockPlayer::Finalize()
 				if (UserParty != nullptr)
 				{
 					// Check if the user is in a multi-user party
-					TArray<FOnlinePartyMemberConstRef> CurrentMembers = UserParty->GetAllMembers();
+					const TSharedRef<const FAccelBytePartyRoster> Roster = UserParty->GetRoster();
+					const TArray<FOnlinePartyMemberConstRef>& CurrentMembers = Roster->Members;
 					if (CurrentMembers.Num() > 1)
 					{
 						if (PartyInterface->IsMemberLeader(IdentityInterface->GetUniquePlayerId(LocalUserNum).ToSharedRef().Get(), UserParty->PartyId.Get(), IdentityInterface->GetUniquePlayerId(LocalUserNum).ToSharedRef().Get()))
@@ -1,6 +1,7 @@
 ﻿#include "OnlineAsyncTaskAccelByteCheckout.h"
 
 #include "OnlinePurchaseInterfaceAccelByte.h"
+#include "OnlineWalletInterfaceAccelByte.h"
 #include "OnlineError.h"
 
 #define ONLINE_ERROR_NAMESPACE "FOnlineStoreSystemAccelByte"
@@ -50,6 +51,7 @@ void FOnlineAsyncTaskAccelByteCheckout::Initialize()
 	OrderRequest.Price = Offer->RegularPrice;
 	OrderRequest.DiscountedPrice = Offer->NumericPrice;
 	OrderRequest.CurrencyCode = Offer->CurrencyCode;
+	CurrencyCode = OrderRequest.CurrencyCode;
 	if(FString* Region = Offer->DynamicFields.Find(TEXT("Region")))
 	{
 		OrderRequest.Region = *Region;
@@ -68,6 +70,13 @@ void FOnlineAsyncTaskAccelByteCheckout::Finalize()
 	
 	const FOnlinePurchaseAccelBytePtr PurchaseInterface = StaticCastSharedPtr<FOnlinePurchaseAccelByte>(Subsystem->GetPurchaseInterface());
 	PurchaseInterface->AddReceipt(UserId.ToSharedRef(), Receipt);
+
+	// Paying for the order changes the balance of the currency it was priced in, so drop that balance from the wallet cache
+	const FOnlineWalletAccelBytePtr WalletInterface = Subsystem->GetWalletInterface();
+	if (bWasSuccessful && WalletInterface.IsValid())
+	{
+		WalletInterface->InvalidateWalletInfo(UserId.ToSharedRef().Get(), TArray<FString>{ CurrencyCode });
+	}
 	
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -27,6 +27,9 @@ private:
 	void HandleAsyncTaskError(int32 Code, FString const& ErrMsg);
 
 	FString Language;
+
+	/** Currency code that the order was priced in, used to invalidate the cached wallet balance for that currency */
+	FString CurrencyCode;
 	FPurchaseCheckoutRequest CheckoutRequest;
 	FOnPurchaseCheckoutComplete Delegate;
 	FPurchaseReceipt Receipt;
@@ -71,6 +71,7 @@ void FOnlineAsyncTaskAccelByteCreateParty::Finalize()
 		}
 
 		PartyInterface->AddPartyToInterface(UserId.ToSharedRef(), Party);
+		PartyInterface->SavePartySnapshot(UserId.ToSharedRef(), Party);
 		PartyId = Party->PartyId;
 	}
 
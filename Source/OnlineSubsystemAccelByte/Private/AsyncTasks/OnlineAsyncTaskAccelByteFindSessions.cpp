@@ -7,10 +7,13 @@
 #include "OnlineIdentityInterfaceAccelByte.h"
 #include "Misc/DefaultValueHelper.h"
 #include "OnlineSubsystemAccelByteDefines.h"
+#include "OnlineSubsystemAccelByteUtils.h"
+#include "OnlineSessionPingManagerAccelByte.h"
 
-FOnlineAsyncTaskAccelByteFindSessions::FOnlineAsyncTaskAccelByteFindSessions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& InSearchSettings)
+FOnlineAsyncTaskAccelByteFindSessions::FOnlineAsyncTaskAccelByteFindSessions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& InSearchSettings, const FString& InSearchCacheKey)
 	: FOnlineAsyncTaskAccelByte(InABInterface, true)
 	, SearchSettings(InSearchSettings)
+	, SearchCacheKey(InSearchCacheKey)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InSearchingPlayerId.AsShared());
 }
@@ -69,6 +72,15 @@ void FOnlineAsyncTaskAccelByteFindSessions::Finalize()
 		SearchSettings->SearchState = EOnlineAsyncTaskState::Failed;
 	}
 
+	if (!SearchCacheKey.IsEmpty())
+	{
+		const FOnlineSessionAccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionAccelByte>(Subsystem->GetSessionInterface());
+		if (SessionInterface.IsValid())
+		{
+			SessionInterface->OnSessionSearchRefreshComplete(SearchCacheKey, bWasSuccessful, SearchResults);
+		}
+	}
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
@@ -76,9 +88,13 @@ void FOnlineAsyncTaskAccelByteFindSessions::TriggerDelegates()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
 
-	check(Subsystem != nullptr);
-	const IOnlineSessionPtr SessionInterface = Subsystem->GetSessionInterface();
-	SessionInterface->TriggerOnFindSessionsCompleteDelegates(bWasSuccessful);
+	// Cached searches are completed by the session interface, which knows every search that was waiting on this refresh
+	if (SearchCacheKey.IsEmpty())
+	{
+		check(Subsystem != nullptr);
+		const IOnlineSessionPtr SessionInterface = Subsystem->GetSessionInterface();
+		SessionInterface->TriggerOnFindSessionsCompleteDelegates(bWasSuccessful);
+	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -97,6 +113,9 @@ void FOnlineAsyncTaskAccelByteFindSessions::OnSessionBrowserFindSuccess(const FA
 	// Update the timeout just in case processing takes a bit of time
 	SetLastUpdateTimeToCurrentTime();
 
+	const FOnlineSessionPingManagerAccelBytePtr PingManager = Subsystem->GetSessionPingManager();
+
+	SearchResults.Reserve(Result.Sessions.Num());
 	for (const FAccelByteModelsSessionBrowserData& FoundSession : Result.Sessions)
 	{
 		FOnlineSessionSearchResult SearchResult;
@@ -125,27 +144,11 @@ void FOnlineAsyncTaskAccelByteFindSessions::OnSessionBrowserFindSuccess(const FA
 		Session.SessionSettings.bIsLANMatch = false;
 		Session.SessionSettings.bShouldAdvertise = true;
 
-		auto Setting = FoundSession.Game_session_setting.Settings;
-		if(Setting.JsonObject.IsValid())
+		const TSharedPtr<FJsonObject>& SettingJson = FoundSession.Game_session_setting.Settings.JsonObject;
+		if (SettingJson.IsValid())
 		{
-			for(const auto &JValue : FoundSession.Game_session_setting.Settings.JsonObject->Values)
-			{
-				switch (JValue.Value->Type)
-				{
-				case EJson::String:						
-					Session.SessionSettings.Set(FName(JValue.Key), JValue.Value->AsString());
-					break;
-				case EJson::Boolean:						
-					Session.SessionSettings.Set(FName(JValue.Key), JValue.Value->AsBool());
-					break;
-				case EJson::Number:						
-					Session.SessionSettings.Set(FName(JValue.Key), JValue.Value->AsNumber());
-					break;
-				default:
-					break;
-				}
-			}
-		}		
+			FOnlineSubsystemAccelByteUtils::JsonObjectToSessionSettings(*SettingJson, Session.SessionSettings.Settings);
+		}
 
 		TSharedPtr<FOnlineSessionInfoAccelByte> SessionInfo = MakeShared<FOnlineSessionInfoAccelByte>();
 		SessionInfo->SetSessionId(FoundSession.Session_id);
@@ -186,6 +189,13 @@ void FOnlineAsyncTaskAccelByteFindSessions::OnSessionBrowserFindSuccess(const FA
 		Session.SessionInfo = SessionInfo;
 
 		SearchResult.Session = Session;
+
+		// Hosts that were pinged recently keep their ping, anything else is filled in by PingSearchResults
+		if (PingManager.IsValid())
+		{
+			PingManager->GetCachedPing(SearchResult, SearchResult.PingInMs);
+		}
+
 		SearchResults.Add(SearchResult);
 	}
 
@@ -15,8 +15,13 @@ class FOnlineAsyncTaskAccelByteFindSessions : public FOnlineAsyncTaskAccelByte
 {
 public:
 
-	/** Constructor to setup the FindSessions task */
-	FOnlineAsyncTaskAccelByteFindSessions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& InSearchSettings);
+	/**
+	 * Constructor to setup the FindSessions task
+	 *
+	 * @param InSearchCacheKey Key of the cached search that this task is refreshing. If set, the results are handed to the
+	 * session interface's search cache, which completes the searches waiting on them, instead of firing delegates here.
+	 */
+	FOnlineAsyncTaskAccelByteFindSessions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& InSearchSettings, const FString& InSearchCacheKey = TEXT(""));
 
 	virtual void Initialize() override;
 	virtual void Finalize() override;
@@ -34,6 +39,9 @@ private:
 	/** Settings that we wish to use to find sessions from the backend */
 	TSharedRef<FOnlineSessionSearch> SearchSettings;
 
+	/** Key of the cached search that this task is refreshing, empty for an uncached search */
+	FString SearchCacheKey;
+
 	/** Sessions that were found for this particular search request */
 	TArray<FOnlineSessionSearchResult> SearchResults;
 
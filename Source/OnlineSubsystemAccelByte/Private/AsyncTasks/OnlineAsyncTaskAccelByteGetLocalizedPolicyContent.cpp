@@ -25,100 +25,58 @@ void FOnlineAsyncTaskAccelByteGetLocalizedPolicyContent::Initialize()
 	const FOnlineAgreementAccelBytePtr AgreementInterface = StaticCastSharedPtr<FOnlineAgreementAccelByte>(Subsystem->GetAgreementInterface());
 	if (AgreementInterface.IsValid())
 	{
-		FString InLocalizedPolicyContent;
-		if (AgreementInterface->GetLocalizedPolicyContentFromCache(BasePolicyId, LocaleCode, InLocalizedPolicyContent) && !bAlwaysRequestToService)
-		{
-			LocalizedPolicyContent = InLocalizedPolicyContent;
-			CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-			AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Localized Policy Content found for user index '%d'!"), LocalUserNum);
-		}
-		else
+		FString CachedContent;
+		FString CachedVersionKey;
+		const bool bHasCachedContent = AgreementInterface->GetLocalizedPolicyContentFromCache(BasePolicyId, LocaleCode, CachedContent, CachedVersionKey);
+
+		TArray<TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>> EligibilitiesRef;
+		if (AgreementInterface->GetEligibleAgreements(LocalUserNum, EligibilitiesRef))
 		{
-			TArray<TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>> EligibilitiesRef;
-			if (AgreementInterface->GetEligibleAgreements(LocalUserNum, EligibilitiesRef))
+			if (!FOnlineAgreementAccelByte::FindLocalizedPolicyAttachment(EligibilitiesRef, BasePolicyId, LocaleCode, BaseUrl, AttachmentLocation))
 			{
-				bool bNotFound = false;
-				FString DefaultPolicyLocation = TEXT("");
-				for (const auto& Eligibility : EligibilitiesRef)
-				{
-					if (Eligibility->PolicyId == BasePolicyId)
-					{
-						BaseUrl = Eligibility->BaseUrls[0];
-						for (const auto& Version : Eligibility->PolicyVersions)
-						{
-							if (Version.IsInEffect)
-							{
-								for (const auto& Localized : Version.LocalizedPolicyVersions)
-								{
-									if (Localized.LocaleCode == LocaleCode)
-									{
-										AttachmentLocation = Localized.AttachmentLocation;
-										break;
-									}
-									if (Localized.IsDefaultSelection)
-									{
-										DefaultPolicyLocation = Localized.AttachmentLocation;
-									}
-								}
-								if (AttachmentLocation.IsEmpty())
-								{
-									if (DefaultPolicyLocation.IsEmpty())
-									{
-										bNotFound = true;
-									}
-									else
-									{
-										AttachmentLocation = DefaultPolicyLocation;
-									}
-								}
-							}
-							if (!AttachmentLocation.IsEmpty())
-							{
-								break;
-							}
-							if (bNotFound)
-							{
-								break;
-							}
-						}
-					}
-					if (!BaseUrl.IsEmpty())
-					{
-						break;
-					}
-					if (bNotFound)
-					{
-						break;
-					}
-				}
-				if (bNotFound)
-				{
-					ErrorStr = TEXT("request-failed-localized-content-not-found-error");
-					UE_LOG_AB(Warning, TEXT("Failed to get localized policy content! Localized Content Not Found"));
-					CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
-				}
-				else
-				{
-					// Create delegates for successfully as well as unsuccessfully get localized policy content
-					OnGetLocalizedPolicyContentSuccessDelegate = TDelegateUtils<THandler<FString>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetLocalizedPolicyContent::OnGetLocalizedPolicyContentSuccess);
-					OnGetLocalizedPolicyContentErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetLocalizedPolicyContent::OnGetLocalizedPolicyContentError);
-
-					if (!BaseUrl.EndsWith("/"))
-					{
-						BaseUrl += "/";
-					}
-
-					// Send off a request to get localized policy content, as well as connect our delegates for doing so
-					ApiClient->Agreement.GetLegalDocument(FString::Printf(TEXT("%s%s"), *BaseUrl, *AttachmentLocation), OnGetLocalizedPolicyContentSuccessDelegate, OnGetLocalizedPolicyContentErrorDelegate);
-				}
+				ErrorStr = TEXT("request-failed-localized-content-not-found-error");
+				UE_LOG_AB(Warning, TEXT("Failed to get localized policy content! Localized Content Not Found"));
+				CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+			}
+			else if (bHasCachedContent && !bAlwaysRequestToService && CachedVersionKey == AttachmentLocation)
+			{
+				// Cached content is the version in effect, no need to download the document again
+				LocalizedPolicyContent = CachedContent;
+				CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+				AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Localized Policy Content found for user index '%d'!"), LocalUserNum);
+				return;
 			}
 			else
 			{
-				ErrorStr = TEXT("request-failed-eligible-agreement-not-found-error");
-				UE_LOG_AB(Warning, TEXT("Failed to get localized policy content! Eligible Agreements Not Found, please query eligible agreements first"));
-				CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+				// Create delegates for successfully as well as unsuccessfully get localized policy content
+				OnGetLocalizedPolicyContentSuccessDelegate = TDelegateUtils<THandler<FString>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetLocalizedPolicyContent::OnGetLocalizedPolicyContentSuccess);
+				OnGetLocalizedPolicyContentErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetLocalizedPolicyContent::OnGetLocalizedPolicyContentError);
+
+				if (!BaseUrl.EndsWith("/"))
+				{
+					BaseUrl += "/";
+				}
+
+				// Send off a request to get localized policy content, as well as connect our delegates for doing so
+				ApiClient->Agreement.GetLegalDocument(FString::Printf(TEXT("%s%s"), *BaseUrl, *AttachmentLocation), OnGetLocalizedPolicyContentSuccessDelegate, OnGetLocalizedPolicyContentErrorDelegate);
 			}
 		}
+		else if (bHasCachedContent && !bAlwaysRequestToService)
+		{
+			// Eligibilities have not been queried yet, so serve what we have without holding up the caller and check
+			// that it is still the version in effect once the eligibilities come in
+			LocalizedPolicyContent = CachedContent;
+			AgreementInterface->MarkLocalizedPolicyContentForRevalidation(BasePolicyId, LocaleCode);
+			CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+			AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Localized Policy Content served from cache pending revalidation for user index '%d'!"), LocalUserNum);
+			return;
+		}
+		else
+		{
+			ErrorStr = TEXT("request-failed-eligible-agreement-not-found-error");
+			UE_LOG_AB(Warning, TEXT("Failed to get localized policy content! Eligible Agreements Not Found, please query eligible agreements first"));
+			CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+		}
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -152,18 +110,8 @@ void FOnlineAsyncTaskAccelByteGetLocalizedPolicyContent::OnGetLocalizedPolicyCon
 	LocalizedPolicyContent = Result;
 
 	if (AgreementInterface.IsValid())
-	{	
-		auto ExistingLocalizedPolicies = AgreementInterface->LocalizedContentMap.Find(BasePolicyId);
-		if (ExistingLocalizedPolicies == nullptr)
-		{
-			TArray<FABLocalizedPolicyContent> LocalizedPolicies{ FABLocalizedPolicyContent{LocalizedPolicyContent, LocaleCode} };
-			AgreementInterface->LocalizedContentMap.Emplace(BasePolicyId, LocalizedPolicies);
-		}
-		else
-		{
-			ExistingLocalizedPolicies->Add(FABLocalizedPolicyContent{LocalizedPolicyContent, LocaleCode});
-			AgreementInterface->LocalizedContentMap.Emplace(BasePolicyId, *ExistingLocalizedPolicies);
-		}
+	{
+		AgreementInterface->AddLocalizedPolicyContentToCache(BasePolicyId, LocaleCode, AttachmentLocation, LocalizedPolicyContent);
 	}
 
 	CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
@@ -24,8 +24,9 @@ void FOnlineAsyncTaskAccelByteGetWalletInfo::Initialize()
 	const FOnlineWalletAccelBytePtr WalletInterface = StaticCastSharedPtr<FOnlineWalletAccelByte>(Subsystem->GetWalletInterface());
 	if (WalletInterface.IsValid())
 	{
+		// Only serve from the cache if the balance has not been invalidated by a purchase or redeem, and is within its TTL
 		FAccelByteModelsWalletInfo WalletInfo;
-		if (!WalletInterface->GetWalletInfoFromCache(LocalUserNum, CurrencyCode, WalletInfo) || bAlwaysRequestToService)
+		if (bAlwaysRequestToService || !WalletInterface->GetFreshWalletInfoFromCache(LocalUserNum, CurrencyCode, WalletInfo))
 		{	
 			// Create delegates for successfully as well as unsuccessfully requesting to get wallet info
 			OnGetWalletInfoSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsWalletInfo>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetWalletInfo::OnGetWalletInfoSuccess);
@@ -0,0 +1,130 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineAsyncTaskAccelByteGetWalletInfos.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineIdentityInterfaceAccelByte.h"
+#include "OnlineWalletInterfaceAccelByte.h"
+
+FOnlineAsyncTaskAccelByteGetWalletInfos::FOnlineAsyncTaskAccelByteGetWalletInfos(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const TArray<FString>& InCurrencyCodes, bool bInAlwaysRequestToService)
+	: FOnlineAsyncTaskAccelByte(InABInterface)
+	, CurrencyCodes(InCurrencyCodes)
+	, bAlwaysRequestToService(bInAlwaysRequestToService)
+{
+	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InLocalUserId.AsShared());
+}
+
+void FOnlineAsyncTaskAccelByteGetWalletInfos::Initialize()
+{
+	Super::Initialize();
+
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Getting wallet infos, UserId: %s; Currency Count: %d"), *UserId->ToDebugString(), CurrencyCodes.Num());
+
+	const FOnlineWalletAccelBytePtr WalletInterface = StaticCastSharedPtr<FOnlineWalletAccelByte>(Subsystem->GetWalletInterface());
+	if (!WalletInterface.IsValid())
+	{
+		ErrorStr = TEXT("request-failed-wallet-interface-invalid");
+		UE_LOG_AB(Warning, TEXT("Failed to get wallet infos! wallet interface is invalid!"));
+		CompleteTask(EAccelByteAsyncTaskCompleteState::InvalidState);
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+		return;
+	}
+
+	// Split the requested currencies between ones we can answer from the cache and ones we need to ask the backend for
+	TArray<FString> CurrencyCodesToRequest;
+	for (const FString& CurrencyCode : CurrencyCodes)
+	{
+		FAccelByteModelsWalletInfo WalletInfo;
+		if (!bAlwaysRequestToService && WalletInterface->GetFreshWalletInfoFromCache(LocalUserNum, CurrencyCode, WalletInfo))
+		{
+			CachedWalletInfos.Add(WalletInfo);
+		}
+		else
+		{
+			CurrencyCodesToRequest.AddUnique(CurrencyCode);
+		}
+	}
+
+	if (CurrencyCodesToRequest.Num() <= 0)
+	{
+		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("All %d requested wallet balances were served from the cache"), CachedWalletInfos.Num());
+		return;
+	}
+
+	// Set the pending count before sending anything off, as a response could return before we finish dispatching
+	PendingRequestCount = CurrencyCodesToRequest.Num();
+	for (const FString& CurrencyCode : CurrencyCodesToRequest)
+	{
+		const THandler<FAccelByteModelsWalletInfo> OnGetWalletInfoSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsWalletInfo>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetWalletInfos::OnGetWalletInfoSuccess, CurrencyCode);
+		const FErrorHandler OnGetWalletInfoErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetWalletInfos::OnGetWalletInfoError, CurrencyCode);
+		ApiClient->Wallet.GetWalletInfoByCurrencyCode(CurrencyCode, OnGetWalletInfoSuccessDelegate, OnGetWalletInfoErrorDelegate);
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Sent %d wallet info requests, %d balances served from the cache"), CurrencyCodesToRequest.Num(), CachedWalletInfos.Num());
+}
+
+void FOnlineAsyncTaskAccelByteGetWalletInfos::TriggerDelegates()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+
+	const FOnlineWalletAccelBytePtr WalletInterface = StaticCastSharedPtr<FOnlineWalletAccelByte>(Subsystem->GetWalletInterface());
+	if (WalletInterface.IsValid())
+	{
+		WalletInterface->TriggerOnGetWalletInfosCompletedDelegates(LocalUserNum, bWasSuccessful, CachedWalletInfos, ErrorStr);
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteGetWalletInfos::OnGetWalletInfoSuccess(const FAccelByteModelsWalletInfo& Result, FString RequestedCurrencyCode)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("CurrencyCode: %s"), *RequestedCurrencyCode);
+
+	const FOnlineWalletAccelBytePtr WalletInterface = StaticCastSharedPtr<FOnlineWalletAccelByte>(Subsystem->GetWalletInterface());
+	if (WalletInterface.IsValid())
+	{
+		WalletInterface->AddWalletInfoToList(LocalUserNum, RequestedCurrencyCode, MakeShared<FAccelByteModelsWalletInfo>(Result));
+	}
+
+	{
+		FScopeLock ScopeLock(&ResultLock);
+		CachedWalletInfos.Add(Result);
+	}
+
+	OnRequestReturned();
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteGetWalletInfos::OnGetWalletInfoError(int32 ErrorCode, const FString& ErrorMessage, FString RequestedCurrencyCode)
+{
+	UE_LOG_AB(Warning, TEXT("Failed to get wallet info for currency '%s'! Error Code: %d; Error Message: %s"), *RequestedCurrencyCode, ErrorCode, *ErrorMessage);
+
+	{
+		FScopeLock ScopeLock(&ResultLock);
+		bHasRequestFailed = true;
+	}
+
+	OnRequestReturned();
+}
+
+void FOnlineAsyncTaskAccelByteGetWalletInfos::OnRequestReturned()
+{
+	FScopeLock ScopeLock(&ResultLock);
+	PendingRequestCount--;
+	if (PendingRequestCount > 0)
+	{
+		return;
+	}
+
+	if (bHasRequestFailed)
+	{
+		ErrorStr = TEXT("request-failed-get-wallet-infos-error");
+		CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+	}
+	else
+	{
+		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+	}
+}
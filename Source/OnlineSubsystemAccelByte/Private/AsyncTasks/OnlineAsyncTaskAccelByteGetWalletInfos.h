@@ -0,0 +1,72 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "OnlineAsyncTaskAccelByte.h"
+#include "OnlineAsyncTaskAccelByteUtils.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Models/AccelByteEcommerceModels.h"
+#include <OnlineIdentityInterfaceAccelByte.h>
+#include <OnlineWalletInterfaceAccelByte.h>
+
+/**
+ * Task for getting wallet info for several currencies at once. Currencies that have a fresh cached balance are served
+ * from the wallet cache, the rest are requested from the backend concurrently and the task completes once every request
+ * has returned.
+ */
+class FOnlineAsyncTaskAccelByteGetWalletInfos : public FOnlineAsyncTaskAccelByte, public TSelfPtr<FOnlineAsyncTaskAccelByteGetWalletInfos, ESPMode::ThreadSafe>
+{
+public:
+
+	FOnlineAsyncTaskAccelByteGetWalletInfos(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const TArray<FString>& InCurrencyCodes, bool bInAlwaysRequestToService);
+
+	virtual void Initialize() override;
+	virtual void TriggerDelegates() override;
+
+protected:
+
+	virtual const FString GetTaskName() const override
+	{
+		return TEXT("FOnlineAsyncTaskAccelByteGetWalletInfos");
+	}
+
+private:
+
+	/**
+	 * Delegate handler for when get wallet info succeeds for a single currency
+	 */
+	void OnGetWalletInfoSuccess(const FAccelByteModelsWalletInfo& Result, FString RequestedCurrencyCode);
+
+	/**
+	 * Delegate handler for when get wallet info fails for a single currency
+	 */
+	void OnGetWalletInfoError(int32 ErrorCode, const FString& ErrorMessage, FString RequestedCurrencyCode);
+
+	/**
+	 * Marks a single request as returned, completing the task once no requests are left in flight
+	 */
+	void OnRequestReturned();
+
+	/**
+	 * String representing the error code that occurred
+	 */
+	FString ErrorStr;
+
+	/** Currencies that were requested for this task */
+	TArray<FString> CurrencyCodes;
+
+	/** Wallet info for every currency that we either found in the cache or received from the backend */
+	TArray<FAccelByteModelsWalletInfo> CachedWalletInfos;
+
+	/** Lock for CachedWalletInfos, PendingRequestCount and bHasRequestFailed as responses may return on different threads */
+	FCriticalSection ResultLock;
+
+	/** Number of requests to the backend that have not returned yet */
+	int32 PendingRequestCount = 0;
+
+	/** Whether any of the requests to the backend have failed */
+	bool bHasRequestFailed = false;
+
+	bool bAlwaysRequestToService;
+};
@@ -7,13 +7,16 @@
 #include "OnlineIdentityInterfaceAccelByte.h"
 #include "OnlineWalletInterfaceAccelByte.h"
 
-FOnlineAsyncTaskAccelByteGetWalletTransactions::FOnlineAsyncTaskAccelByteGetWalletTransactions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FString& InCurrencyCode, int32 InOffset, int32 InLimit)
+FOnlineAsyncTaskAccelByteGetWalletTransactions::FOnlineAsyncTaskAccelByteGetWalletTransactions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FString& InCurrencyCode, int32 InOffset, int32 InLimit, bool bInIsStreamRequest, uint32 InStreamGeneration)
 	: FOnlineAsyncTaskAccelByte(InABInterface)
 	, ErrorStr(TEXT(""))
 	, CachedWalletTransactions(TArray<FAccelByteModelsWalletTransactionInfo>{})
 	, CurrencyCode(InCurrencyCode)
 	, Offset(InOffset)
 	, Limit(InLimit)
+	, bIsStreamRequest(bInIsStreamRequest)
+	, StreamGeneration(InStreamGeneration)
+	, bHasNextPage(false)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InLocalUserId.AsShared());
 }
@@ -22,7 +25,7 @@ void FOnlineAsyncTaskAccelByteGetWalletTransactions::Initialize()
 {
 	Super::Initialize();
 
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Getting wallet transaction list, UserId: %s"), *UserId->ToDebugString());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Getting wallet transaction list, UserId: %s, Offset: %d, Limit: %d"), *UserId->ToDebugString(), Offset, Limit);
 
 	const FOnlineWalletAccelBytePtr WalletInterface = StaticCastSharedPtr<FOnlineWalletAccelByte>(Subsystem->GetWalletInterface());
 	if (WalletInterface.IsValid())
@@ -32,7 +35,7 @@ void FOnlineAsyncTaskAccelByteGetWalletTransactions::Initialize()
 		OnGetWalletTransactionsErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteGetWalletTransactions::OnGetWalletTransactionsError);
 
 		// Send off a request to get wallet transaction list, as well as connect our delegates for doing so
-		ApiClient->Wallet.ListWalletTransactionsByCurrencyCode(CurrencyCode, OnGetWalletTransactionsSuccessDelegate, OnGetWalletTransactionsErrorDelegate);
+		ApiClient->Wallet.ListWalletTransactionsByCurrencyCode(CurrencyCode, OnGetWalletTransactionsSuccessDelegate, OnGetWalletTransactionsErrorDelegate, Offset, Limit);
 	}
 	else
 	{
@@ -51,7 +54,14 @@ void FOnlineAsyncTaskAccelByteGetWalletTransactions::TriggerDelegates()
 	const FOnlineWalletAccelBytePtr WalletInterface = StaticCastSharedPtr<FOnlineWalletAccelByte>(Subsystem->GetWalletInterface());
 	if (WalletInterface.IsValid())
 	{
-		WalletInterface->TriggerOnGetWalletTransactionsCompletedDelegates(LocalUserNum, bWasSuccessful, CachedWalletTransactions, ErrorStr);
+		if (bIsStreamRequest)
+		{
+			WalletInterface->OnWalletTransactionStreamPageReceived(LocalUserNum, *UserId, CurrencyCode, StreamGeneration, bWasSuccessful, CachedWalletTransactions, bHasNextPage, ErrorStr);
+		}
+		else
+		{
+			WalletInterface->TriggerOnGetWalletTransactionsCompletedDelegates(LocalUserNum, bWasSuccessful, CachedWalletTransactions, ErrorStr);
+		}
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -65,6 +75,7 @@ void FOnlineAsyncTaskAccelByteGetWalletTransactions::OnGetWalletTransactionsSucc
 	if (WalletInterface.IsValid())
 	{
 		CachedWalletTransactions = Result.Data;
+		bHasNextPage = !Result.Paging.Next.IsEmpty();
 	}
 	else
 	{
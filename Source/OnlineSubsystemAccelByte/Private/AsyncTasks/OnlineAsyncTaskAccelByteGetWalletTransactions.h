@@ -17,7 +17,7 @@ class FOnlineAsyncTaskAccelByteGetWalletTransactions : public FOnlineAsyncTaskAc
 {
 public:
 
-	FOnlineAsyncTaskAccelByteGetWalletTransactions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FString& InCurrencyCode, int32 InOffset, int32 InLimit);
+	FOnlineAsyncTaskAccelByteGetWalletTransactions(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FString& InCurrencyCode, int32 InOffset, int32 InLimit, bool bInIsStreamRequest = false, uint32 InStreamGeneration = 0);
 
 	virtual void Initialize() override;
 	virtual void TriggerDelegates() override;
@@ -52,4 +52,13 @@ private:
 	FString CurrencyCode;
 	int32 Offset, Limit;
 	bool bAlwaysRequestToService;
+
+	/** Whether this page was requested by a transaction stream, in which case it is handed to the stream instead of the completion delegate */
+	bool bIsStreamRequest;
+
+	/** Generation of the stream when this page was requested, used to drop pages for a stream that has since been reopened */
+	uint32 StreamGeneration;
+
+	/** Whether the backend reported another page after this one */
+	bool bHasNextPage;
 };
@@ -106,6 +106,8 @@ void FOnlineAsyncTaskAccelByteJoinParty::Finalize()
 		{
 			PartyInterface->AddPartyToInterface(Member->Id.ToSharedRef(), Party);
 		}
+
+		PartyInterface->SavePartySnapshot(UserId.ToSharedRef(), Party);
 	}
 	else if (OnlinePartyJoinInfo.IsValid())
 	{
@@ -171,10 +173,19 @@ void FOnlineAsyncTaskAccelByteJoinParty::OnGetPartyInfoResponse(const FAccelByte
 	// otherwise, we will try and join via party code
 	if (OnlinePartyJoinInfo.IsValid())
 	{
+		// Invites can expire or be dropped while the join info for them is still held, so there may be no token to join with
+		const TSharedPtr<const FAccelBytePartyInvite> PartyInvite = PartyInterface->GetInviteForParty(UserId.ToSharedRef() ,StaticCastSharedRef<const FOnlinePartyIdAccelByte>(OnlinePartyJoinInfo.GetPartyId()));
+		if (!PartyInvite.IsValid())
+		{
+			AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Could not join party %s as there is no pending invite for it!"), *GetPartyInfoForError());
+			CompletionResult = EJoinPartyCompletionResult::JoinInfoInvalid;
+			CompleteTask(EAccelByteAsyncTaskCompleteState::InvalidState);
+			return;
+		}
+
 		// Now, send the actual request to join a party via PartyId
 		const AccelByte::Api::Lobby::FPartyJoinResponse OnJoinPartyResponseDelegate = TDelegateUtils<AccelByte::Api::Lobby::FPartyJoinResponse>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteJoinParty::OnJoinPartyResponse);
 		ApiClient->Lobby.SetInvitePartyJoinResponseDelegate(OnJoinPartyResponseDelegate);
-		const TSharedPtr<const FAccelBytePartyInvite> PartyInvite = PartyInterface->GetInviteForParty(UserId.ToSharedRef() ,StaticCastSharedRef<const FOnlinePartyIdAccelByte>(OnlinePartyJoinInfo.GetPartyId()));
 		ApiClient->Lobby.SendAcceptInvitationRequest(OnlinePartyJoinInfo.GetPartyId()->ToString(), PartyInvite->InviteToken);
 	}
 	else
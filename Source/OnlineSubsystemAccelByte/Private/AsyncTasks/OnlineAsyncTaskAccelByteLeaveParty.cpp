@@ -94,8 +94,8 @@ void FOnlineAsyncTaskAccelByteLeaveParty::Finalize()
 			TSharedPtr<FOnlinePartyAccelByte> Party = PartyInterface->GetPartyForUser(UserId.ToSharedRef(), PartyId);
 			if (Party.IsValid())
 			{
-				TArray<FOnlinePartyMemberConstRef> Members = Party->GetAllMembers();
-				for (const FOnlinePartyMemberConstRef& Member : Members)
+				const TSharedRef<const FAccelBytePartyRoster> Roster = Party->GetRoster();
+				for (const FOnlinePartyMemberConstRef& Member : Roster->Members)
 				{
 					TSharedRef<const FUniqueNetIdAccelByteUser> MemberId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(Member->GetUserId());
 					PartyInterface->RemovePartyForUser(MemberId, PartyId);
@@ -103,6 +103,8 @@ void FOnlineAsyncTaskAccelByteLeaveParty::Finalize()
 
 				PartyInterface->RemovePartyForUser(UserId.ToSharedRef(), PartyId);
 			}
+
+			PartyInterface->RemovePartySnapshot(UserId.ToSharedRef());
 		}
 	}
 
@@ -53,6 +53,22 @@ void FOnlineAsyncTaskAccelByteQueryEligibilities::Initialize()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
+void FOnlineAsyncTaskAccelByteQueryEligibilities::Finalize()
+{
+	Super::Finalize();
+
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+
+	// Fresh eligibilities carry the policy versions in effect, use them to check any content served from the disk cache
+	const FOnlineAgreementAccelBytePtr AgreementInterface = StaticCastSharedPtr<FOnlineAgreementAccelByte>(Subsystem->GetAgreementInterface());
+	if (bWasSuccessful && bHasQueriedFromService && AgreementInterface.IsValid())
+	{
+		AgreementInterface->RevalidateLocalizedPolicyContent(LocalUserNum);
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
 void FOnlineAsyncTaskAccelByteQueryEligibilities::TriggerDelegates()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
@@ -89,6 +105,7 @@ void FOnlineAsyncTaskAccelByteQueryEligibilities::OnQueryEligibilitiesSuccess(co
 	const FOnlineAgreementAccelBytePtr AgreementInterface = StaticCastSharedPtr<FOnlineAgreementAccelByte>(Subsystem->GetAgreementInterface());
 	
 	Eligibilities = Result;
+	bHasQueriedFromService = true;
 	
 	if (AgreementInterface.IsValid())
 	{
@@ -20,6 +20,7 @@ public:
 	FOnlineAsyncTaskAccelByteQueryEligibilities(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, bool bInNotAcceptedOnly, bool bInAlwaysRequestToService);
 
 	virtual void Initialize() override;
+	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
 protected:
@@ -55,4 +56,7 @@ private:
 
 	bool bNotAcceptedOnly;
 	bool bAlwaysRequestToService;
+
+	/** Whether the eligibilities were queried from the service rather than served from the cache */
+	bool bHasQueriedFromService = false;
 };
@@ -40,7 +40,7 @@ void FOnlineAsyncTaskAccelByteQueryPartyInfo::Initialize()
 	}
 
 	FOnQueryUsersComplete OnQueryPartyMembersCompleteDelegate = TDelegateUtils<FOnQueryUsersComplete>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteQueryPartyInfo::OnQueryPartyMembersComplete);
-	UserStore->QueryUsersByAccelByteIds(LocalUserNum, Members, OnQueryPartyMembersCompleteDelegate, true);
+	UserStore->QueueQueryUsersByAccelByteIds(LocalUserNum, Members, OnQueryPartyMembersCompleteDelegate, true);
 	
 	StatsQueriesRemaining.Set(Members.Num());
 	CustomizationQueriesRemaining.Set(Members.Num());
@@ -1,6 +1,7 @@
 ﻿#include "OnlineAsyncTaskAccelByteRedeemCode.h"
 
 #include "OnlinePurchaseInterfaceAccelByte.h"
+#include "OnlineWalletInterfaceAccelByte.h"
 
 FOnlineAsyncTaskAccelByteRedeemCode::FOnlineAsyncTaskAccelByteRedeemCode(
 	FOnlineSubsystemAccelByte* const InABSubsystem,
@@ -46,6 +47,13 @@ void FOnlineAsyncTaskAccelByteRedeemCode::Finalize()
 	const FOnlinePurchaseAccelBytePtr PurchaseInterface = StaticCastSharedPtr<FOnlinePurchaseAccelByte>(Subsystem->GetPurchaseInterface());
 	PurchaseInterface->AddReceipt(UserId.ToSharedRef(), Receipt);
 
+	// Credit summaries only carry a wallet ID, so any credited redeem invalidates every cached balance for the user
+	const FOnlineWalletAccelBytePtr WalletInterface = Subsystem->GetWalletInterface();
+	if (bWasSuccessful && bHasCreditedWallet && WalletInterface.IsValid())
+	{
+		WalletInterface->InvalidateWalletInfo(UserId.ToSharedRef().Get(), TArray<FString>{});
+	}
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
@@ -77,6 +85,7 @@ void FOnlineAsyncTaskAccelByteRedeemCode::HandleRedeemCodeComplete(const FAccelB
 		Receipt.ReceiptOffers.Add(ReceiptOfferEntry);
 	}
 
+	bHasCreditedWallet = Result.CreditSummaries.Num() > 0;
 	for (const auto& Credit : Result.CreditSummaries)
 	{
 		UE_LOG_AB(Log, TEXT("Credit Redeemed to Wallet! WalletId: %s | Amount: %s"), *Credit.WalletId, Credit.Amount);
@@ -31,4 +31,7 @@ private:
 	FRedeemCodeRequest RedeemCodeRequest;
 	FOnPurchaseRedeemCodeComplete Delegate;
 	FPurchaseReceipt Receipt;
+
+	/** Whether redeeming the code credited any of the user's wallets */
+	bool bHasCreditedWallet = false;
 };
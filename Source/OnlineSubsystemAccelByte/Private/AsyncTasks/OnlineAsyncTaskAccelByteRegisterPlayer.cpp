@@ -71,6 +71,18 @@ void FOnlineAsyncTaskAccelByteRegisterPlayers::Tick()
 	}
 }
 
+void FOnlineAsyncTaskAccelByteRegisterPlayers::Finalize()
+{
+	Super::Finalize();
+
+	// Registered players were changed locally as the task ran, let a session browser entry pick up the new count
+	const FOnlineSessionAccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionAccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->OnSessionPlayersChanged(SessionName);
+	}
+}
+
 void FOnlineAsyncTaskAccelByteRegisterPlayers::TriggerDelegates()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
@@ -52,15 +52,28 @@ void FOnlineAsyncTaskAccelByteRestoreParties::Initialize()
 void FOnlineAsyncTaskAccelByteRestoreParties::Tick()
 {
 	Super::Tick();
+
+	// Only complete once the member info and party storage have come back
+	if (!bIsComplete && bUserHasPartyToRestore && bHasQueriedPartyInfo)
+	{
+		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Party restored for user '%s' with ID '%s'!"), *UserId->ToDebugString(), *PartyInfo.PartyId);
+	}
 }
 
 void FOnlineAsyncTaskAccelByteRestoreParties::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
+	const TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> PartyInterface = StaticCastSharedPtr<FOnlinePartySystemAccelByte>(Subsystem->GetPartyInterface());
+	if (bWasSuccessful && bUserHasNoParty && PartyInterface.IsValid())
+	{
+		// The party in the last snapshot no longer exists for us, so it should not be shown on the next restore
+		PartyInterface->RemovePartySnapshot(UserId.ToSharedRef());
+	}
+
 	if (bWasSuccessful && bUserHasPartyToRestore)
 	{
-		const TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> PartyInterface = StaticCastSharedPtr<FOnlinePartySystemAccelByte>(Subsystem->GetPartyInterface());
 		if (!PartyInterface.IsValid())
 		{
 			AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to restore party as the party interface was invalid!"));
@@ -68,7 +81,7 @@ void FOnlineAsyncTaskAccelByteRestoreParties::Finalize()
 		}
 
 		// Construct the party instance and add it to the party interface
-		TSharedRef<FOnlinePartyAccelByte> Party = FOnlinePartyAccelByte::CreatePartyFromPartyInfo(UserId.ToSharedRef(), PartyInterface.ToSharedRef(), PartyInfo, PartyMemberInfo, PartyData, PartyCode);
+		TSharedRef<FOnlinePartyAccelByte> Party = FOnlinePartyAccelByte::CreatePartyFromPartyInfo(UserId.ToSharedRef(), PartyInterface.ToSharedRef(), PartyInfo, PartyMemberInfo, PartyData);
 		PartyId = StaticCastSharedRef<const FOnlinePartyIdAccelByte>(Party->PartyId);
 		PartyInterface->AddPartyToInterface(UserId.ToSharedRef(), Party);
 		
@@ -81,8 +94,8 @@ void FOnlineAsyncTaskAccelByteRestoreParties::Finalize()
 			PartyInterface->AddPartyToInterface(Member->Id.ToSharedRef(), Party);
 		}
 
-		// Get party code request for later stored in party storage
-		ApiClient->Lobby.SendPartyGetCodeRequest();
+		// Replace the last known party with the one we just restored
+		PartyInterface->SavePartySnapshot(UserId.ToSharedRef(), Party);
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -114,6 +127,7 @@ void FOnlineAsyncTaskAccelByteRestoreParties::OnGetPartyInfoResponse(const FAcce
 	// Response code 11223 is EIDPartyInfoSuccessGetUserPartyInfoEmpty, meaning that the call succeeded but the user is not in a party
 	if (Result.Code == TEXT("11223"))
 	{
+		bUserHasNoParty = true;
 		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("User is not in a party and therefore no party could be restored!"));
 		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
 	}
@@ -130,8 +144,12 @@ void FOnlineAsyncTaskAccelByteRestoreParties::OnGetPartyInfoResponse(const FAcce
 		PartyInfo = Result;
 		bUserHasPartyToRestore = true;
 
+		// Member info and party storage are queried by a task of their own. The party code is not requested, as the party
+		// has nowhere to keep it.
 		FOnQueryPartyInfoComplete OnQueryPartyInfoCompleteDelegate = FOnQueryPartyInfoComplete::CreateRaw(this, &FOnlineAsyncTaskAccelByteRestoreParties::OnQueryPartyInfoComplete);
 		Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryPartyInfo>(Subsystem, UserId.ToSharedRef().Get(), Result.PartyId, Result.Members, OnQueryPartyInfoCompleteDelegate);
+
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Sent off request for member info and party storage."));
 	}
 }
 
@@ -142,21 +160,7 @@ void FOnlineAsyncTaskAccelByteRestoreParties::OnQueryPartyInfoComplete(bool bIsS
 	{
 		PartyMemberInfo = Result.MemberInfo;
 		PartyData = Result.PartyData;
-		
-		if (UserId->GetAccelByteId() == PartyInfo.LeaderId)
-		{
-			// Send a request to get party code for the current party for party leader
-			const AccelByte::Api::Lobby::FPartyGetCodeResponse OnPartyGetCodeResponseDelegate = AccelByte::Api::Lobby::FPartyGetCodeResponse::CreateRaw(this, &FOnlineAsyncTaskAccelByteRestoreParties::OnPartyGetCodeResponse);
-			ApiClient->Lobby.SetPartyGetCodeResponseDelegate(OnPartyGetCodeResponseDelegate);
-			ApiClient->Lobby.SendPartyGetCodeRequest();
-		}
-		else
-		{
-			// Send a request to get party code for the current party for party member
-			const THandler<FAccelByteModelsPartyData> OnGetPartyDataSuccessDelegate = THandler<FAccelByteModelsPartyData>::CreateRaw(this, &FOnlineAsyncTaskAccelByteRestoreParties::OnGetPartyDataSuccess);
-			const FErrorHandler OnGetPartyDataErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteRestoreParties::OnGetPartyDataError);
-			ApiClient->Lobby.GetPartyData(PartyInfo.PartyId, OnGetPartyDataSuccessDelegate, OnGetPartyDataErrorDelegate);
-		}
+		bHasQueriedPartyInfo = true;
 	}
 	else
 	{
@@ -165,36 +169,4 @@ void FOnlineAsyncTaskAccelByteRestoreParties::OnQueryPartyInfoComplete(bool bIsS
 	}
 }
 
-void FOnlineAsyncTaskAccelByteRestoreParties::OnPartyGetCodeResponse(const FAccelByteModelsPartyGetCodeResponse& Result)
-{
-	if (Result.Code != TEXT("0"))
-	{
-		UE_LOG_AB(Warning, TEXT("Failed to restore party as we could not get the party code! Response from backend had error code '%s', party code will be empty"), *Result.Code);
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-	}
-	else
-	{
-		PartyCode = Result.PartyCode;
-
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-
-		UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Party restored for user '%s' with ID '%s'!"), *UserId->ToDebugString(), *PartyInfo.PartyId);
-	}
-
-	// Reset the party code delegate
-	ApiClient->Lobby.SetPartyGetCodeResponseDelegate(AccelByte::Api::Lobby::FPartyGetCodeResponse());
-}
-
-void FOnlineAsyncTaskAccelByteRestoreParties::OnGetPartyDataSuccess(const FAccelByteModelsPartyData& InPartyData)
-{
-	UE_LOG_AB(Warning, TEXT("Failed to get party code from party data, party code will be empty"));
-	CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-}
-
-void FOnlineAsyncTaskAccelByteRestoreParties::OnGetPartyDataError(int32 ErrorCode, const FString& ErrorMessage)
-{
-	UE_LOG_AB(Warning, TEXT("Failed to get party data from restored party from backend, party code will be empty"));
-	CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
-}
-
 #undef ONLINE_ERROR_NAMESPACE
@@ -11,6 +11,10 @@
 
 /**
  * Async task to restore parties if the user exits a game while still in a party. Does not work if Auto Kick on Disconnect is enabled in the admin portal.
+ *
+ * Once the backend tells us which party we are in, member info and party storage are requested at the same time, and
+ * the task completes once both have come back. While this runs, the last known party can be read through
+ * FOnlinePartySystemAccelByte::GetLastKnownPartySnapshot.
  */
 class FOnlineAsyncTaskAccelByteRestoreParties : public FOnlineAsyncTaskAccelByte
 {
@@ -41,6 +45,12 @@ private:
 	/** Flag representing whether we have any party info to restore, as this call can succeed but have no current party */
 	FThreadSafeBool bUserHasPartyToRestore = false;
 
+	/** Flag representing whether the backend told us that the user is not in a party, as opposed to failing to tell us */
+	FThreadSafeBool bUserHasNoParty = false;
+
+	/** Whether the query for member info and party storage has come back */
+	FThreadSafeBool bHasQueriedPartyInfo = false;
+
 	/** Object used to construct a new party from the restore info */
 	FAccelByteModelsInfoPartyResponse PartyInfo;
 
@@ -55,22 +65,10 @@ private:
 	 */
 	TSharedPtr<const class FOnlinePartyIdAccelByte> PartyId;
 
-	/** Code associated with the party being restored */
-	FString PartyCode;
-
 	/** Delegate handler for when we get a response back from the backend on current party info */
 	void OnGetPartyInfoResponse(const FAccelByteModelsInfoPartyResponse& Result);
 
 	/** Delegate handler for when our request to query all party info completes */
 	void OnQueryPartyInfoComplete(bool bIsSuccessful, const FAccelBytePartyInfo& Result);
-
-	/** Delegate handler for when our query to get a party code from the backend completes */
-	void OnPartyGetCodeResponse(const FAccelByteModelsPartyGetCodeResponse& Result);
-
-	/** Delegate handler for when get party data from the backend success */
-	void OnGetPartyDataSuccess(const FAccelByteModelsPartyData& InPartyData);
-
-	/** Delegate handler for when get party data from the backend error */
-	void OnGetPartyDataError(int32 ErrorCode, const FString& ErrorMessage);
 };
 
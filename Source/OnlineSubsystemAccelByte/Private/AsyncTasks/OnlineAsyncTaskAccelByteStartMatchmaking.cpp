@@ -13,6 +13,7 @@
 #include "OnlinePartyInterfaceAccelByte.h"
 #include "OnlineSubsystemAccelByteUtils.h"
 #include "OnlineUserInterfaceAccelByte.h"
+#include "OnlineQosManagerAccelByte.h"
 
 /**
  * Index of the player that is acting as host of this matchmaking session
@@ -76,7 +77,11 @@ void FOnlineAsyncTaskAccelByteStartMatchmaking::Initialize()
 	TSharedPtr<FOnlineUserAccelByte, ESPMode::ThreadSafe> UserInterface = StaticCastSharedPtr<FOnlineUserAccelByte>(Subsystem->GetUserInterface());
 	
 	SearchSettings->SearchState = EOnlineAsyncTaskState::InProgress;
-	if (ApiClient->Qos.GetCachedLatencies().Num() <= 0)
+
+	// Prefer the latencies kept fresh in the background by the QoS manager, and only ping regions here if no round of
+	// pings has completed yet (ex. matchmaking started right after login)
+	const FOnlineQosManagerAccelBytePtr QosManager = Subsystem->GetQosManager();
+	if (!QosManager.IsValid() || !QosManager->GetLatencies(Latencies))
 	{
 		const THandler<TArray<TPair<FString, float>>> OnGetServerLatenciesSuccessDelegate = THandler<TArray<TPair<FString, float>>>::CreateRaw(this, &FOnlineAsyncTaskAccelByteStartMatchmaking::OnGetServerLatenciesSuccess);
 		FErrorHandler OnGetServerLatenciesErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteStartMatchmaking::OnGetServerLatenciesError);
@@ -84,7 +89,6 @@ void FOnlineAsyncTaskAccelByteStartMatchmaking::Initialize()
 	}
 	else
 	{
-		Latencies = ApiClient->Qos.GetCachedLatencies();
 		AccelByte::Api::Lobby::FMatchmakingResponse OnStartMatchmakingResponseReceivedDelegate = AccelByte::Api::Lobby::FMatchmakingResponse::CreateRaw(this, &FOnlineAsyncTaskAccelByteStartMatchmaking::OnStartMatchmakingResponseReceived);
 		ApiClient->Lobby.SetStartMatchmakingResponseDelegate(OnStartMatchmakingResponseReceivedDelegate);
 		CreateMatchmakingSessionAndStartMatchmaking();
@@ -129,6 +133,12 @@ void FOnlineAsyncTaskAccelByteStartMatchmaking::OnGetServerLatenciesSuccess(cons
 
 	Latencies = Result;
 
+	const FOnlineQosManagerAccelBytePtr QosManager = Subsystem->GetQosManager();
+	if (QosManager.IsValid())
+	{
+		QosManager->AddLatencySamples(Result);
+	}
+
 	AccelByte::Api::Lobby::FMatchmakingResponse OnStartMatchmakingResponseReceivedDelegate = AccelByte::Api::Lobby::FMatchmakingResponse::CreateRaw(this, &FOnlineAsyncTaskAccelByteStartMatchmaking::OnStartMatchmakingResponseReceived);
 	ApiClient->Lobby.SetStartMatchmakingResponseDelegate(OnStartMatchmakingResponseReceivedDelegate);
 	CreateMatchmakingSessionAndStartMatchmaking();
@@ -6,6 +6,7 @@
 #include <OnlineSubsystemAccelByte.h>
 #include "Models/AccelByteEcommerceModels.h"
 #include "OnlineStoreInterfaceV2AccelByte.h"
+#include "OnlineWalletInterfaceAccelByte.h"
 
 FOnlineAsyncTaskAccelByteSyncDLC::FOnlineAsyncTaskAccelByteSyncDLC(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InUserId, const FOnRequestCompleted& InDelegate)
 	: FOnlineAsyncTaskAccelByte(InABInterface)
@@ -122,6 +123,21 @@ void FOnlineAsyncTaskAccelByteSyncDLC::Initialize()
 #endif
 }
 
+void FOnlineAsyncTaskAccelByteSyncDLC::Finalize()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+	Super::Finalize();
+
+	// Fulfilled platform items may include virtual currency, so any cached wallet balances for this user are now suspect
+	const FOnlineWalletAccelBytePtr WalletInterface = Subsystem->GetWalletInterface();
+	if (bWasSuccessful && UserId.IsValid() && WalletInterface.IsValid())
+	{
+		WalletInterface->InvalidateWalletInfo(UserId.ToSharedRef().Get(), TArray<FString>{});
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
 void FOnlineAsyncTaskAccelByteSyncDLC::TriggerDelegates()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
@@ -6,6 +6,7 @@
 
 #include "Core/AccelByteRegistry.h"
 #include "Api/AccelByteEntitlementApi.h"
+#include "OnlineWalletInterfaceAccelByte.h"
 
 FOnlineAsyncTaskAccelByteSyncPlatformPurchase::FOnlineAsyncTaskAccelByteSyncPlatformPurchase(FOnlineSubsystemAccelByte* const InABInterface, int32 InLocalUserNum, FAccelByteModelsEntitlementSyncBase InEntitlementSyncBase, const FOnRequestCompleted& InDelegate)
 	: FOnlineAsyncTaskAccelByte(InABInterface)
@@ -30,6 +31,21 @@ void FOnlineAsyncTaskAccelByteSyncPlatformPurchase::Initialize()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
+void FOnlineAsyncTaskAccelByteSyncPlatformPurchase::Finalize()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+	Super::Finalize();
+
+	// Fulfilled platform items may include virtual currency, so any cached wallet balances for this user are now suspect
+	const FOnlineWalletAccelBytePtr WalletInterface = Subsystem->GetWalletInterface();
+	if (bWasSuccessful && UserId.IsValid() && WalletInterface.IsValid())
+	{
+		WalletInterface->InvalidateWalletInfo(UserId.ToSharedRef().Get(), TArray<FString>{});
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
 void FOnlineAsyncTaskAccelByteSyncPlatformPurchase::TriggerDelegates()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
@@ -102,6 +102,18 @@ void FOnlineAsyncTaskAccelByteUnregisterPlayers::Tick()
 	}
 }
 
+void FOnlineAsyncTaskAccelByteUnregisterPlayers::Finalize()
+{
+	Super::Finalize();
+
+	// Registered players were changed locally as the task ran, let a session browser entry pick up the new count
+	const FOnlineSessionAccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionAccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->OnSessionPlayersChanged(SessionName);
+	}
+}
+
 void FOnlineAsyncTaskAccelByteUnregisterPlayers::TriggerDelegates()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
@@ -22,6 +22,7 @@ public:
 
 	virtual void Initialize() override;
 	virtual void Tick() override;
+	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
 protected:
@@ -8,11 +8,11 @@
 #include "Api/AccelByteLobbyApi.h"
 #include "OnlinePartyInterfaceAccelByte.h"
 
-FOnlineAsyncTaskAccelByteUpdatePartyData::FOnlineAsyncTaskAccelByteUpdatePartyData(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FOnlinePartyId& InPartyId, const FName& InNamespace, const FOnlinePartyData& InPartyData)
+FOnlineAsyncTaskAccelByteUpdatePartyData::FOnlineAsyncTaskAccelByteUpdatePartyData(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FOnlinePartyId& InPartyId, const FAccelBytePartyStorageDelta& InDelta, const FOnPartyStorageWriteComplete& InDelegate)
 	: FOnlineAsyncTaskAccelByte(InABInterface, true)
 	, PartyId(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(InPartyId.AsShared()))
-	, Namespace(InNamespace)
-	, PartyData(MakeShared<FOnlinePartyData>(InPartyData))
+	, Delta(InDelta)
+	, Delegate(InDelegate)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InLocalUserId.AsShared());
 }
@@ -21,10 +21,11 @@ void FOnlineAsyncTaskAccelByteUpdatePartyData::Initialize()
 {
 	Super::Initialize();
 
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s"), *UserId->ToDebugString(), *PartyId->ToString());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s; UpdatedAttrs: %d; RemovedAttrs: %d"), *UserId->ToDebugString(), *PartyId->ToString(), Delta.UpdatedAttrs.Num(), Delta.RemovedAttrs.Num());
 
-	// Create function for writing new data to party storage
-	TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriterFunction = [PartyData = PartyData](FJsonObjectWrapper PartyStorageData) {
+	// Create function for writing new data to party storage. Lobby calls this again with the latest storage whenever the
+	// write loses a race with another member's write, so it must only read from the delta and never consume it.
+	TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriterFunction = [Delta = Delta](FJsonObjectWrapper PartyStorageData) {
 		// Before doing anything, we want to make sure that the JSON object is valid so that we can modify it
 		if (!PartyStorageData.JsonObject.IsValid())
 		{
@@ -32,28 +33,7 @@ void FOnlineAsyncTaskAccelByteUpdatePartyData::Initialize()
 			return PartyStorageData;
 		}
 
-		// First we want to retrieve all dirty data that has been modified for this party data
-		FOnlineKeyValuePairs<FString, FVariantData> DirtyData;
-		TArray<FString> RemovedData;
-		PartyData->GetDirtyKeyValAttrs(DirtyData, RemovedData);
-
-		// Once we have done that, we want to iterate through the data that has changed, and update the JSON object
-		for (const TPair<FString, FVariantData>& Data : DirtyData)
-		{
-			// We also don't want a type suffix for this data, so just pass false at the end
-			// NOTE : Afif we do need the type suffix since we are retrieving the data by using FOnlinePartyData::FromJson
-			Data.Value.AddToJsonObject(PartyStorageData.JsonObject.ToSharedRef(), Data.Key, true);
-		}
-
-		// Now, we want to remove the fields in the JSON object that have been removed from the party data
-		for (const FString& Key : RemovedData)
-		{
-			PartyStorageData.JsonObject->RemoveField(Key);
-		}
-
-		// Finally, clear all data marked dirty from the party data object
-		PartyData->ClearDirty();
-
+		Delta.ApplyToJsonObject(PartyStorageData.JsonObject.ToSharedRef());
 		return PartyStorageData;
 	};
 
@@ -71,18 +51,20 @@ void FOnlineAsyncTaskAccelByteUpdatePartyData::Finalize()
 	if (bWasSuccessful)
 	{
 		// If we successfully wrote new data for the party, then we want to update the party data on the party object with
-		// with the updated data that we just sent off to the backend.
+		// with the changes that we just sent off to the backend.
 		const TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> PartyInterface = StaticCastSharedPtr<FOnlinePartySystemAccelByte>(Subsystem->GetPartyInterface());
 		if (PartyInterface.IsValid())
 		{
 			TSharedPtr<FOnlinePartyAccelByte> PartyObject = PartyInterface->GetPartyForUser(UserId.ToSharedRef(), PartyId);
 			if (PartyObject.IsValid())
 			{
-				PartyObject->SetPartyData(PartyData);
+				PartyObject->ApplyPartyDataDelta(Delta);
 			}
 		}
 	}
 
+	Delegate.ExecuteIfBound(bWasSuccessful);
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
@@ -8,15 +8,16 @@
 #include "Interfaces/OnlinePartyInterface.h"
 #include "Models/AccelByteLobbyModels.h"
 #include "OnlinePartyInterfaceAccelByte.h"
+#include "OnlinePartyStorageWriteCoalescerAccelByte.h"
 
 /**
- * Task for updating party storage for a party
+ * Task for writing a set of changes to party storage for a party, sent by the party's storage write coalescer
  */
 class FOnlineAsyncTaskAccelByteUpdatePartyData : public FOnlineAsyncTaskAccelByte
 {
 public:
 
-	FOnlineAsyncTaskAccelByteUpdatePartyData(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FOnlinePartyId& InPartyId, const FName& InNamespace, const FOnlinePartyData& InPartyData);
+	FOnlineAsyncTaskAccelByteUpdatePartyData(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InLocalUserId, const FOnlinePartyId& InPartyId, const FAccelBytePartyStorageDelta& InDelta, const FOnPartyStorageWriteComplete& InDelegate);
 
 	virtual void Initialize() override;
 	virtual void Finalize() override;
@@ -33,11 +34,11 @@ private:
 	/** ID of the party that we want to update data for */
 	TSharedRef<const FOnlinePartyIdAccelByte> PartyId;
 
-	/** Namespace that we are trying to update data on, this is ignored for now as party data is not namespaced */
-	FName Namespace;
+	/** Changes that we wish to write to party storage */
+	FAccelBytePartyStorageDelta Delta;
 
-	/** Data that we wish to use to update the party */
-	TSharedRef<FOnlinePartyData> PartyData;
+	/** Delegate to tell the coalescer that sent this write whether it succeeded */
+	FOnPartyStorageWriteComplete Delegate;
 
 	/** Delegate handler for when the request to update party storage was a success */
 	void OnWritePartyStorageSuccess(const FAccelByteModelsPartyDataNotif& Result);
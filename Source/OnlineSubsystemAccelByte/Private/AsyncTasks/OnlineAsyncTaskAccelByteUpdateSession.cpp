@@ -0,0 +1,115 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineAsyncTaskAccelByteUpdateSession.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSessionInterfaceAccelByte.h"
+#include "Api/AccelByteSessionBrowserApi.h"
+
+FOnlineAsyncTaskAccelByteUpdateSession::FOnlineAsyncTaskAccelByteUpdateSession(FOnlineSubsystemAccelByte* const InABInterface, int32 InLocalUserNum, const FName& InSessionName, const FString& InSessionId, const FOnlineSessionSettings& InSettingsToAdvertise, bool bInUpdatePlayerCounts, int32 InCurrentPlayerCount, const TSharedPtr<FJsonObject>& InChangedSettings)
+	: FOnlineAsyncTaskAccelByte(InABInterface)
+	, SessionName(InSessionName)
+	, SessionId(InSessionId)
+	, SettingsToAdvertise(InSettingsToAdvertise)
+	, bUpdatePlayerCounts(bInUpdatePlayerCounts)
+	, CurrentPlayerCount(InCurrentPlayerCount)
+	, ChangedSettings(InChangedSettings)
+{
+	LocalUserNum = InLocalUserNum;
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::Initialize()
+{
+	Super::Initialize();
+
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionName: %s; SessionId: %s; bUpdatePlayerCounts: %s; ChangedSettingCount: %d"), *SessionName.ToString(), *SessionId, LOG_BOOL_FORMAT(bUpdatePlayerCounts), ChangedSettings.IsValid() ? ChangedSettings->Values.Num() : 0);
+
+	if (SessionId.IsEmpty())
+	{
+		CompleteTask(EAccelByteAsyncTaskCompleteState::InvalidState);
+		AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Cannot update session '%s' as it has not been created in the session browser yet!"), *SessionName.ToString());
+		return;
+	}
+
+	// Player counts and settings are separate endpoints, send them one after the other so that a failure of the first
+	// leaves the advertised state untouched
+	if (bUpdatePlayerCounts)
+	{
+		const THandler<FAccelByteModelsSessionBrowserData> OnUpdatePlayerCountsSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsSessionBrowserData>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteUpdateSession::OnUpdatePlayerCountsSuccess);
+		const FErrorHandler OnUpdateSessionErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteUpdateSession::OnUpdateSessionError);
+		ApiClient->SessionBrowser.UpdateGameSession(SessionId, SettingsToAdvertise.NumPublicConnections, CurrentPlayerCount, OnUpdatePlayerCountsSuccessDelegate, OnUpdateSessionErrorDelegate);
+	}
+	else
+	{
+		SendChangedSettings();
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Sent request to update session in the session browser."));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::Finalize()
+{
+	Super::Finalize();
+
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+
+	const FOnlineSessionAccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionAccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->OnSessionUpdateRequestComplete(SessionName, bWasSuccessful, SettingsToAdvertise, CurrentPlayerCount);
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::TriggerDelegates()
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
+
+	const IOnlineSessionPtr SessionInterface = Subsystem->GetSessionInterface();
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, bWasSuccessful);
+	}
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::SendChangedSettings()
+{
+	if (!ChangedSettings.IsValid() || ChangedSettings->Values.Num() <= 0)
+	{
+		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		return;
+	}
+
+	const THandler<FAccelByteModelsSessionBrowserData> OnUpdateSettingsSuccessDelegate = TDelegateUtils<THandler<FAccelByteModelsSessionBrowserData>>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteUpdateSession::OnUpdateSettingsSuccess);
+	const FErrorHandler OnUpdateSessionErrorDelegate = TDelegateUtils<FErrorHandler>::CreateThreadSafeSelfPtr(this, &FOnlineAsyncTaskAccelByteUpdateSession::OnUpdateSessionError);
+	ApiClient->SessionBrowser.UpdateGameSettings(SessionId, ChangedSettings, OnUpdateSettingsSuccessDelegate, OnUpdateSessionErrorDelegate);
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::OnUpdatePlayerCountsSuccess(const FAccelByteModelsSessionBrowserData& Result)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionId: %s"), *Result.Session_id);
+
+	SetLastUpdateTimeToCurrentTime();
+	SendChangedSettings();
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::OnUpdateSettingsSuccess(const FAccelByteModelsSessionBrowserData& Result)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionId: %s"), *Result.Session_id);
+
+	CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateSession::OnUpdateSessionError(int32 ErrorCode, const FString& ErrorMessage)
+{
+	UE_LOG_AB(Warning, TEXT("Failed to update session '%s' in the session browser! Error code: %d; Error message: %s"), *SessionName.ToString(), ErrorCode, *ErrorMessage);
+	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "OnlineAsyncTaskAccelByte.h"
+#include "OnlineAsyncTaskAccelByteUtils.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "OnlineSessionSettings.h"
+#include "Models/AccelByteSessionBrowserModels.h"
+
+/**
+ * Task to push the changes made to a P2P session's settings to the session browser. Only the fields that differ from
+ * what was last advertised are sent, the diff itself is computed by the session interface before this task is created.
+ */
+class FOnlineAsyncTaskAccelByteUpdateSession : public FOnlineAsyncTaskAccelByte, public TSelfPtr<FOnlineAsyncTaskAccelByteUpdateSession, ESPMode::ThreadSafe>
+{
+public:
+
+	FOnlineAsyncTaskAccelByteUpdateSession(FOnlineSubsystemAccelByte* const InABInterface, int32 InLocalUserNum, const FName& InSessionName, const FString& InSessionId, const FOnlineSessionSettings& InSettingsToAdvertise, bool bInUpdatePlayerCounts, int32 InCurrentPlayerCount, const TSharedPtr<FJsonObject>& InChangedSettings);
+
+	virtual void Initialize() override;
+	virtual void Finalize() override;
+	virtual void TriggerDelegates() override;
+
+protected:
+
+	virtual const FString GetTaskName() const override
+	{
+		return TEXT("FOnlineAsyncTaskAccelByteUpdateSession");
+	}
+
+private:
+
+	/** Name of the local session that we are updating */
+	FName SessionName;
+
+	/** ID of the session in the session browser */
+	FString SessionId;
+
+	/** Full copy of the settings that will be advertised once this update succeeds, used as the base for the next diff */
+	FOnlineSessionSettings SettingsToAdvertise;
+
+	/** Whether the max player count has changed and needs to be sent */
+	bool bUpdatePlayerCounts = false;
+
+	/** Number of players currently registered to the session */
+	int32 CurrentPlayerCount = 0;
+
+	/** Settings that were added or changed since the last advertised state, nullptr if no settings changed */
+	TSharedPtr<FJsonObject> ChangedSettings;
+
+	/** Send the changed settings to the session browser, or complete the task if there are none */
+	void SendChangedSettings();
+
+	/**
+	 * Delegate handler for when updating the player counts of the session succeeds
+	 */
+	void OnUpdatePlayerCountsSuccess(const FAccelByteModelsSessionBrowserData& Result);
+
+	/**
+	 * Delegate handler for when updating the settings of the session succeeds
+	 */
+	void OnUpdateSettingsSuccess(const FAccelByteModelsSessionBrowserData& Result);
+
+	/**
+	 * Delegate handler for when either update request fails
+	 */
+	void OnUpdateSessionError(int32 ErrorCode, const FString& ErrorMessage);
+
+};
@@ -0,0 +1,99 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestSessionPing.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemAccelByteDefines.h"
+#include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "OnlineSessionPingManagerAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+FExecTestSessionPing::FExecTestSessionPing(UWorld* InWorld, const FName& InSubsystemName, int32 InPort)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Port(InPort)
+{
+}
+
+bool FExecTestSessionPing::Run()
+{
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(Online::GetSubsystem(World, SubsystemName));
+	PingManager = (Subsystem != nullptr) ? Subsystem->GetSessionPingManager() : nullptr;
+	if (!PingManager.IsValid() || Port <= 0)
+	{
+		UE_LOG_AB(Error, TEXT("FExecTestSessionPing could not get a session ping manager to test, or was given an invalid port!"));
+		bIsComplete = true;
+		return false;
+	}
+
+	if (PingManager->GetPingResponderPort() != Port)
+	{
+		if (!PingManager->StartPingResponder(Port))
+		{
+			UE_LOG_AB(Error, TEXT("FExecTestSessionPing failed to start the ping responder on port %d!"), Port);
+			bIsComplete = true;
+			return false;
+		}
+		bStartedResponder = true;
+	}
+
+	// Replies are only read as the ping manager ticks, so the cases carry on from the completion delegates
+	PingManager->PingHost(MakeLoopbackAddr(Port), FOnHostPingComplete::CreateSP(AsShared(), &FExecTestSessionPing::OnEchoedPingComplete));
+	return true;
+}
+
+TSharedRef<FInternetAddr> FExecTestSessionPing::MakeLoopbackAddr(int32 InPort) const
+{
+	const TSharedRef<FInternetAddr> Addr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+	Addr->SetLoopbackAddress();
+	Addr->SetPort(InPort);
+	return Addr;
+}
+
+void FExecTestSessionPing::OnEchoedPingComplete(int32 PingInMs)
+{
+	int32 CachedPingInMs = INDEX_NONE;
+	const bool bIsCached = PingManager->GetCachedHostPing(*MakeLoopbackAddr(Port), CachedPingInMs);
+	if (PingInMs >= 0 && PingInMs < MAX_QUERY_PING && bIsCached && CachedPingInMs == PingInMs)
+	{
+		UE_LOG_AB(Log, TEXT("Successfully pinged the ping responder on port %d in %dms and cached the result!"), Port, PingInMs);
+	}
+	else
+	{
+		UE_LOG_AB(Error, TEXT("Ping to the ping responder failed on FExecTestSessionPing! PingInMs: %d; Cached: %s; CachedPingInMs: %d"), PingInMs, LOG_BOOL_FORMAT(bIsCached), CachedPingInMs);
+	}
+
+	PingManager->PingHost(MakeLoopbackAddr(Port + 1), FOnHostPingComplete::CreateSP(AsShared(), &FExecTestSessionPing::OnUnansweredPingComplete));
+}
+
+void FExecTestSessionPing::OnUnansweredPingComplete(int32 PingInMs)
+{
+	int32 CachedPingInMs = INDEX_NONE;
+	const bool bIsCached = PingManager->GetCachedHostPing(*MakeLoopbackAddr(Port + 1), CachedPingInMs);
+	if (PingInMs == MAX_QUERY_PING && !bIsCached)
+	{
+		UE_LOG_AB(Log, TEXT("Unanswered ping to port %d timed out without being cached as expected!"), Port + 1);
+	}
+	else
+	{
+		UE_LOG_AB(Error, TEXT("Unanswered ping was not reported as a timeout on FExecTestSessionPing! PingInMs: %d; Cached: %s; CachedPingInMs: %d"), PingInMs, LOG_BOOL_FORMAT(bIsCached), CachedPingInMs);
+	}
+
+	Finish();
+}
+
+void FExecTestSessionPing::Finish()
+{
+	if (bStartedResponder)
+	{
+		PingManager->StopPingResponder();
+	}
+
+	bIsComplete = true;
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FOnlineSessionPingManagerAccelByte;
+class FInternetAddr;
+
+/**
+ * Test case for session host pings over loopback. Starts the ping responder on a port, pings it through
+ * FOnlineSessionPingManagerAccelByte::PingHost and checks that the echo is measured and cached. Then pings a port that
+ * nothing answers on and checks that the timeout is reported as MAX_QUERY_PING without being cached.
+ *
+ * Console command for running is as follows, with the port defaulting to 17778 and the next port used for the
+ * unanswered ping:
+ * ONLINE TEST SESSIONPING <Port>
+ */
+class FExecTestSessionPing : public FExecTestBase, public TSharedFromThis<FExecTestSessionPing>
+{
+public:
+
+	FExecTestSessionPing(UWorld* InWorld, const FName& InSubsystemName, int32 InPort);
+
+	virtual bool Run() override;
+
+private:
+
+	/** Port the responder is started on, the port after it is pinged with nothing listening */
+	int32 Port = 0;
+
+	/** Ping manager of the subsystem under test */
+	TSharedPtr<FOnlineSessionPingManagerAccelByte, ESPMode::ThreadSafe> PingManager;
+
+	/** Whether this test started the responder, and so has to stop it again */
+	bool bStartedResponder = false;
+
+	/** Build a loopback address on a port */
+	TSharedRef<FInternetAddr> MakeLoopbackAddr(int32 InPort) const;
+
+	void OnEchoedPingComplete(int32 PingInMs);
+	void OnUnansweredPingComplete(int32 PingInMs);
+
+	/** Stop the responder if this test started it and mark the test complete */
+	void Finish();
+
+};
+
+#endif
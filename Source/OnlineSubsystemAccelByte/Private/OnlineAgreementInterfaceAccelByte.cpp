@@ -9,6 +9,28 @@
 #include "AsyncTasks/OnlineAsyncTaskAccelByteQueryEligibilities.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteGetLocalizedPolicyContent.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteAcceptAgreementPolicies.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#define POLICY_CONTENT_CACHE_FORMAT_VERSION 1
+#define POLICY_CONTENT_CACHE_FIELD_FORMAT_VERSION TEXT("formatVersion")
+#define POLICY_CONTENT_CACHE_FIELD_BASE_POLICY_ID TEXT("basePolicyId")
+#define POLICY_CONTENT_CACHE_FIELD_LOCALE_CODE TEXT("localeCode")
+#define POLICY_CONTENT_CACHE_FIELD_VERSION_KEY TEXT("versionKey")
+#define POLICY_CONTENT_CACHE_FIELD_CONTENT TEXT("content")
+
+FOnlineAgreementAccelByte::FOnlineAgreementAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
+	: AccelByteSubsystem(InSubsystem)
+{
+	if (AccelByteSubsystem->GetSettings().bEnablePolicyContentDiskCache)
+	{
+		LoadPolicyContentCacheFromDisk();
+	}
+}
 
 bool FOnlineAgreementAccelByte::QueryEligibleAgreements(int32 LocalUserNum, bool bNotAcceptedOnly, bool bAlwaysRequestToService)
 {
@@ -102,14 +124,22 @@ bool FOnlineAgreementAccelByte::GetLocalizedPolicyContent(int32 LocalUserNum, co
 
 bool FOnlineAgreementAccelByte::GetLocalizedPolicyContentFromCache(const FString& BasePolicyId, const FString& LocaleCode, FString& OutLocalizedPolicyContent)
 {
-	if (LocalizedContentMap.Contains(BasePolicyId))
+	FString VersionKey;
+	return GetLocalizedPolicyContentFromCache(BasePolicyId, LocaleCode, OutLocalizedPolicyContent, VersionKey);
+}
+
+bool FOnlineAgreementAccelByte::GetLocalizedPolicyContentFromCache(const FString& BasePolicyId, const FString& LocaleCode, FString& OutLocalizedPolicyContent, FString& OutVersionKey)
+{
+	FScopeLock ScopeLock(&LocalizedContentLock);
+	const TArray<FABLocalizedPolicyContent>* LocalizedContents = LocalizedContentMap.Find(BasePolicyId);
+	if (LocalizedContents != nullptr)
 	{
-		auto LocalizedContents = LocalizedContentMap.FindRef(BasePolicyId);
-		for (const auto& LocalizedContent : LocalizedContents)
+		for (const FABLocalizedPolicyContent& LocalizedContent : *LocalizedContents)
 		{
 			if (LocalizedContent.LocaleCode == LocaleCode)
 			{
 				OutLocalizedPolicyContent = LocalizedContent.Content;
+				OutVersionKey = LocalizedContent.VersionKey;
 				return true;
 			}
 		}
@@ -117,6 +147,197 @@ bool FOnlineAgreementAccelByte::GetLocalizedPolicyContentFromCache(const FString
 	return false;
 }
 
+FString FOnlineAgreementAccelByte::GetPolicyContentCacheDir() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("AccelByte") / TEXT("PolicyContentCache");
+}
+
+void FOnlineAgreementAccelByte::LoadPolicyContentCacheFromDisk()
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT(""));
+
+	const FString CacheDir = GetPolicyContentCacheDir();
+	TArray<FString> CacheFiles;
+	IFileManager::Get().FindFiles(CacheFiles, *(CacheDir / TEXT("*.json")), true, false);
+
+	FScopeLock ScopeLock(&LocalizedContentLock);
+	int32 NumLoaded = 0;
+	for (const FString& CacheFile : CacheFiles)
+	{
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *(CacheDir / CacheFile)))
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			UE_LOG_AB(Warning, TEXT("Ignoring unreadable policy content cache file '%s'"), *CacheFile);
+			continue;
+		}
+
+		// Entries written in an older format are dropped, they will be downloaded and written again on next use
+		int32 FormatVersion = 0;
+		if (!JsonObject->TryGetNumberField(POLICY_CONTENT_CACHE_FIELD_FORMAT_VERSION, FormatVersion) || FormatVersion != POLICY_CONTENT_CACHE_FORMAT_VERSION)
+		{
+			continue;
+		}
+
+		FABLocalizedPolicyContent LocalizedContent;
+		FString BasePolicyId;
+		if (!JsonObject->TryGetStringField(POLICY_CONTENT_CACHE_FIELD_BASE_POLICY_ID, BasePolicyId)
+			|| !JsonObject->TryGetStringField(POLICY_CONTENT_CACHE_FIELD_LOCALE_CODE, LocalizedContent.LocaleCode)
+			|| !JsonObject->TryGetStringField(POLICY_CONTENT_CACHE_FIELD_VERSION_KEY, LocalizedContent.VersionKey)
+			|| !JsonObject->TryGetStringField(POLICY_CONTENT_CACHE_FIELD_CONTENT, LocalizedContent.Content))
+		{
+			continue;
+		}
+
+		LocalizedContentMap.FindOrAdd(BasePolicyId).Emplace(MoveTemp(LocalizedContent));
+		NumLoaded++;
+	}
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Loaded %d localized policy contents from disk"), NumLoaded);
+}
+
+void FOnlineAgreementAccelByte::AddLocalizedPolicyContentToCache(const FString& BasePolicyId, const FString& LocaleCode, const FString& VersionKey, const FString& Content)
+{
+	{
+		FScopeLock ScopeLock(&LocalizedContentLock);
+		TArray<FABLocalizedPolicyContent>& LocalizedContents = LocalizedContentMap.FindOrAdd(BasePolicyId);
+		FABLocalizedPolicyContent* ExistingContent = LocalizedContents.FindByPredicate([&LocaleCode](const FABLocalizedPolicyContent& LocalizedContent) {
+			return LocalizedContent.LocaleCode == LocaleCode;
+		});
+		if (ExistingContent != nullptr)
+		{
+			ExistingContent->Content = Content;
+			ExistingContent->VersionKey = VersionKey;
+		}
+		else
+		{
+			LocalizedContents.Emplace(FABLocalizedPolicyContent{Content, LocaleCode, VersionKey});
+		}
+		PendingRevalidationContents.Remove(TPair<FString, FString>(BasePolicyId, LocaleCode));
+	}
+
+	if (!AccelByteSubsystem->GetSettings().bEnablePolicyContentDiskCache)
+	{
+		return;
+	}
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(POLICY_CONTENT_CACHE_FIELD_FORMAT_VERSION, POLICY_CONTENT_CACHE_FORMAT_VERSION);
+	JsonWriter->WriteValue(POLICY_CONTENT_CACHE_FIELD_BASE_POLICY_ID, BasePolicyId);
+	JsonWriter->WriteValue(POLICY_CONTENT_CACHE_FIELD_LOCALE_CODE, LocaleCode);
+	JsonWriter->WriteValue(POLICY_CONTENT_CACHE_FIELD_VERSION_KEY, VersionKey);
+	JsonWriter->WriteValue(POLICY_CONTENT_CACHE_FIELD_CONTENT, Content);
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+
+	const FString CacheFile = GetPolicyContentCacheDir() / FPaths::MakeValidFileName(FString::Printf(TEXT("%s_%s.json"), *BasePolicyId, *LocaleCode));
+	if (!FFileHelper::SaveStringToFile(JsonString, *CacheFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to persist localized policy content to '%s'"), *CacheFile);
+	}
+}
+
+void FOnlineAgreementAccelByte::MarkLocalizedPolicyContentForRevalidation(const FString& BasePolicyId, const FString& LocaleCode)
+{
+	FScopeLock ScopeLock(&LocalizedContentLock);
+	PendingRevalidationContents.Add(TPair<FString, FString>(BasePolicyId, LocaleCode));
+}
+
+void FOnlineAgreementAccelByte::RevalidateLocalizedPolicyContent(int32 LocalUserNum)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("LocalUserNum: %d"), LocalUserNum);
+
+	TArray<TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>> Eligibilities;
+	if (!GetEligibleAgreements(LocalUserNum, Eligibilities))
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("No eligibilities to revalidate against"));
+		return;
+	}
+
+	TArray<TPair<FString, FString>> ContentsToRefresh;
+	{
+		FScopeLock ScopeLock(&LocalizedContentLock);
+		for (const TPair<FString, FString>& PolicyAndLocale : PendingRevalidationContents)
+		{
+			const TArray<FABLocalizedPolicyContent>* LocalizedContents = LocalizedContentMap.Find(PolicyAndLocale.Key);
+			const FABLocalizedPolicyContent* CachedContent = LocalizedContents != nullptr
+				? LocalizedContents->FindByPredicate([&PolicyAndLocale](const FABLocalizedPolicyContent& LocalizedContent) { return LocalizedContent.LocaleCode == PolicyAndLocale.Value; })
+				: nullptr;
+
+			FString BaseUrl;
+			FString AttachmentLocation;
+			if (CachedContent != nullptr
+				&& FindLocalizedPolicyAttachment(Eligibilities, PolicyAndLocale.Key, PolicyAndLocale.Value, BaseUrl, AttachmentLocation)
+				&& CachedContent->VersionKey != AttachmentLocation)
+			{
+				ContentsToRefresh.Add(PolicyAndLocale);
+			}
+		}
+		PendingRevalidationContents.Reset();
+	}
+
+	// Only superseded documents are downloaded again, everything else was confirmed current by the eligibility query
+	for (const TPair<FString, FString>& PolicyAndLocale : ContentsToRefresh)
+	{
+		GetLocalizedPolicyContent(LocalUserNum, PolicyAndLocale.Key, PolicyAndLocale.Value, true);
+	}
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Refreshing %d superseded localized policy contents"), ContentsToRefresh.Num());
+}
+
+bool FOnlineAgreementAccelByte::FindLocalizedPolicyAttachment(const TArray<TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>>& Eligibilities, const FString& BasePolicyId, const FString& LocaleCode, FString& OutBaseUrl, FString& OutAttachmentLocation)
+{
+	for (const TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>& Eligibility : Eligibilities)
+	{
+		if (Eligibility->PolicyId != BasePolicyId || Eligibility->BaseUrls.Num() == 0)
+		{
+			continue;
+		}
+
+		for (const auto& Version : Eligibility->PolicyVersions)
+		{
+			if (!Version.IsInEffect)
+			{
+				continue;
+			}
+
+			FString DefaultPolicyLocation;
+			for (const auto& Localized : Version.LocalizedPolicyVersions)
+			{
+				if (Localized.LocaleCode == LocaleCode)
+				{
+					OutBaseUrl = Eligibility->BaseUrls[0];
+					OutAttachmentLocation = Localized.AttachmentLocation;
+					return true;
+				}
+				if (Localized.IsDefaultSelection)
+				{
+					DefaultPolicyLocation = Localized.AttachmentLocation;
+				}
+			}
+
+			if (DefaultPolicyLocation.IsEmpty())
+			{
+				return false;
+			}
+
+			OutBaseUrl = Eligibility->BaseUrls[0];
+			OutAttachmentLocation = DefaultPolicyLocation;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool FOnlineAgreementAccelByte::AcceptAgreementPolicies(int32 LocalUserNum, const TArray<FABAcceptAgreementPoliciesRequest>& DocumentsToAccept)
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Accept Agreement Policies, LocalUserNum: %d"), LocalUserNum);
@@ -152,4 +373,4 @@ bool FOnlineAgreementAccelByte::AcceptAgreementPolicies(int32 LocalUserNum, cons
 	TriggerOnAcceptAgreementPoliciesCompletedDelegates(LocalUserNum, false, ErrorStr);
 
 	return false;
-}
\ No newline at end of file
+}
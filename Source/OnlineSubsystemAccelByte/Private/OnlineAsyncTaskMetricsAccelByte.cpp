@@ -0,0 +1,192 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Trace/Trace.inl"
+
+#if ENGINE_MAJOR_VERSION >= 5
+namespace AccelByteTrace = UE::Trace;
+#else
+namespace AccelByteTrace = Trace;
+#endif
+
+UE_TRACE_CHANNEL_DEFINE(AccelByteAsyncTaskChannel);
+
+UE_TRACE_EVENT_BEGIN(AccelByteOSS, AsyncTaskBegin)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, TaskId)
+	UE_TRACE_EVENT_FIELD(AccelByteTrace::WideString, TaskName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(AccelByteOSS, AsyncTaskEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, TaskId)
+	UE_TRACE_EVENT_FIELD(uint8, CompleteState)
+UE_TRACE_EVENT_END()
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Async Tasks In Flight"), STAT_AccelByteAsyncTasksInFlight, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Async Tasks Succeeded"), STAT_AccelByteAsyncTasksSucceeded, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Async Tasks Timed Out"), STAT_AccelByteAsyncTasksTimedOut, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Async Tasks Failed"), STAT_AccelByteAsyncTasksFailed, STATGROUP_AccelByteOSS);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Async Task Queue Wait (ms)"), STAT_AccelByteAsyncTaskQueueWaitMs, STATGROUP_AccelByteOSS);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Async Task Working Time (ms)"), STAT_AccelByteAsyncTaskWorkingMs, STATGROUP_AccelByteOSS);
+
+TRACE_DECLARE_INT_COUNTER(AccelByteAsyncTasksInFlight, TEXT("AccelByteOSS/AsyncTasksInFlight"));
+TRACE_DECLARE_INT_COUNTER(AccelByteAsyncTasksFailed, TEXT("AccelByteOSS/AsyncTasksFailed"));
+TRACE_DECLARE_FLOAT_COUNTER(AccelByteAsyncTaskLatencyMs, TEXT("AccelByteOSS/AsyncTaskLatencyMs"));
+
+void FAccelByteLatencyHistogram::AddSample(double Seconds)
+{
+	// Two buckets per doubling, so the bucket index is log2 of the latency in milliseconds times two
+	const double Milliseconds = FMath::Max(Seconds * 1000.0, 1.0);
+	const int32 BucketIndex = FMath::Clamp(FMath::CeilToInt(FMath::Log2(Milliseconds) * 2.0), 0, NumBuckets - 1);
+	Buckets[BucketIndex]++;
+	SampleCount++;
+}
+
+double FAccelByteLatencyHistogram::GetPercentile(double Percentile) const
+{
+	if (SampleCount == 0)
+	{
+		return 0.0;
+	}
+
+	const uint32 TargetRank = FMath::Max(1u, static_cast<uint32>(FMath::CeilToDouble(Percentile * SampleCount)));
+	uint32 Rank = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; BucketIndex++)
+	{
+		Rank += Buckets[BucketIndex];
+		if (Rank >= TargetRank)
+		{
+			return GetBucketUpperBoundSeconds(BucketIndex);
+		}
+	}
+
+	return GetBucketUpperBoundSeconds(NumBuckets - 1);
+}
+
+double FAccelByteLatencyHistogram::GetBucketUpperBoundSeconds(int32 BucketIndex)
+{
+	return FMath::Pow(2.0, BucketIndex * 0.5) / 1000.0;
+}
+
+uint32 FOnlineAsyncTaskMetricsAccelByte::RecordTaskStarted(const FString& TaskName)
+{
+	// Skip zero on wrap around, as zero marks a task that was never reported as started
+	uint32 TaskTraceId = static_cast<uint32>(LastTaskTraceId.Increment());
+	if (TaskTraceId == 0)
+	{
+		TaskTraceId = static_cast<uint32>(LastTaskTraceId.Increment());
+	}
+
+	INC_DWORD_STAT(STAT_AccelByteAsyncTasksInFlight);
+	TRACE_COUNTER_INCREMENT(AccelByteAsyncTasksInFlight);
+
+	UE_TRACE_LOG(AccelByteOSS, AsyncTaskBegin, AccelByteAsyncTaskChannel)
+		<< AsyncTaskBegin.Cycle(FPlatformTime::Cycles64())
+		<< AsyncTaskBegin.TaskId(TaskTraceId)
+		<< AsyncTaskBegin.TaskName(*TaskName, TaskName.Len());
+
+	return TaskTraceId;
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordTaskReleased(uint32 TaskTraceId, bool bWasCompleted)
+{
+	DEC_DWORD_STAT(STAT_AccelByteAsyncTasksInFlight);
+	TRACE_COUNTER_DECREMENT(AccelByteAsyncTasksInFlight);
+
+	if (!bWasCompleted)
+	{
+		UE_TRACE_LOG(AccelByteOSS, AsyncTaskEnd, AccelByteAsyncTaskChannel)
+			<< AsyncTaskEnd.Cycle(FPlatformTime::Cycles64())
+			<< AsyncTaskEnd.TaskId(TaskTraceId)
+			<< AsyncTaskEnd.CompleteState(static_cast<uint8>(EAccelByteAsyncTaskCompleteState::Incomplete));
+	}
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordTaskCompleted(const FString& TaskName, uint32 TaskTraceId, uint8 CompleteState, double QueueWaitSeconds, double WorkingSeconds, double TotalSeconds)
+{
+	const EAccelByteAsyncTaskCompleteState TaskCompleteState = static_cast<EAccelByteAsyncTaskCompleteState>(CompleteState);
+
+	SET_FLOAT_STAT(STAT_AccelByteAsyncTaskQueueWaitMs, QueueWaitSeconds * 1000.0);
+	SET_FLOAT_STAT(STAT_AccelByteAsyncTaskWorkingMs, WorkingSeconds * 1000.0);
+	TRACE_COUNTER_SET(AccelByteAsyncTaskLatencyMs, TotalSeconds * 1000.0);
+
+	UE_TRACE_LOG(AccelByteOSS, AsyncTaskEnd, AccelByteAsyncTaskChannel)
+		<< AsyncTaskEnd.Cycle(FPlatformTime::Cycles64())
+		<< AsyncTaskEnd.TaskId(TaskTraceId)
+		<< AsyncTaskEnd.CompleteState(CompleteState);
+
+	FScopeLock ScopeLock(&MetricsLock);
+	FAccelByteAsyncTaskMetrics& Metrics = TaskNameToMetricsMap.FindOrAdd(TaskName);
+	Metrics.CompletedCount++;
+	Metrics.TotalQueueWaitSeconds += QueueWaitSeconds;
+	Metrics.TotalWorkingSeconds += WorkingSeconds;
+	Metrics.LatencyHistogram.AddSample(TotalSeconds);
+
+	switch (TaskCompleteState)
+	{
+	case EAccelByteAsyncTaskCompleteState::Success:
+		Metrics.SuccessCount++;
+		INC_DWORD_STAT(STAT_AccelByteAsyncTasksSucceeded);
+		break;
+	case EAccelByteAsyncTaskCompleteState::TimedOut:
+		Metrics.TimedOutCount++;
+		INC_DWORD_STAT(STAT_AccelByteAsyncTasksTimedOut);
+		break;
+	default:
+		Metrics.FailedCount++;
+		INC_DWORD_STAT(STAT_AccelByteAsyncTasksFailed);
+		TRACE_COUNTER_INCREMENT(AccelByteAsyncTasksFailed);
+		break;
+	}
+}
+
+TMap<FString, FAccelByteAsyncTaskMetrics> FOnlineAsyncTaskMetricsAccelByte::GetMetricsSnapshot() const
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	return TaskNameToMetricsMap;
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::DumpMetrics(FOutputDevice& Ar) const
+{
+	TArray<TPair<FString, FAccelByteAsyncTaskMetrics>> SortedMetrics;
+	{
+		FScopeLock ScopeLock(&MetricsLock);
+		SortedMetrics.Reserve(TaskNameToMetricsMap.Num());
+		for (const TPair<FString, FAccelByteAsyncTaskMetrics>& Pair : TaskNameToMetricsMap)
+		{
+			SortedMetrics.Emplace(Pair.Key, Pair.Value);
+		}
+	}
+
+	SortedMetrics.Sort([](const TPair<FString, FAccelByteAsyncTaskMetrics>& A, const TPair<FString, FAccelByteAsyncTaskMetrics>& B) {
+		return A.Value.LatencyHistogram.GetPercentile(0.95) > B.Value.LatencyHistogram.GetPercentile(0.95);
+	});
+
+	Ar.Logf(TEXT("%-60s %8s %8s %8s %8s %12s %12s %10s %10s %10s"), TEXT("Task"), TEXT("Count"), TEXT("Success"), TEXT("Timeout"), TEXT("Failed"), TEXT("AvgQueueMs"), TEXT("AvgWorkMs"), TEXT("P50Ms"), TEXT("P95Ms"), TEXT("P99Ms"));
+	for (const TPair<FString, FAccelByteAsyncTaskMetrics>& Pair : SortedMetrics)
+	{
+		const FAccelByteAsyncTaskMetrics& Metrics = Pair.Value;
+		const double Count = FMath::Max(Metrics.CompletedCount, 1u);
+		Ar.Logf(TEXT("%-60s %8u %8u %8u %8u %12.1f %12.1f %10.1f %10.1f %10.1f")
+			, *Pair.Key
+			, Metrics.CompletedCount
+			, Metrics.SuccessCount
+			, Metrics.TimedOutCount
+			, Metrics.FailedCount
+			, Metrics.TotalQueueWaitSeconds * 1000.0 / Count
+			, Metrics.TotalWorkingSeconds * 1000.0 / Count
+			, Metrics.LatencyHistogram.GetPercentile(0.50) * 1000.0
+			, Metrics.LatencyHistogram.GetPercentile(0.95) * 1000.0
+			, Metrics.LatencyHistogram.GetPercentile(0.99) * 1000.0);
+	}
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::ResetMetrics()
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	TaskNameToMetricsMap.Reset();
+}
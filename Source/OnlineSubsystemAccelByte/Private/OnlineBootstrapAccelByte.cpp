@@ -0,0 +1,642 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#include "OnlineBootstrapAccelByte.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineIdentityInterfaceAccelByte.h"
+#include "OnlineAgreementInterfaceAccelByte.h"
+#include "OnlineWalletInterfaceAccelByte.h"
+#include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "Interfaces/OnlineFriendsInterface.h"
+#include "Interfaces/OnlineEntitlementsInterface.h"
+#include "Interfaces/OnlinePartyInterface.h"
+#include "Interfaces/OnlinePresenceInterface.h"
+
+const TCHAR* LexToString(EAccelByteBootstrapStage Stage)
+{
+	switch (Stage)
+	{
+	case EAccelByteBootstrapStage::ConnectLobby: return TEXT("ConnectLobby");
+	case EAccelByteBootstrapStage::ReadFriendsList: return TEXT("ReadFriendsList");
+	case EAccelByteBootstrapStage::QueryBlockedPlayers: return TEXT("QueryBlockedPlayers");
+	case EAccelByteBootstrapStage::QueryEntitlements: return TEXT("QueryEntitlements");
+	case EAccelByteBootstrapStage::QueryWallet: return TEXT("QueryWallet");
+	case EAccelByteBootstrapStage::QueryEligibilities: return TEXT("QueryEligibilities");
+	case EAccelByteBootstrapStage::RestoreParties: return TEXT("RestoreParties");
+	case EAccelByteBootstrapStage::QueryPresence: return TEXT("QueryPresence");
+	default: return TEXT("Unknown");
+	}
+}
+
+const TArray<EAccelByteBootstrapStage>& FOnlineBootstrapAccelByte::GetStageDependencies(EAccelByteBootstrapStage Stage)
+{
+	static const TArray<EAccelByteBootstrapStage> NoDependencies;
+	static const TArray<EAccelByteBootstrapStage> LobbyDependencies{ EAccelByteBootstrapStage::ConnectLobby };
+
+	switch (Stage)
+	{
+	case EAccelByteBootstrapStage::ReadFriendsList:
+	case EAccelByteBootstrapStage::QueryBlockedPlayers:
+	case EAccelByteBootstrapStage::RestoreParties:
+	case EAccelByteBootstrapStage::QueryPresence:
+		return LobbyDependencies;
+	default:
+		return NoDependencies;
+	}
+}
+
+bool FOnlineBootstrapAccelByte::StartPostLoginBootstrap(int32 LocalUserNum)
+{
+	TArray<EAccelByteBootstrapStage> Stages;
+	for (uint8 StageIndex = 0; StageIndex < static_cast<uint8>(EAccelByteBootstrapStage::Count); StageIndex++)
+	{
+		Stages.Add(static_cast<EAccelByteBootstrapStage>(StageIndex));
+	}
+	return StartPostLoginBootstrap(LocalUserNum, Stages);
+}
+
+bool FOnlineBootstrapAccelByte::StartPostLoginBootstrap(int32 LocalUserNum, const TArray<EAccelByteBootstrapStage>& Stages)
+{
+	return StartPostLoginBootstrap(LocalUserNum, Stages, FOnPostLoginBootstrapRunComplete());
+}
+
+bool FOnlineBootstrapAccelByte::StartPostLoginBootstrap(int32 LocalUserNum, const TArray<EAccelByteBootstrapStage>& Stages, const FOnPostLoginBootstrapRunComplete& Delegate)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("LocalUserNum: %d, StageCount: %d"), LocalUserNum, Stages.Num());
+
+	if (RunningBootstraps.Contains(LocalUserNum))
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Bootstrap already in progress for user index '%d'!"), LocalUserNum);
+		return false;
+	}
+
+	// Resolve the user once here, every stage is started with the same user rather than looking it up again
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (!IdentityInterface.IsValid() || IdentityInterface->GetLoginStatus(LocalUserNum) != ELoginStatus::LoggedIn)
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("User not logged in at user index '%d'!"), LocalUserNum);
+		Delegate.ExecuteIfBound(false, FAccelByteBootstrapResult{});
+		TriggerOnPostLoginBootstrapCompleteDelegates(LocalUserNum, false, FAccelByteBootstrapResult{});
+		return false;
+	}
+
+	const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+	if (!UserIdPtr.IsValid())
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("UserId is not valid at user index '%d'!"), LocalUserNum);
+		Delegate.ExecuteIfBound(false, FAccelByteBootstrapResult{});
+		TriggerOnPostLoginBootstrapCompleteDelegates(LocalUserNum, false, FAccelByteBootstrapResult{});
+		return false;
+	}
+
+	TSharedRef<FBootstrapRun> Run = MakeShared<FBootstrapRun>();
+	Run->RunId = NextRunId++;
+	Run->LocalUserNum = LocalUserNum;
+	Run->UserId = StaticCastSharedPtr<const FUniqueNetIdAccelByteUser>(UserIdPtr);
+	Run->StartTimeSeconds = FPlatformTime::Seconds();
+	Run->Delegate = Delegate;
+
+	for (const EAccelByteBootstrapStage Stage : Stages)
+	{
+		if (Stage == EAccelByteBootstrapStage::Count)
+		{
+			continue;
+		}
+
+		Run->Stages[static_cast<uint8>(Stage)].bIsRequested = true;
+		for (const EAccelByteBootstrapStage Dependency : GetStageDependencies(Stage))
+		{
+			Run->Stages[static_cast<uint8>(Dependency)].bIsRequested = true;
+		}
+	}
+
+	for (uint8 StageIndex = 0; StageIndex < static_cast<uint8>(EAccelByteBootstrapStage::Count); StageIndex++)
+	{
+		Run->Stages[StageIndex].Result.Stage = static_cast<EAccelByteBootstrapStage>(StageIndex);
+	}
+
+	RunningBootstraps.Add(LocalUserNum, Run);
+	StartReadyStages(LocalUserNum);
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Started post login bootstrap for user index '%d'"), LocalUserNum);
+	return true;
+}
+
+bool FOnlineBootstrapAccelByte::IsBootstrapInProgress(int32 LocalUserNum) const
+{
+	return RunningBootstraps.Contains(LocalUserNum);
+}
+
+void FOnlineBootstrapAccelByte::Tick(double CurrentTimeSeconds)
+{
+	if (RunningBootstraps.Num() <= 0)
+	{
+		return;
+	}
+
+	const double StageTimeoutSeconds = AccelByteSubsystem->GetSettings().BootstrapStageTimeoutSeconds;
+	if (StageTimeoutSeconds <= 0.0)
+	{
+		return;
+	}
+
+	// Collect first, as completing a stage may start others or finish the run and remove it from the map
+	TArray<TPair<TSharedRef<FBootstrapRun>, EAccelByteBootstrapStage>> TimedOutStages;
+	for (const TPair<int32, TSharedRef<FBootstrapRun>>& RunPair : RunningBootstraps)
+	{
+		const TSharedRef<FBootstrapRun>& Run = RunPair.Value;
+		for (const FStageState& State : Run->Stages)
+		{
+			const double StageStartTimeSeconds = Run->StartTimeSeconds + State.Result.StartOffsetSeconds;
+			if (State.bIsStarted && !State.bIsComplete && CurrentTimeSeconds - StageStartTimeSeconds >= StageTimeoutSeconds)
+			{
+				TimedOutStages.Emplace(Run, State.Result.Stage);
+			}
+		}
+	}
+
+	for (const TPair<TSharedRef<FBootstrapRun>, EAccelByteBootstrapStage>& TimedOutStage : TimedOutStages)
+	{
+		const TSharedRef<FBootstrapRun>& Run = TimedOutStage.Key;
+		FStageState* State = FindPendingStage(Run->LocalUserNum, Run->RunId, TimedOutStage.Value);
+		if (State == nullptr)
+		{
+			continue;
+		}
+
+		UE_LOG_AB(Warning, TEXT("Bootstrap stage %s for user index '%d' timed out after %.1fs!"), LexToString(TimedOutStage.Value), Run->LocalUserNum, StageTimeoutSeconds);
+		ClearStageDelegate(Run->LocalUserNum, TimedOutStage.Value, *State);
+		CompleteStage(Run->LocalUserNum, Run->RunId, TimedOutStage.Value, false, TEXT("bootstrap-stage-timed-out"));
+	}
+}
+
+void FOnlineBootstrapAccelByte::CancelPostLoginBootstrap(int32 LocalUserNum)
+{
+	const TSharedRef<FBootstrapRun>* RunPtr = RunningBootstraps.Find(LocalUserNum);
+	if (RunPtr == nullptr)
+	{
+		return;
+	}
+
+	const TSharedRef<FBootstrapRun> Run = *RunPtr;
+	RunningBootstraps.Remove(LocalUserNum);
+
+	FAccelByteBootstrapResult Result;
+	for (FStageState& State : Run->Stages)
+	{
+		if (!State.bIsRequested)
+		{
+			continue;
+		}
+
+		if (State.bIsStarted && !State.bIsComplete)
+		{
+			ClearStageDelegate(LocalUserNum, State.Result.Stage, State);
+		}
+		if (!State.bIsComplete)
+		{
+			State.Result.ErrorStr = TEXT("bootstrap-cancelled");
+		}
+		Result.StageResults.Add(State.Result);
+	}
+	Result.TotalSeconds = FPlatformTime::Seconds() - Run->StartTimeSeconds;
+
+	UE_LOG_AB(Log, TEXT("Post login bootstrap for user index '%d' cancelled after %.3fs"), LocalUserNum, Result.TotalSeconds);
+	Run->Delegate.ExecuteIfBound(false, Result);
+	TriggerOnPostLoginBootstrapCompleteDelegates(LocalUserNum, false, Result);
+}
+
+void FOnlineBootstrapAccelByte::ClearStageDelegate(int32 LocalUserNum, EAccelByteBootstrapStage Stage, FStageState& State)
+{
+	if (!State.CompleteDelegateHandle.IsValid())
+	{
+		return;
+	}
+
+	switch (Stage)
+	{
+	case EAccelByteBootstrapStage::ConnectLobby:
+	{
+		const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
+		if (IdentityInterface.IsValid())
+		{
+			IdentityInterface->ClearOnConnectLobbyCompleteDelegate_Handle(LocalUserNum, State.CompleteDelegateHandle);
+		}
+		break;
+	}
+	case EAccelByteBootstrapStage::QueryBlockedPlayers:
+	{
+		const IOnlineFriendsPtr FriendsInterface = AccelByteSubsystem->GetFriendsInterface();
+		if (FriendsInterface.IsValid())
+		{
+			FriendsInterface->ClearOnQueryBlockedPlayersCompleteDelegate_Handle(State.CompleteDelegateHandle);
+		}
+		break;
+	}
+	case EAccelByteBootstrapStage::QueryEntitlements:
+	{
+		const IOnlineEntitlementsPtr EntitlementsInterface = AccelByteSubsystem->GetEntitlementsInterface();
+		if (EntitlementsInterface.IsValid())
+		{
+			EntitlementsInterface->ClearOnQueryEntitlementsCompleteDelegate_Handle(State.CompleteDelegateHandle);
+		}
+		break;
+	}
+	case EAccelByteBootstrapStage::QueryWallet:
+	{
+		// The handle is for whichever of the two wallet requests is in flight, clearing it from the other does nothing
+		const FOnlineWalletAccelBytePtr WalletInterface = AccelByteSubsystem->GetWalletInterface();
+		if (WalletInterface.IsValid())
+		{
+			WalletInterface->ClearOnGetCurrencyListCompletedDelegate_Handle(LocalUserNum, State.CompleteDelegateHandle);
+			WalletInterface->ClearOnGetWalletInfosCompletedDelegate_Handle(LocalUserNum, State.CompleteDelegateHandle);
+		}
+		break;
+	}
+	case EAccelByteBootstrapStage::QueryEligibilities:
+	{
+		const FOnlineAgreementAccelBytePtr AgreementInterface = AccelByteSubsystem->GetAgreementInterface();
+		if (AgreementInterface.IsValid())
+		{
+			AgreementInterface->ClearOnQueryEligibilitiesCompletedDelegate_Handle(LocalUserNum, State.CompleteDelegateHandle);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	State.CompleteDelegateHandle.Reset();
+}
+
+void FOnlineBootstrapAccelByte::StartReadyStages(int32 LocalUserNum)
+{
+	const TSharedRef<FBootstrapRun>* RunPtr = RunningBootstraps.Find(LocalUserNum);
+	if (RunPtr == nullptr)
+	{
+		return;
+	}
+
+	// Hold on to the run, a stage may complete synchronously and finish the bootstrap while we are iterating
+	const TSharedRef<FBootstrapRun> Run = *RunPtr;
+
+	bool bHasChanged = true;
+	while (bHasChanged)
+	{
+		bHasChanged = false;
+		for (uint8 StageIndex = 0; StageIndex < static_cast<uint8>(EAccelByteBootstrapStage::Count); StageIndex++)
+		{
+			FStageState& State = Run->Stages[StageIndex];
+			if (!State.bIsRequested || State.bIsStarted || State.bIsComplete)
+			{
+				continue;
+			}
+
+			bool bAreDependenciesDone = true;
+			bool bHasDependencyFailed = false;
+			for (const EAccelByteBootstrapStage Dependency : GetStageDependencies(static_cast<EAccelByteBootstrapStage>(StageIndex)))
+			{
+				const FStageState& DependencyState = Run->Stages[static_cast<uint8>(Dependency)];
+				bAreDependenciesDone &= DependencyState.bIsComplete;
+				bHasDependencyFailed |= DependencyState.bIsComplete && !DependencyState.Result.bWasSuccessful;
+			}
+
+			if (bHasDependencyFailed)
+			{
+				State.bIsComplete = true;
+				State.Result.bWasSkipped = true;
+				State.Result.ErrorStr = TEXT("bootstrap-stage-skipped-dependency-failed");
+				bHasChanged = true;
+			}
+			else if (bAreDependenciesDone)
+			{
+				State.bIsStarted = true;
+				State.Result.StartOffsetSeconds = FPlatformTime::Seconds() - Run->StartTimeSeconds;
+				StartStage(Run.Get(), static_cast<EAccelByteBootstrapStage>(StageIndex));
+				bHasChanged = true;
+			}
+		}
+	}
+
+	FinishBootstrapIfComplete(LocalUserNum);
+}
+
+void FOnlineBootstrapAccelByte::StartStage(FBootstrapRun& Run, EAccelByteBootstrapStage Stage)
+{
+	const int32 LocalUserNum = Run.LocalUserNum;
+	const uint32 RunId = Run.RunId;
+	const FUniqueNetIdAccelByteUser& UserId = Run.UserId.ToSharedRef().Get();
+	FStageState& State = Run.Stages[static_cast<uint8>(Stage)];
+
+	UE_LOG_AB(Verbose, TEXT("Starting bootstrap stage %s for user index '%d'"), LexToString(Stage), LocalUserNum);
+
+	switch (Stage)
+	{
+	case EAccelByteBootstrapStage::ConnectLobby:
+	{
+		const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
+		if (!IdentityInterface.IsValid())
+		{
+			break;
+		}
+
+		// Lobby may already have been connected by the auto connect setting, which is fine for the stages after this one
+		const TSharedPtr<FUserOnlineAccountAccelByte> UserAccount = StaticCastSharedPtr<FUserOnlineAccountAccelByte>(IdentityInterface->GetUserAccount(UserId));
+		if (UserAccount.IsValid() && UserAccount->IsConnectedToLobby())
+		{
+			CompleteStage(LocalUserNum, RunId, Stage, true, TEXT(""));
+			return;
+		}
+
+		State.CompleteDelegateHandle = IdentityInterface->AddOnConnectLobbyCompleteDelegate_Handle(LocalUserNum, FOnConnectLobbyCompleteDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnConnectLobbyComplete, RunId));
+		IdentityInterface->ConnectAccelByteLobby(LocalUserNum);
+		return;
+	}
+	case EAccelByteBootstrapStage::ReadFriendsList:
+	{
+		const IOnlineFriendsPtr FriendsInterface = AccelByteSubsystem->GetFriendsInterface();
+		if (!FriendsInterface.IsValid())
+		{
+			break;
+		}
+
+		FriendsInterface->ReadFriendsList(LocalUserNum, EFriendsLists::ToString(EFriendsLists::Default), FOnReadFriendsListComplete::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnReadFriendsListComplete, RunId));
+		return;
+	}
+	case EAccelByteBootstrapStage::QueryBlockedPlayers:
+	{
+		const IOnlineFriendsPtr FriendsInterface = AccelByteSubsystem->GetFriendsInterface();
+		if (!FriendsInterface.IsValid())
+		{
+			break;
+		}
+
+		State.CompleteDelegateHandle = FriendsInterface->AddOnQueryBlockedPlayersCompleteDelegate_Handle(FOnQueryBlockedPlayersCompleteDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnQueryBlockedPlayersComplete, LocalUserNum, RunId));
+		FriendsInterface->QueryBlockedPlayers(UserId);
+		return;
+	}
+	case EAccelByteBootstrapStage::QueryEntitlements:
+	{
+		const IOnlineEntitlementsPtr EntitlementsInterface = AccelByteSubsystem->GetEntitlementsInterface();
+		if (!EntitlementsInterface.IsValid())
+		{
+			break;
+		}
+
+		State.CompleteDelegateHandle = EntitlementsInterface->AddOnQueryEntitlementsCompleteDelegate_Handle(FOnQueryEntitlementsCompleteDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnQueryEntitlementsComplete, LocalUserNum, RunId));
+		EntitlementsInterface->QueryEntitlements(UserId, TEXT(""), FPagedQuery());
+		return;
+	}
+	case EAccelByteBootstrapStage::QueryWallet:
+	{
+		// Currencies are needed to know which balances to fetch, the balances are then fetched in one batched task
+		const FOnlineWalletAccelBytePtr WalletInterface = AccelByteSubsystem->GetWalletInterface();
+		if (!WalletInterface.IsValid())
+		{
+			break;
+		}
+
+		State.CompleteDelegateHandle = WalletInterface->AddOnGetCurrencyListCompletedDelegate_Handle(LocalUserNum, FOnGetCurrencyListCompletedDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnGetCurrencyListComplete, RunId));
+		WalletInterface->GetCurrencyList(LocalUserNum);
+		return;
+	}
+	case EAccelByteBootstrapStage::QueryEligibilities:
+	{
+		const FOnlineAgreementAccelBytePtr AgreementInterface = AccelByteSubsystem->GetAgreementInterface();
+		if (!AgreementInterface.IsValid())
+		{
+			break;
+		}
+
+		State.CompleteDelegateHandle = AgreementInterface->AddOnQueryEligibilitiesCompletedDelegate_Handle(LocalUserNum, FOnQueryEligibilitiesCompletedDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnQueryEligibilitiesComplete, RunId));
+		AgreementInterface->QueryEligibleAgreements(LocalUserNum);
+		return;
+	}
+	case EAccelByteBootstrapStage::RestoreParties:
+	{
+		const IOnlinePartyPtr PartyInterface = AccelByteSubsystem->GetPartyInterface();
+		if (!PartyInterface.IsValid())
+		{
+			break;
+		}
+
+		PartyInterface->RestoreParties(UserId, FOnRestorePartiesComplete::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnRestorePartiesComplete, LocalUserNum, RunId));
+		return;
+	}
+	case EAccelByteBootstrapStage::QueryPresence:
+	{
+		const IOnlinePresencePtr PresenceInterface = AccelByteSubsystem->GetPresenceInterface();
+		if (!PresenceInterface.IsValid())
+		{
+			break;
+		}
+
+		PresenceInterface->QueryPresence(UserId, IOnlinePresence::FOnPresenceTaskCompleteDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnQueryPresenceComplete, LocalUserNum, RunId));
+		return;
+	}
+	default:
+		break;
+	}
+
+	CompleteStage(LocalUserNum, RunId, Stage, false, TEXT("bootstrap-stage-failed-interface-invalid"));
+}
+
+void FOnlineBootstrapAccelByte::CompleteStage(int32 LocalUserNum, uint32 RunId, EAccelByteBootstrapStage Stage, bool bWasSuccessful, const FString& ErrorStr)
+{
+	const TSharedRef<FBootstrapRun>* RunPtr = RunningBootstraps.Find(LocalUserNum);
+	if (RunPtr == nullptr || (*RunPtr)->RunId != RunId)
+	{
+		return;
+	}
+
+	const TSharedRef<FBootstrapRun> Run = *RunPtr;
+	FStageState& State = Run->Stages[static_cast<uint8>(Stage)];
+	if (!State.bIsStarted || State.bIsComplete)
+	{
+		return;
+	}
+
+	State.bIsComplete = true;
+	State.Result.bWasSuccessful = bWasSuccessful;
+	State.Result.ErrorStr = ErrorStr;
+	State.Result.DurationSeconds = FPlatformTime::Seconds() - Run->StartTimeSeconds - State.Result.StartOffsetSeconds;
+
+	UE_LOG_AB(Log, TEXT("Bootstrap stage %s for user index '%d' completed in %.3fs, bWasSuccessful: %s"), LexToString(Stage), LocalUserNum, State.Result.DurationSeconds, LOG_BOOL_FORMAT(bWasSuccessful));
+
+	StartReadyStages(LocalUserNum);
+}
+
+void FOnlineBootstrapAccelByte::FinishBootstrapIfComplete(int32 LocalUserNum)
+{
+	const TSharedRef<FBootstrapRun>* RunPtr = RunningBootstraps.Find(LocalUserNum);
+	if (RunPtr == nullptr)
+	{
+		return;
+	}
+
+	const TSharedRef<FBootstrapRun> Run = *RunPtr;
+	FAccelByteBootstrapResult Result;
+	bool bWasSuccessful = true;
+	for (const FStageState& State : Run->Stages)
+	{
+		if (!State.bIsRequested)
+		{
+			continue;
+		}
+		if (!State.bIsComplete)
+		{
+			return;
+		}
+
+		bWasSuccessful &= State.Result.bWasSuccessful;
+		Result.StageResults.Add(State.Result);
+	}
+
+	Result.TotalSeconds = FPlatformTime::Seconds() - Run->StartTimeSeconds;
+	RunningBootstraps.Remove(LocalUserNum);
+
+	UE_LOG_AB(Log, TEXT("Post login bootstrap for user index '%d' completed in %.3fs, bWasSuccessful: %s"), LocalUserNum, Result.TotalSeconds, LOG_BOOL_FORMAT(bWasSuccessful));
+	Run->Delegate.ExecuteIfBound(bWasSuccessful, Result);
+	TriggerOnPostLoginBootstrapCompleteDelegates(LocalUserNum, bWasSuccessful, Result);
+}
+
+FOnlineBootstrapAccelByte::FStageState* FOnlineBootstrapAccelByte::FindPendingStage(int32 LocalUserNum, uint32 RunId, EAccelByteBootstrapStage Stage)
+{
+	const TSharedRef<FBootstrapRun>* RunPtr = RunningBootstraps.Find(LocalUserNum);
+	if (RunPtr == nullptr || (*RunPtr)->RunId != RunId)
+	{
+		return nullptr;
+	}
+
+	FStageState& State = (*RunPtr)->Stages[static_cast<uint8>(Stage)];
+	return (State.bIsStarted && !State.bIsComplete) ? &State : nullptr;
+}
+
+void FOnlineBootstrapAccelByte::OnConnectLobbyComplete(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error, uint32 RunId)
+{
+	FStageState* State = FindPendingStage(LocalUserNum, RunId, EAccelByteBootstrapStage::ConnectLobby);
+	if (State == nullptr)
+	{
+		return;
+	}
+
+	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
+	if (IdentityInterface.IsValid())
+	{
+		IdentityInterface->ClearOnConnectLobbyCompleteDelegate_Handle(LocalUserNum, State->CompleteDelegateHandle);
+	}
+
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::ConnectLobby, bWasSuccessful, Error);
+}
+
+void FOnlineBootstrapAccelByte::OnReadFriendsListComplete(int32 LocalUserNum, bool bWasSuccessful, const FString& ListName, const FString& ErrorStr, uint32 RunId)
+{
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::ReadFriendsList, bWasSuccessful, ErrorStr);
+}
+
+void FOnlineBootstrapAccelByte::OnQueryBlockedPlayersComplete(const FUniqueNetId& UserId, bool bWasSuccessful, const FString& Error, int32 LocalUserNum, uint32 RunId)
+{
+	// This delegate is not per player, so make sure that this completion is for the user we are bootstrapping
+	FStageState* State = FindPendingStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryBlockedPlayers);
+	if (State == nullptr || *RunningBootstraps[LocalUserNum]->UserId != UserId)
+	{
+		return;
+	}
+
+	const IOnlineFriendsPtr FriendsInterface = AccelByteSubsystem->GetFriendsInterface();
+	if (FriendsInterface.IsValid())
+	{
+		FriendsInterface->ClearOnQueryBlockedPlayersCompleteDelegate_Handle(State->CompleteDelegateHandle);
+	}
+
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryBlockedPlayers, bWasSuccessful, Error);
+}
+
+void FOnlineBootstrapAccelByte::OnQueryEntitlementsComplete(bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Namespace, const FString& Error, int32 LocalUserNum, uint32 RunId)
+{
+	// This delegate is not per player, so make sure that this completion is for the user we are bootstrapping
+	FStageState* State = FindPendingStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryEntitlements);
+	if (State == nullptr || *RunningBootstraps[LocalUserNum]->UserId != UserId)
+	{
+		return;
+	}
+
+	const IOnlineEntitlementsPtr EntitlementsInterface = AccelByteSubsystem->GetEntitlementsInterface();
+	if (EntitlementsInterface.IsValid())
+	{
+		EntitlementsInterface->ClearOnQueryEntitlementsCompleteDelegate_Handle(State->CompleteDelegateHandle);
+	}
+
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryEntitlements, bWasSuccessful, Error);
+}
+
+void FOnlineBootstrapAccelByte::OnGetCurrencyListComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FAccelByteModelsCurrencyList>& Response, const FString& Error, uint32 RunId)
+{
+	FStageState* State = FindPendingStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryWallet);
+	const FOnlineWalletAccelBytePtr WalletInterface = AccelByteSubsystem->GetWalletInterface();
+	if (State == nullptr || !WalletInterface.IsValid())
+	{
+		return;
+	}
+
+	WalletInterface->ClearOnGetCurrencyListCompletedDelegate_Handle(LocalUserNum, State->CompleteDelegateHandle);
+	if (!bWasSuccessful || Response.Num() == 0)
+	{
+		CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryWallet, bWasSuccessful, Error);
+		return;
+	}
+
+	TArray<FString> CurrencyCodes;
+	CurrencyCodes.Reserve(Response.Num());
+	for (const FAccelByteModelsCurrencyList& Currency : Response)
+	{
+		CurrencyCodes.Add(Currency.CurrencyCode);
+	}
+
+	State->CompleteDelegateHandle = WalletInterface->AddOnGetWalletInfosCompletedDelegate_Handle(LocalUserNum, FOnGetWalletInfosCompletedDelegate::CreateThreadSafeSP(AsShared(), &FOnlineBootstrapAccelByte::OnGetWalletInfosComplete, RunId));
+	WalletInterface->GetWalletInfoByCurrencyCodes(LocalUserNum, CurrencyCodes);
+}
+
+void FOnlineBootstrapAccelByte::OnGetWalletInfosComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FAccelByteModelsWalletInfo>& Response, const FString& Error, uint32 RunId)
+{
+	FStageState* State = FindPendingStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryWallet);
+	if (State == nullptr)
+	{
+		return;
+	}
+
+	const FOnlineWalletAccelBytePtr WalletInterface = AccelByteSubsystem->GetWalletInterface();
+	if (WalletInterface.IsValid())
+	{
+		WalletInterface->ClearOnGetWalletInfosCompletedDelegate_Handle(LocalUserNum, State->CompleteDelegateHandle);
+	}
+
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryWallet, bWasSuccessful, Error);
+}
+
+void FOnlineBootstrapAccelByte::OnQueryEligibilitiesComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FAccelByteModelsRetrieveUserEligibilitiesResponse>& Response, const FString& Error, uint32 RunId)
+{
+	FStageState* State = FindPendingStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryEligibilities);
+	if (State == nullptr)
+	{
+		return;
+	}
+
+	const FOnlineAgreementAccelBytePtr AgreementInterface = AccelByteSubsystem->GetAgreementInterface();
+	if (AgreementInterface.IsValid())
+	{
+		AgreementInterface->ClearOnQueryEligibilitiesCompletedDelegate_Handle(LocalUserNum, State->CompleteDelegateHandle);
+	}
+
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryEligibilities, bWasSuccessful, Error);
+}
+
+void FOnlineBootstrapAccelByte::OnRestorePartiesComplete(const FUniqueNetId& LocalUserId, const FOnlineError& Result, int32 LocalUserNum, uint32 RunId)
+{
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::RestoreParties, Result.bSucceeded, Result.GetErrorCode());
+}
+
+void FOnlineBootstrapAccelByte::OnQueryPresenceComplete(const FUniqueNetId& UserId, const bool bWasSuccessful, int32 LocalUserNum, uint32 RunId)
+{
+	CompleteStage(LocalUserNum, RunId, EAccelByteBootstrapStage::QueryPresence, bWasSuccessful, bWasSuccessful ? TEXT("") : TEXT("bootstrap-query-presence-failed"));
+}
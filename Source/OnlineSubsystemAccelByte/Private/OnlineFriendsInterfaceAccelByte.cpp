@@ -16,6 +16,7 @@
 #include "Core/AccelByteMultiRegistry.h"
 #include "Api/AccelByteLobbyApi.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteGetRecentPlayer.h"
+#include "OnlineNotificationDispatcherAccelByte.h"
 
 #define ONLINE_ERROR_NAMESPACE "FOnlineFriendAccelByte"
 
@@ -298,21 +299,24 @@ void FOnlineFriendsAccelByte::RegisterRealTimeLobbyDelegates(int32 LocalUserNum)
 		return;
 	}
 
+	// Friend notifications are handled from the notification queue, same as party notifications
+	const FOnlineNotificationDispatcherAccelBytePtr NotificationDispatcher = AccelByteSubsystem->GetNotificationDispatcher();
+
 	// Set each delegate for the corresponding API client to be a new realtime delegate
 	AccelByte::Api::Lobby::FAcceptFriendsNotif OnFriendRequestAcceptedNotificationReceivedDelegate = AccelByte::Api::Lobby::FAcceptFriendsNotif::CreateThreadSafeSP(AsShared(), &FOnlineFriendsAccelByte::OnFriendRequestAcceptedNotificationReceived, LocalUserNum);
-	ApiClient->Lobby.SetOnFriendRequestAcceptedNotifDelegate(OnFriendRequestAcceptedNotificationReceivedDelegate);
+	ApiClient->Lobby.SetOnFriendRequestAcceptedNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("FriendRequestAccepted"), LocalUserNum, OnFriendRequestAcceptedNotificationReceivedDelegate));
 
 	AccelByte::Api::Lobby::FRequestFriendsNotif OnFriendRequestReceivedNotificationReceivedDelegate = AccelByte::Api::Lobby::FRequestFriendsNotif::CreateThreadSafeSP(AsShared(), &FOnlineFriendsAccelByte::OnFriendRequestReceivedNotificationReceived, LocalUserNum);
-	ApiClient->Lobby.SetOnIncomingRequestFriendsNotifDelegate(OnFriendRequestReceivedNotificationReceivedDelegate);
+	ApiClient->Lobby.SetOnIncomingRequestFriendsNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("FriendRequestReceived"), LocalUserNum, OnFriendRequestReceivedNotificationReceivedDelegate));
 
 	AccelByte::Api::Lobby::FUnfriendNotif OnUnfriendNotificationReceivedDelegate = AccelByte::Api::Lobby::FUnfriendNotif::CreateThreadSafeSP(AsShared(), &FOnlineFriendsAccelByte::OnUnfriendNotificationReceived, LocalUserNum);
-	ApiClient->Lobby.SetOnUnfriendNotifDelegate(OnUnfriendNotificationReceivedDelegate);
+	ApiClient->Lobby.SetOnUnfriendNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("Unfriend"), LocalUserNum, OnUnfriendNotificationReceivedDelegate));
 
 	AccelByte::Api::Lobby::FRejectFriendsNotif OnRejectFriendRequestNotificationReceivedDelegate = AccelByte::Api::Lobby::FRejectFriendsNotif::CreateThreadSafeSP(AsShared(), &FOnlineFriendsAccelByte::OnRejectFriendRequestNotificationReceived, LocalUserNum);
-	ApiClient->Lobby.SetOnRejectFriendsNotifDelegate(OnRejectFriendRequestNotificationReceivedDelegate);
+	ApiClient->Lobby.SetOnRejectFriendsNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("FriendRequestRejected"), LocalUserNum, OnRejectFriendRequestNotificationReceivedDelegate));
 
 	AccelByte::Api::Lobby::FCancelFriendsNotif OnCancelFriendRequestNotificationReceivedDelegate = AccelByte::Api::Lobby::FCancelFriendsNotif::CreateThreadSafeSP(AsShared(), &FOnlineFriendsAccelByte::OnCancelFriendRequestNotificationReceived, LocalUserNum);
-	ApiClient->Lobby.SetOnCancelFriendsNotifDelegate(OnCancelFriendRequestNotificationReceivedDelegate);
+	ApiClient->Lobby.SetOnCancelFriendsNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("FriendRequestCancelled"), LocalUserNum, OnCancelFriendRequestNotificationReceivedDelegate));
 }
 
 void FOnlineFriendsAccelByte::AddFriendsToList(int32 LocalUserNum, const TArray<TSharedPtr<FOnlineFriend>>& NewFriends)
@@ -215,6 +215,14 @@ TSharedPtr<const FUniqueNetId> FOnlineIdentityAccelByte::CreateUniquePlayerId(ui
 {
 	if (Bytes && Size > 0)
 	{
+		// IDs written with AppendBinary start with the binary version byte, which can never be the first byte of a TCHAR
+		// string of a Base64 or AccelByte ID, so read those directly instead of going through the string decode
+		if (Bytes[0] == ACCELBYTE_BINARY_ID_VERSION)
+		{
+			int32 BytesRead = 0;
+			return FUniqueNetIdAccelByteUser::CreateFromBinary(Bytes, Size, BytesRead);
+		}
+
 		FString StrId(Size, (TCHAR*)Bytes);
 		return CreateUniquePlayerId(StrId);
 	}
@@ -224,15 +232,16 @@ TSharedPtr<const FUniqueNetId> FOnlineIdentityAccelByte::CreateUniquePlayerId(ui
 
 TSharedPtr<const FUniqueNetId> FOnlineIdentityAccelByte::CreateUniquePlayerId(const FString& Str)
 {
-	// Check if this is a Base64 encoded string, meaning that it _most likely_ is a full composite ID. If it is, just pass
-	// the string straight to MakeShared, as it will decode the components for you. Otherwise, treat it as just the AccelByte ID.
+	// Check if this is a Base64 encoded string, meaning that it _most likely_ is a full composite ID. If it is, pass the
+	// string to CreateFromEncodedString, which decodes the components or reuses an ID already decoded from the same string.
+	// Otherwise, treat it as just the AccelByte ID.
 	FString DecodedString;
 	if (!FBase64::Decode(Str, DecodedString))
 	{
 		return FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(Str));
 	}
 
-	return MakeShared<FUniqueNetIdAccelByteUser>(Str);
+	return FUniqueNetIdAccelByteUser::CreateFromEncodedString(Str);
 }
 
 ELoginStatus::Type FOnlineIdentityAccelByte::GetLoginStatus(int32 LocalUserNum) const
@@ -0,0 +1,260 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#include "OnlineNotificationDispatcherAccelByte.h"
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "Async/Async.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Lobby Notifications Queued"), STAT_AccelByteLobbyNotificationsQueued, STATGROUP_AccelByteOSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Lobby Notifications Handled Last Frame"), STAT_AccelByteLobbyNotificationsHandled, STATGROUP_AccelByteOSS);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Lobby Notification Frame Time (ms)"), STAT_AccelByteLobbyNotificationFrameMs, STATGROUP_AccelByteOSS);
+
+TRACE_DECLARE_INT_COUNTER(AccelByteLobbyNotificationsQueued, TEXT("AccelByteOSS/LobbyNotificationsQueued"));
+TRACE_DECLARE_FLOAT_COUNTER(AccelByteLobbyNotificationFrameMs, TEXT("AccelByteOSS/LobbyNotificationFrameMs"));
+
+void FOnlineNotificationDispatcherAccelByte::Enqueue(const FName& Category, int32 LocalUserNum, const FString& CoalesceKey, FAccelByteNotificationHandler&& Handler, FAccelByteNotificationDecoder&& Decoder)
+{
+	const FQueuedNotificationRef Notification = MakeShared<FQueuedNotification, ESPMode::ThreadSafe>();
+	Notification->Category = Category;
+	Notification->LocalUserNum = LocalUserNum;
+	Notification->CoalesceKey = CoalesceKey;
+	Notification->Handler = MoveTemp(Handler);
+	*Notification->IsDecoded = !Decoder;
+
+	{
+		FScopeLock ScopeLock(&QueueLock);
+
+		FAccelByteNotificationCategoryStats& CategoryStat = CategoryStats.FindOrAdd(Category);
+		CategoryStat.QueuedCount++;
+
+		// The older notification keeps its place in the queue but is dropped when it is reached, as this one is newer
+		if (!CoalesceKey.IsEmpty())
+		{
+			FQueuedNotificationRef* FoundNotification = CoalescedNotifications.Find(CoalesceKey);
+			if (FoundNotification != nullptr)
+			{
+				(*FoundNotification)->bIsCoalesced = true;
+				CategoryStat.CoalescedCount++;
+			}
+			CoalescedNotifications.Add(CoalesceKey, Notification);
+		}
+
+		Queue.Add(Notification);
+		Stats.QueueDepth = Queue.Num();
+		Stats.PeakQueueDepth = FMath::Max(Stats.PeakQueueDepth, Stats.QueueDepth);
+	}
+
+	if (Decoder)
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Decoder = MoveTemp(Decoder), IsDecoded = Notification->IsDecoded]() {
+			Decoder();
+			*IsDecoded = true;
+		});
+	}
+}
+
+void FOnlineNotificationDispatcherAccelByte::Tick(int32 MaxNotificationsPerFrame, double MaxSecondsPerFrame)
+{
+	const double FrameStartTime = FPlatformTime::Seconds();
+	int32 NumConsumed = 0;
+	int32 NumDispatched = 0;
+	bool bIsOverBudget = false;
+	uint64 TickResetGeneration = 0;
+	{
+		FScopeLock ScopeLock(&QueueLock);
+		TickResetGeneration = ResetGeneration;
+	}
+
+	while (true)
+	{
+		TSharedPtr<FQueuedNotification, ESPMode::ThreadSafe> Notification;
+		{
+			FScopeLock ScopeLock(&QueueLock);
+
+			// A handler reset the queue, so everything consumed so far is gone and the queue now only holds what was queued
+			// since, which starts over from the front
+			if (ResetGeneration != TickResetGeneration)
+			{
+				TickResetGeneration = ResetGeneration;
+				NumConsumed = 0;
+			}
+
+			if (NumConsumed >= Queue.Num())
+			{
+				break;
+			}
+
+			const FQueuedNotificationRef& NextNotification = Queue[NumConsumed];
+			if (!NextNotification->bIsCoalesced && !NextNotification->bIsPurged)
+			{
+				// Keep handlers in order, so a notification still being decoded holds back everything behind it
+				if (!*NextNotification->IsDecoded)
+				{
+					break;
+				}
+
+				if (NumDispatched > 0 && (NumDispatched >= MaxNotificationsPerFrame || FPlatformTime::Seconds() - FrameStartTime >= MaxSecondsPerFrame))
+				{
+					bIsOverBudget = true;
+					break;
+				}
+
+				Notification = NextNotification;
+			}
+
+			if (!NextNotification->CoalesceKey.IsEmpty())
+			{
+				const FQueuedNotificationRef* FoundNotification = CoalescedNotifications.Find(NextNotification->CoalesceKey);
+				if (FoundNotification != nullptr && *FoundNotification == NextNotification)
+				{
+					CoalescedNotifications.Remove(NextNotification->CoalesceKey);
+				}
+			}
+			NumConsumed++;
+		}
+
+		if (!Notification.IsValid())
+		{
+			continue;
+		}
+
+		// Run the handler outside of the lock, as handlers are free to queue further notifications
+		const double HandlerStartTime = FPlatformTime::Seconds();
+		Notification->Handler();
+		const double HandlerSeconds = FPlatformTime::Seconds() - HandlerStartTime;
+		NumDispatched++;
+
+		FScopeLock ScopeLock(&QueueLock);
+		FAccelByteNotificationCategoryStats& CategoryStat = CategoryStats.FindOrAdd(Notification->Category);
+		CategoryStat.DispatchedCount++;
+		CategoryStat.TotalHandlerSeconds += HandlerSeconds;
+		CategoryStat.MaxHandlerSeconds = FMath::Max(CategoryStat.MaxHandlerSeconds, HandlerSeconds);
+	}
+
+	const double FrameSeconds = FPlatformTime::Seconds() - FrameStartTime;
+
+	FScopeLock ScopeLock(&QueueLock);
+	// The queue may have been reset since the loop last looked at it, in which case none of what it holds was consumed
+	if (ResetGeneration == TickResetGeneration && NumConsumed > 0)
+	{
+		Queue.RemoveAt(0, NumConsumed, false);
+	}
+
+	Stats.QueueDepth = Queue.Num();
+	Stats.LastFrameDispatchedCount = NumDispatched;
+	Stats.LastFrameSeconds = FrameSeconds;
+	Stats.MaxFrameSeconds = FMath::Max(Stats.MaxFrameSeconds, FrameSeconds);
+	Stats.FramesOverBudgetCount += bIsOverBudget ? 1 : 0;
+
+	SET_DWORD_STAT(STAT_AccelByteLobbyNotificationsQueued, Stats.QueueDepth);
+	SET_DWORD_STAT(STAT_AccelByteLobbyNotificationsHandled, NumDispatched);
+	SET_FLOAT_STAT(STAT_AccelByteLobbyNotificationFrameMs, FrameSeconds * 1000.0);
+	TRACE_COUNTER_SET(AccelByteLobbyNotificationsQueued, Stats.QueueDepth);
+	TRACE_COUNTER_SET(AccelByteLobbyNotificationFrameMs, FrameSeconds * 1000.0);
+}
+
+void FOnlineNotificationDispatcherAccelByte::Reset()
+{
+	FScopeLock ScopeLock(&QueueLock);
+	Queue.Reset();
+	CoalescedNotifications.Reset();
+	Stats.QueueDepth = 0;
+	ResetGeneration++;
+}
+
+void FOnlineNotificationDispatcherAccelByte::PurgeUser(int32 LocalUserNum)
+{
+	FScopeLock ScopeLock(&QueueLock);
+
+	// Purged notifications keep their place in the queue, as Tick may be part way through it, and are dropped when reached
+	for (const FQueuedNotificationRef& Notification : Queue)
+	{
+		if (Notification->LocalUserNum != LocalUserNum || Notification->bIsPurged)
+		{
+			continue;
+		}
+
+		Notification->bIsPurged = true;
+
+		// Forget the notification as the latest for its key, so that one queued after the user logs back in is not counted
+		// as having replaced it
+		if (!Notification->CoalesceKey.IsEmpty())
+		{
+			const FQueuedNotificationRef* FoundNotification = CoalescedNotifications.Find(Notification->CoalesceKey);
+			if (FoundNotification != nullptr && *FoundNotification == Notification)
+			{
+				CoalescedNotifications.Remove(Notification->CoalesceKey);
+			}
+		}
+	}
+}
+
+int32 FOnlineNotificationDispatcherAccelByte::GetQueueDepth() const
+{
+	FScopeLock ScopeLock(&QueueLock);
+	return Queue.Num();
+}
+
+FAccelByteNotificationDispatchStats FOnlineNotificationDispatcherAccelByte::GetStats() const
+{
+	FScopeLock ScopeLock(&QueueLock);
+	return Stats;
+}
+
+TMap<FName, FAccelByteNotificationCategoryStats> FOnlineNotificationDispatcherAccelByte::GetCategoryStats() const
+{
+	FScopeLock ScopeLock(&QueueLock);
+	return CategoryStats;
+}
+
+void FOnlineNotificationDispatcherAccelByte::DumpStats(FOutputDevice& Ar) const
+{
+	const FAccelByteNotificationDispatchStats StatsSnapshot = GetStats();
+	TArray<TPair<FName, FAccelByteNotificationCategoryStats>> SortedStats;
+	{
+		FScopeLock ScopeLock(&QueueLock);
+		SortedStats.Reserve(CategoryStats.Num());
+		for (const TPair<FName, FAccelByteNotificationCategoryStats>& Pair : CategoryStats)
+		{
+			SortedStats.Emplace(Pair.Key, Pair.Value);
+		}
+	}
+
+	SortedStats.Sort([](const TPair<FName, FAccelByteNotificationCategoryStats>& A, const TPair<FName, FAccelByteNotificationCategoryStats>& B) {
+		return A.Value.TotalHandlerSeconds > B.Value.TotalHandlerSeconds;
+	});
+
+	Ar.Logf(TEXT("Queue depth %d (peak %d), last frame handled %d in %.2fms, slowest frame %.2fms, %u frames over budget")
+		, StatsSnapshot.QueueDepth
+		, StatsSnapshot.PeakQueueDepth
+		, StatsSnapshot.LastFrameDispatchedCount
+		, StatsSnapshot.LastFrameSeconds * 1000.0
+		, StatsSnapshot.MaxFrameSeconds * 1000.0
+		, StatsSnapshot.FramesOverBudgetCount);
+
+	Ar.Logf(TEXT("%-40s %10s %10s %10s %12s %12s"), TEXT("Notification"), TEXT("Queued"), TEXT("Coalesced"), TEXT("Handled"), TEXT("AvgMs"), TEXT("MaxMs"));
+	for (const TPair<FName, FAccelByteNotificationCategoryStats>& Pair : SortedStats)
+	{
+		const FAccelByteNotificationCategoryStats& CategoryStat = Pair.Value;
+		const double Count = FMath::Max(CategoryStat.DispatchedCount, 1u);
+		Ar.Logf(TEXT("%-40s %10u %10u %10u %12.3f %12.3f")
+			, *Pair.Key.ToString()
+			, CategoryStat.QueuedCount
+			, CategoryStat.CoalescedCount
+			, CategoryStat.DispatchedCount
+			, CategoryStat.TotalHandlerSeconds * 1000.0 / Count
+			, CategoryStat.MaxHandlerSeconds * 1000.0);
+	}
+}
+
+void FOnlineNotificationDispatcherAccelByte::ResetStats()
+{
+	FScopeLock ScopeLock(&QueueLock);
+	CategoryStats.Reset();
+
+	const int32 QueueDepth = Stats.QueueDepth;
+	Stats = FAccelByteNotificationDispatchStats();
+	Stats.QueueDepth = QueueDepth;
+	Stats.PeakQueueDepth = QueueDepth;
+}
@@ -19,13 +19,25 @@
 #include "OnlineIdentityInterfaceAccelByte.h"
 #include "OnlineSessionInterfaceAccelByte.h"
 #include "OnlineSessionSettings.h"
+#include "OnlineNotificationDispatcherAccelByte.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 
 // Some delegates require reasons as to why the delegate might have failed, for this case, this is a constant for when
 // we do not support the current method that the developer is attempting to call
 #define UNSUPPORTED_METHOD_REASON -10000
 
+/** Key of the coalescer for a local user's writes to a party in FOnlinePartySystemAccelByte::PartyStorageWriteCoalescers */
+static FString GetPartyStorageWriteCoalescerKey(const FUniqueNetIdAccelByteUser& LocalUserId, const FOnlinePartyId& PartyId)
+{
+	return FString::Printf(TEXT("%s:%s"), *LocalUserId.GetAccelByteId(), *PartyId.ToString());
+}
+
 FOnlinePartyIdAccelByte::FOnlinePartyIdAccelByte(const FString& InIdStr)
 	: IdStr(InIdStr)
+	, IdHash(FCrc::StrCrc32(*InIdStr))
 {
 }
 
@@ -63,6 +75,17 @@ FString FOnlinePartyIdAccelByte::ToDebugString() const
 	return IdStr;
 }
 
+uint32 FOnlinePartyIdAccelByte::GetIdHash() const
+{
+	return IdHash;
+}
+
+bool FOnlinePartyIdAccelByte::IsSameId(const FOnlinePartyIdAccelByte& Other) const
+{
+	// Hashes are cached, so checking them first rejects almost every other party without touching the strings
+	return IdHash == Other.IdHash && IdStr.Equals(Other.IdStr, ESearchCase::CaseSensitive);
+}
+
 FOnlinePartyAccelByte::FOnlinePartyAccelByte(const TSharedRef<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe>& InOwningInterface, const FString& InPartyId, const FString& InInviteToken, const FPartyConfiguration& InPartyConfiguration, const TSharedRef<const FUniqueNetIdAccelByteUser>& InLeaderId, const TSharedRef<FOnlinePartyData>& InPartyData, const FOnlinePartyTypeId InPartyTypeId)
 	: FOnlineParty(MakeShared<FOnlinePartyIdAccelByte>(InPartyId), InPartyTypeId)
 	, OwningInterface(InOwningInterface)
@@ -72,6 +95,7 @@ FOnlinePartyAccelByte::FOnlinePartyAccelByte(const TSharedRef<FOnlinePartySystem
 {
 	SetState(EPartyState::Active);
 	LeaderId = InLeaderId;
+	RebuildCrossplayPreferences();
 }
 
 bool FOnlinePartyAccelByte::CanLocalUserInvite(const FUniqueNetId& LocalUserId) const
@@ -167,21 +191,27 @@ void FOnlinePartyAccelByte::AddMember(const TSharedRef<const FUniqueNetIdAccelBy
 {
 	TSharedRef<const FUniqueNetId> NewMemberId = Member->GetUserId();
 	UserIdToPartyMemberMap.Add(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(NewMemberId), Member);
+	InvalidateRoster();
 	OwningInterface->TriggerOnPartyMemberJoinedDelegates(LocalUserId.Get(), PartyId.Get(), NewMemberId.Get());
 }
 
 void FOnlinePartyAccelByte::AddUserToInvitedPlayers(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& InviterUserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& InvitedUserId)
 {
 	InvitedPlayers.Add(FInvitedPlayerPair(InviterUserId, InvitedUserId));
+	InvalidateRoster();
 	OwningInterface->TriggerOnPartyInvitesChangedDelegates(LocalUserId.Get());
 }
 
 TSharedPtr<const FOnlinePartyMemberAccelByte> FOnlinePartyAccelByte::GetMember(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId) const
 {
-	for (auto UserIdToPartyMemberPair : UserIdToPartyMemberMap)
+	return GetMember(UserId->GetAccelByteId());
+}
+
+TSharedPtr<const FOnlinePartyMemberAccelByte> FOnlinePartyAccelByte::GetMember(const FString& AccelByteId) const
+{
+	for (const TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<FOnlinePartyMemberAccelByte>>& UserIdToPartyMemberPair : UserIdToPartyMemberMap)
 	{
-		TSharedRef<const FUniqueNetIdAccelByteUser> UserIdKey = UserIdToPartyMemberPair.Key;
-		if (UserIdKey->GetAccelByteId() == UserId->GetAccelByteId())
+		if (UserIdToPartyMemberPair.Key->GetAccelByteId() == AccelByteId)
 		{
 			return UserIdToPartyMemberPair.Value;
 		}
@@ -206,6 +236,7 @@ bool FOnlinePartyAccelByte::RemoveMember(const TSharedRef<const FUniqueNetIdAcce
 			}
 
 			UserIdToPartyMemberMap.Remove(UserIdKey);
+			InvalidateRoster();
 			bIsMemberFound = true;
 			break;
 		}
@@ -226,8 +257,9 @@ void FOnlinePartyAccelByte::RemoveInvite(const TSharedRef<const FUniqueNetIdAcce
 		// If we found the invited user, then we want to remove them from the party invites array and trigger delegates
 		if (FoundInvitedUserIndex != INDEX_NONE)
 		{
-			const FInvitedPlayerPair& InvitedPlayer = InvitedPlayers[FoundInvitedUserIndex];
+			const FInvitedPlayerPair InvitedPlayer = InvitedPlayers[FoundInvitedUserIndex];
 			InvitedPlayers.RemoveAt(FoundInvitedUserIndex);
+			InvalidateRoster();
 			OwningInterface->TriggerOnPartyInviteRemovedDelegates(LocalUserId.Get(), PartyId.Get(), InvitedPlayer.Key.Get(), PartyInviteRemoveReason);
 		}
 	}
@@ -236,23 +268,64 @@ void FOnlinePartyAccelByte::RemoveInvite(const TSharedRef<const FUniqueNetIdAcce
 
 TArray<FOnlinePartyMemberConstRef> FOnlinePartyAccelByte::GetAllMembers() const
 {
-	TArray<FOnlinePartyMemberConstRef> MembersArray;
-	for (const TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<FOnlinePartyMemberAccelByte>>& KV : UserIdToPartyMemberMap)
+	return GetRoster()->Members;
+}
+
+TArray<TSharedRef<const FUniqueNetId>> FOnlinePartyAccelByte::GetAllPendingInvitedUsers() const
+{
+	return GetRoster()->PendingInvitedUsers;
+}
+
+TSharedRef<const FAccelBytePartyRoster> FOnlinePartyAccelByte::GetRoster() const
+{
+	if (!CachedRoster.IsValid())
 	{
-		MembersArray.Add(KV.Value);
+		TSharedRef<FAccelBytePartyRoster> Roster = MakeShared<FAccelBytePartyRoster>();
+		Roster->Version = RosterVersion;
+
+		Roster->Members.Reserve(UserIdToPartyMemberMap.Num());
+		for (const TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<FOnlinePartyMemberAccelByte>>& KV : UserIdToPartyMemberMap)
+		{
+			Roster->Members.Add(KV.Value);
+		}
+
+		Roster->PendingInvitedUsers.Reserve(InvitedPlayers.Num());
+		for (const FInvitedPlayerPair& InvitedPlayer : InvitedPlayers)
+		{
+			Roster->PendingInvitedUsers.Add(InvitedPlayer.Value);
+		}
+
+		CachedRoster = Roster;
 	}
-	return MembersArray;
+	return CachedRoster.ToSharedRef();
 }
 
-TArray<TSharedRef<const FUniqueNetId>> FOnlinePartyAccelByte::GetAllPendingInvitedUsers() const
+uint32 FOnlinePartyAccelByte::GetRosterVersion() const
+{
+	return RosterVersion;
+}
+
+uint32 FOnlinePartyAccelByte::GetPartyDataVersion() const
 {
-	TArray<TSharedRef<const FUniqueNetId>> OutArray;
-	OutArray.Reserve(InvitedPlayers.Num());
-	for (const FInvitedPlayerPair& InvitedPlayer : InvitedPlayers)
+	return PartyDataVersion;
+}
+
+void FOnlinePartyAccelByte::ForEachMember(TFunctionRef<bool(const FOnlinePartyMemberAccelByte&)> Visitor) const
+{
+	for (const TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<FOnlinePartyMemberAccelByte>>& KV : UserIdToPartyMemberMap)
 	{
-		OutArray.Add(InvitedPlayer.Value);
+		if (!Visitor(KV.Value.Get()))
+		{
+			break;
+		}
 	}
-	return OutArray;
+}
+
+void FOnlinePartyAccelByte::InvalidateRoster()
+{
+	// Anyone still holding the old snapshot keeps it alive and unchanged, the next GetRoster call builds a new one
+	RosterVersion++;
+	CachedRoster.Reset();
 }
 
 TSharedRef<const FOnlinePartyData> FOnlinePartyAccelByte::GetPartyData() const
@@ -263,6 +336,101 @@ TSharedRef<const FOnlinePartyData> FOnlinePartyAccelByte::GetPartyData() const
 void FOnlinePartyAccelByte::SetPartyData(TSharedRef<FOnlinePartyData> InPartyData)
 {
 	PartyData = InPartyData;
+	PartyDataVersion++;
+
+	// Party data set from outside may carry any crossplay platform map, so parse it into our typed table. Changes applied
+	// through ApplyPartyDataDelta only do this when the map itself changed.
+	RebuildCrossplayPreferences();
+}
+
+void FOnlinePartyAccelByte::ApplyPartyDataDelta(const FAccelBytePartyStorageDelta& Delta)
+{
+	if (!PartyData.IsUnique())
+	{
+		PartyData = MakeShared<FOnlinePartyData>(PartyData.Get());
+	}
+
+	Delta.ApplyToPartyData(PartyData.Get());
+	PartyData->ClearDirty();
+	PartyDataVersion++;
+
+	if (Delta.UpdatedAttrs.Contains(CROSSPLAY_OBJECT_NAME) || Delta.RemovedAttrs.Contains(CROSSPLAY_OBJECT_NAME))
+	{
+		RebuildCrossplayPreferences();
+	}
+}
+
+void FOnlinePartyAccelByte::RebuildCrossplayPreferences()
+{
+	MemberCrossplayPreferences.Reset();
+	PlatformMemberCounts.Reset();
+	NumMembersWithoutCrossplay = 0;
+	bHasCrossplayPlatformMap = false;
+
+	FVariantData OutVariantData;
+	if (!PartyData->GetAttribute(CROSSPLAY_OBJECT_NAME, OutVariantData))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> CrossplayObject;
+	OutVariantData.GetValue(CrossplayObject);
+	if (!CrossplayObject.IsValid())
+	{
+		return;
+	}
+
+	bHasCrossplayPlatformMap = true;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& KV : CrossplayObject->Values)
+	{
+		// Entries that are missing fields are still added with crossplay disabled, as we cannot validate that the member
+		// wants crossplay, which keeps the whole party from being treated as crossplay
+		FAccelBytePartyMemberCrossplayPreference Preference;
+		const TSharedPtr<FJsonObject> PrefObject = KV.Value.IsValid() ? KV.Value->AsObject() : nullptr;
+		if (PrefObject.IsValid())
+		{
+			PrefObject->TryGetStringField(CROSSPLAY_OBJECT_PLAYER_PLATFORM_FIELD, Preference.Platform);
+			PrefObject->TryGetBoolField(CROSSPLAY_OBJECT_PLAYER_CROSSPLAY_FIELD, Preference.bCrossplayEnabled);
+		}
+		SetMemberCrossplayPreference(KV.Key, Preference);
+	}
+}
+
+void FOnlinePartyAccelByte::SetMemberCrossplayPreference(const FString& AccelByteId, const FAccelBytePartyMemberCrossplayPreference& Preference)
+{
+	RemoveMemberCrossplayPreference(AccelByteId);
+
+	MemberCrossplayPreferences.Add(AccelByteId, Preference);
+	if (!Preference.bCrossplayEnabled)
+	{
+		NumMembersWithoutCrossplay++;
+	}
+	if (!Preference.Platform.IsEmpty())
+	{
+		PlatformMemberCounts.FindOrAdd(Preference.Platform)++;
+	}
+}
+
+void FOnlinePartyAccelByte::RemoveMemberCrossplayPreference(const FString& AccelByteId)
+{
+	FAccelBytePartyMemberCrossplayPreference RemovedPreference;
+	if (!MemberCrossplayPreferences.RemoveAndCopyValue(AccelByteId, RemovedPreference))
+	{
+		return;
+	}
+
+	if (!RemovedPreference.bCrossplayEnabled)
+	{
+		NumMembersWithoutCrossplay--;
+	}
+	if (!RemovedPreference.Platform.IsEmpty())
+	{
+		int32* FoundCount = PlatformMemberCounts.Find(RemovedPreference.Platform);
+		if (FoundCount != nullptr && --(*FoundCount) <= 0)
+		{
+			PlatformMemberCounts.Remove(RemovedPreference.Platform);
+		}
+	}
 }
 
 void FOnlinePartyAccelByte::AddPlayerCrossplayPreferenceAndPlatform(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId)
@@ -296,10 +464,22 @@ void FOnlinePartyAccelByte::AddPlayerCrossplayPreferenceAndPlatform(const TShare
 		return;
 	}
 
+	FAccelBytePartyMemberCrossplayPreference Preference;
+	Preference.Platform = Subsystem->GetSimplifiedNativePlatformName();
+	Preference.bCrossplayEnabled = CrossplayBoolStr == TEXT("true");
+
+	// Joining or restoring a party we were already in would write the exact same entry again, so skip the copy and write
+	const FAccelBytePartyMemberCrossplayPreference* ExistingPreference = MemberCrossplayPreferences.Find(LocalUserId->GetAccelByteId());
+	if (bHasCrossplayPlatformMap && ExistingPreference != nullptr && *ExistingPreference == Preference)
+	{
+		OwningInterface->RecordSkippedPartyDataWrite();
+		return;
+	}
+
 	// Create a JSON object to store the platform and crossplay preference for the current player
 	TSharedRef<FJsonObject> CurrentPlayerPreferences = MakeShared<FJsonObject>();
-	CurrentPlayerPreferences->SetStringField(CROSSPLAY_OBJECT_PLAYER_PLATFORM_FIELD, Subsystem->GetSimplifiedNativePlatformName());
-	CurrentPlayerPreferences->SetBoolField(CROSSPLAY_OBJECT_PLAYER_CROSSPLAY_FIELD, CrossplayBoolStr == TEXT("true"));
+	CurrentPlayerPreferences->SetStringField(CROSSPLAY_OBJECT_PLAYER_PLATFORM_FIELD, Preference.Platform);
+	CurrentPlayerPreferences->SetBoolField(CROSSPLAY_OBJECT_PLAYER_CROSSPLAY_FIELD, Preference.bCrossplayEnabled);
 
 	// Attempt to grab the current crossplay platform mapping for the current party members, if this already exists, then
 	// we just want to grab the object from the variant data and set our crossplay prefs on that. Otherwise, we want to
@@ -311,7 +491,7 @@ void FOnlinePartyAccelByte::AddPlayerCrossplayPreferenceAndPlatform(const TShare
 	{
 		OutVariantData.GetValue(CrossplayPlatformMapObject);
 	}
-	else
+	if (!CrossplayPlatformMapObject.IsValid())
 	{
 		CrossplayPlatformMapObject = MakeShared<FJsonObject>();
 	}
@@ -320,10 +500,14 @@ void FOnlinePartyAccelByte::AddPlayerCrossplayPreferenceAndPlatform(const TShare
 	CrossplayPlatformMapObject->SetObjectField(LocalUserId->GetAccelByteId(), CurrentPlayerPreferences);
 
 	// Create a copy of the old party data instance, add our updated crossplay platform map object to the copy
-	// and then set the copy as the new party data
+	// and then set the copy as the new party data. We already know exactly what changed in the map, so update the
+	// typed table in place rather than going through SetPartyData and parsing the whole map again.
 	TSharedRef<FOnlinePartyData> NewPartyData = MakeShared<FOnlinePartyData>(CurrentPartyData.Get());
 	NewPartyData->SetAttribute(CROSSPLAY_OBJECT_NAME, FVariantData(CrossplayPlatformMapObject.ToSharedRef()));
-	SetPartyData(NewPartyData);
+	PartyData = NewPartyData;
+	PartyDataVersion++;
+	bHasCrossplayPlatformMap = true;
+	SetMemberCrossplayPreference(LocalUserId->GetAccelByteId(), Preference);
 
 	// Finally, send a request to update the party data on the backend
 	OwningInterface->UpdatePartyData(LocalUserId.Get(), PartyId.Get(), NAME_Game, PartyData.Get());
@@ -331,6 +515,13 @@ void FOnlinePartyAccelByte::AddPlayerCrossplayPreferenceAndPlatform(const TShare
 
 void FOnlinePartyAccelByte::RemovePlayerCrossplayPreferenceAndPlatform(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& UserToRemove)
 {
+	// If the user has no entry in the crossplay platform map then removing it would not change anything
+	if (bHasCrossplayPlatformMap && !MemberCrossplayPreferences.Contains(UserToRemove->GetAccelByteId()))
+	{
+		OwningInterface->RecordSkippedPartyDataWrite();
+		return;
+	}
+
 	// Start by grabbing the current party data and attempting to get the crossplay platform map from it. If we cannot do that
 	// then we want to abort the operation.
 	TSharedRef<const FOnlinePartyData> CurrentPartyData = GetPartyData();
@@ -340,7 +531,7 @@ void FOnlinePartyAccelByte::RemovePlayerCrossplayPreferenceAndPlatform(const TSh
 	{
 		OutVariantData.GetValue(CrossplayPlatformMapObject);
 	}
-	else
+	if (!CrossplayPlatformMapObject.IsValid())
 	{
 		// Cannot remove from the mapping, abort
 		return;
@@ -350,10 +541,12 @@ void FOnlinePartyAccelByte::RemovePlayerCrossplayPreferenceAndPlatform(const TSh
 	CrossplayPlatformMapObject->RemoveField(UserToRemove->GetAccelByteId());
 
 	// Create a copy of the old party data instance, add our updated crossplay platform map object to the copy
-	// and then set the copy as the new party data
+	// and then set the copy as the new party data, updating the typed table in place as with adding a preference
 	TSharedRef<FOnlinePartyData> NewPartyData = MakeShared<FOnlinePartyData>(CurrentPartyData.Get());
 	NewPartyData->SetAttribute(CROSSPLAY_OBJECT_NAME, FVariantData(CrossplayPlatformMapObject.ToSharedRef()));
-	SetPartyData(NewPartyData);
+	PartyData = NewPartyData;
+	PartyDataVersion++;
+	RemoveMemberCrossplayPreference(UserToRemove->GetAccelByteId());
 
 	// Finally, send a request to update the party data on the backend
 	OwningInterface->UpdatePartyData(LocalUserId.Get(), PartyId.Get(), NAME_Game, PartyData.Get());
@@ -361,108 +554,34 @@ void FOnlinePartyAccelByte::RemovePlayerCrossplayPreferenceAndPlatform(const TSh
 
 void FOnlinePartyAccelByte::AddPlayerAcceptedTicketId(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const FString& TicketId, const FString& MatchId)
 {
-	TSharedRef<const FOnlinePartyData> CurrentPartyData = GetPartyData();
-	TSharedRef<FOnlinePartyData> NewPartyData = MakeShared<FOnlinePartyData>(CurrentPartyData.Get());
-	SetPartyData(NewPartyData);
-
-	OwningInterface->UpdatePartyData(LocalUserId.Get(), PartyId.Get(), NAME_Game, PartyData.Get());
+	// Accepted ticket IDs are not kept as a party attribute, so the party data would be written back exactly as it is.
+	// Skip the copy and the write rather than paying for a party storage round trip that changes nothing.
+	OwningInterface->RecordSkippedPartyDataWrite();
 }
 
 void FOnlinePartyAccelByte::RemovePlayerAcceptedTicketId(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId)
 {
-	TSharedRef<const FOnlinePartyData> CurrentPartyData = GetPartyData();
-	TSharedRef<FOnlinePartyData> NewPartyData = MakeShared<FOnlinePartyData>(CurrentPartyData.Get());
-	SetPartyData(NewPartyData);
-
-	OwningInterface->UpdatePartyData(LocalUserId.Get(), PartyId.Get(), NAME_Game, PartyData.Get());
+	// As with adding an accepted ticket ID, there is no attribute to remove, so nothing would be written
+	OwningInterface->RecordSkippedPartyDataWrite();
 }
 
 void FOnlinePartyAccelByte::SetPartyCode(const FString& PartyCode)
 {
-	// Create a copy of the old party data instance, and append our party code to it, then set it
-	TSharedRef<FOnlinePartyData> NewPartyData = MakeShared<FOnlinePartyData>(PartyData.Get());
-	SetPartyData(NewPartyData);
+	// The party code is not kept as a party attribute, so there is nothing in our party data for it to change and no
+	// reason to copy it
 }
 
-bool FOnlinePartyAccelByte::IsCrossplayParty()
+bool FOnlinePartyAccelByte::IsCrossplayParty() const
 {
-	FVariantData OutVariantData;
-	if (!PartyData->GetAttribute(CROSSPLAY_OBJECT_NAME, OutVariantData))
-	{
-		// Cannot confirm that this party is crossplay, so just return false
-		return false;
-	}
-
-	TSharedPtr<FJsonObject> CrossplayObject;
-	OutVariantData.GetValue(CrossplayObject);
-	if (!CrossplayObject.IsValid())
-	{
-		// Still cannot confirm that this party is crossplay, so return false
-		return false;
-	}
-
-	// Iterate through each value in the crossplay object to get the object associated with the user and then to
-	// subsequently check their crossplay preference, if that preference is false, then this party isn't crossplay
-	for (const TPair<FString, TSharedPtr<FJsonValue>>& KV : CrossplayObject->Values)
-	{
-		TSharedPtr<FJsonObject> PrefObject = KV.Value->AsObject();
-		if (!PrefObject.IsValid())
-		{
-			// We cannot validate if this party is crossplay if we cannot grab preferences for the user, so return false
-			return false;
-		}
-
-		bool bWantsCrossplay = false;
-		if (!PrefObject->TryGetBoolField(CROSSPLAY_OBJECT_PLAYER_CROSSPLAY_FIELD, bWantsCrossplay))
-		{
-			// We cannot validate if this user wanted crossplay, so just return false for no crossplay
-			return false;
-		}
-
-		// Finally, if this user explicitly doesn't want crossplay, then the whole party cannot play crossplay
-		if (!bWantsCrossplay)
-		{
-			return false;
-		}
-	}
-
-	// We have gotten through each member and they all want crossplay, so return true
-	return true;
+	// Without a crossplay platform map we cannot confirm that this party is crossplay, otherwise every member that has
+	// an entry in the map must explicitly want crossplay
+	return bHasCrossplayPlatformMap && NumMembersWithoutCrossplay == 0;
 }
 
-TArray<FString> FOnlinePartyAccelByte::GetUniquePlatformsForParty()
+TArray<FString> FOnlinePartyAccelByte::GetUniquePlatformsForParty() const
 {
 	TArray<FString> OutPlatforms;
-	FVariantData OutVariantData;
-	if (!PartyData->GetAttribute(CROSSPLAY_OBJECT_NAME, OutVariantData))
-	{
-		return OutPlatforms;
-	}
-
-	TSharedPtr<FJsonObject> CrossplayObject;
-	OutVariantData.GetValue(CrossplayObject);
-	if (!CrossplayObject.IsValid())
-	{
-		return OutPlatforms;
-	}
-
-	for (const TPair<FString, TSharedPtr<FJsonValue>>& KV : CrossplayObject->Values)
-	{
-		TSharedPtr<FJsonObject> PrefObject = KV.Value->AsObject();
-		if (!PrefObject.IsValid())
-		{
-			return OutPlatforms;
-		}
-
-		FString Platform;
-		if (!PrefObject->TryGetStringField(CROSSPLAY_OBJECT_PLAYER_PLATFORM_FIELD, Platform))
-		{
-			return OutPlatforms;
-		}
-
-		OutPlatforms.AddUnique(Platform);
-	}
-
+	PlatformMemberCounts.GetKeys(OutPlatforms);
 	return OutPlatforms;
 }
 
@@ -621,12 +740,24 @@ bool FOnlinePartyJoinInfoAccelByte::CanRequestAnInvite() const
 
 FOnlinePartySystemAccelByte::FOnlinePartySystemAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
 	: AccelByteSubsystem(InSubsystem)
+	, PartyInviteStore(FOnAccelBytePartyInviteExpired::CreateRaw(this, &FOnlinePartySystemAccelByte::OnPartyInviteExpired))
+	, PartySnapshotFileWriter(MakeShared<FAccelBytePartySnapshotFileWriter, ESPMode::ThreadSafe>())
 {
 }
 
+FPartyIDToPartyMap* FOnlinePartySystemAccelByte::FindPartiesForUser(const FUniqueNetIdAccelByteUser& UserId)
+{
+	return MemberIdToPartiesMap.Find(UserId.GetAccelByteId());
+}
+
+const FPartyIDToPartyMap* FOnlinePartySystemAccelByte::FindPartiesForUser(const FUniqueNetIdAccelByteUser& UserId) const
+{
+	return MemberIdToPartiesMap.Find(UserId.GetAccelByteId());
+}
+
 TSharedPtr<FOnlinePartyAccelByte> FOnlinePartySystemAccelByte::GetFirstPartyForUser(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId)
 {
-	FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(UserId);
+	FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(UserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		for (const TPair<TSharedRef<const FOnlinePartyIdAccelByte>, TSharedRef<FOnlinePartyAccelByte>>& KV : *FoundPartyMap)
@@ -718,12 +849,10 @@ void FOnlinePartySystemAccelByte::OnPartyJoinNotification(const FAccelByteModels
 	}
 
 	// Remove party invitation from the joined party member.
-	FPartyInviteArray& InvitesArray = UserIdToPartyInvitesMap.FindOrAdd(UserId);
-	InvitesArray.RemoveAll([Notification](const TSharedRef<const FAccelBytePartyInvite>& ExistingInvite)
+	if (PartyInviteStore.RemoveInviteFromInviter(UserId.Get(), Notification.UserId).IsValid())
 	{
-		return Notification.UserId == ExistingInvite->InviterId->GetAccelByteId();
-	});
-	TriggerOnPartyInvitesChangedDelegates(UserId.Get());
+		TriggerOnPartyInvitesChangedDelegates(UserId.Get());
+	}
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT("Dispatched async task to add new joined party member to local party."));
 }
@@ -773,6 +902,7 @@ void FOnlinePartySystemAccelByte::OnPartyKickNotification(const FAccelByteModels
 	// kicked from the party handle this case specially to leave the party.
 	if (UserId->GetAccelByteId() == Notification.UserId)
 	{
+		RemovePartySnapshot(UserId);
 		if (RemovePartyForUser(UserId, MakeShared<const FOnlinePartyIdAccelByte>(Notification.PartyId))) 
 		{
 			// We will also want to fire this delegate so party for local user is updated
@@ -795,14 +925,104 @@ void FOnlinePartySystemAccelByte::OnPartyKickNotification(const FAccelByteModels
 	}
 }
 
-void FOnlinePartySystemAccelByte::OnPartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
+bool FOnlinePartySystemAccelByte::DecodePartyStorage(const FAccelByteModelsPartyDataNotif& Notification, TMap<FString, FVariantData>& OutStorageAttrs)
 {
-	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s"), *UserId->ToDebugString(), *Notification.PartyId);
+	// First, check if we have a valid JSON object in the first place, and skip storage that is empty
+	if (!Notification.Custom_attribute.JsonObject.IsValid() || Notification.Custom_attribute.JsonObject->Values.Num() <= 0)
+	{
+		UE_LOG_AB(Log, TEXT("FOnlinePartySystemAccelByte::DecodePartyStorage there is no party storage update"));
+		return false;
+	}
 
-	FString NotificationString;
-	FJsonObjectConverter::UStructToJsonObjectString(Notification, NotificationString);
+	// Read attributes straight from the JSON object of party storage, rather than writing it out to a string and parsing
+	// that back through FOnlinePartyData::FromJson
+	FAccelBytePartyStorageDelta::ReadPartyStorage(*Notification.Custom_attribute.JsonObject, OutStorageAttrs);
+	return OutStorageAttrs.Num() > 0;
+}
 
-	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Updated party information recieved! Data: %s"), *NotificationString);
+bool FOnlinePartySystemAccelByte::DecodePartyStorage(const FString& StorageJson, TMap<FString, FVariantData>& OutStorageAttrs)
+{
+	TSharedPtr<FJsonObject> StorageObject;
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(StorageJson);
+	if (StorageJson.IsEmpty() || !FJsonSerializer::Deserialize(JsonReader, StorageObject) || !StorageObject.IsValid())
+	{
+		return false;
+	}
+
+	FAccelBytePartyStorageDelta::ReadPartyStorage(*StorageObject, OutStorageAttrs);
+	return OutStorageAttrs.Num() > 0;
+}
+
+void FOnlinePartySystemAccelByte::QueuePartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId, int32 LocalUserNum)
+{
+	const FOnlineNotificationDispatcherAccelBytePtr NotificationDispatcher = AccelByteSubsystem->GetNotificationDispatcher();
+	if (!NotificationDispatcher.IsValid())
+	{
+		TMap<FString, FVariantData> StorageAttrs;
+		const bool bHasStorage = DecodePartyStorage(Notification, StorageAttrs);
+		OnPartyDataChangeNotification(Notification, UserId, bHasStorage ? &StorageAttrs : nullptr);
+		return;
+	}
+
+	// The JSON of the notification is shared with the SDK, so write party storage out to a string here on the game thread
+	// and have the decoder parse only that private copy
+	const TSharedRef<FQueuedPartyStorage, ESPMode::ThreadSafe> QueuedStorage = MakeShared<FQueuedPartyStorage, ESPMode::ThreadSafe>();
+	const FString CoalesceKey = FString::Printf(TEXT("PartyData:%s:%s"), *UserId->GetAccelByteId(), *Notification.PartyId);
+	if (Notification.Custom_attribute.JsonObject.IsValid() && Notification.Custom_attribute.JsonObject->Values.Num() > 0)
+	{
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&QueuedStorage->StorageJson);
+		FJsonSerializer::Serialize(Notification.Custom_attribute.JsonObject.ToSharedRef(), JsonWriter);
+	}
+	else
+	{
+		// A change without storage still replaces the latest one queued for the party, as it carries the newer leader, but
+		// takes over its storage so that storage change is not lost along with it
+		const TSharedRef<FQueuedPartyStorage, ESPMode::ThreadSafe>* FoundStorage = QueuedPartyStorages.Find(CoalesceKey);
+		if (FoundStorage != nullptr)
+		{
+			QueuedStorage->StorageJson = (*FoundStorage)->StorageJson;
+		}
+	}
+	QueuedPartyStorages.Add(CoalesceKey, QueuedStorage);
+
+	FAccelByteNotificationDecoder Decoder;
+	if (!QueuedStorage->StorageJson.IsEmpty())
+	{
+		Decoder = [QueuedStorage]() {
+			QueuedStorage->bHasStorage = DecodePartyStorage(QueuedStorage->StorageJson, QueuedStorage->StorageAttrs);
+		};
+	}
+
+	const TWeakPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> WeakThis = AsShared();
+	NotificationDispatcher->Enqueue(TEXT("PartyDataChange"), LocalUserNum, CoalesceKey,
+		[WeakThis, Notification, QueuedStorage, UserId, CoalesceKey]() {
+			const TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> PartyInterface = WeakThis.Pin();
+			if (!PartyInterface.IsValid())
+			{
+				return;
+			}
+
+			const TSharedRef<FQueuedPartyStorage, ESPMode::ThreadSafe>* FoundStorage = PartyInterface->QueuedPartyStorages.Find(CoalesceKey);
+			if (FoundStorage != nullptr && *FoundStorage == QueuedStorage)
+			{
+				PartyInterface->QueuedPartyStorages.Remove(CoalesceKey);
+			}
+			PartyInterface->OnPartyDataChangeNotification(Notification, UserId, QueuedStorage->bHasStorage ? &QueuedStorage->StorageAttrs : nullptr);
+		},
+		MoveTemp(Decoder));
+}
+
+void FOnlinePartySystemAccelByte::OnPartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId, const TMap<FString, FVariantData>* StorageAttrs)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s"), *UserId->ToDebugString(), *Notification.PartyId);
+
+	// Writing the whole notification out as JSON is only worth it if someone is going to read it
+	if (UE_LOG_ACTIVE(LogAccelByteOSSParty, Verbose))
+	{
+		FString NotificationString;
+		FJsonObjectConverter::UStructToJsonObjectString(Notification, NotificationString);
+		UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Updated party information recieved! Data: %s"), *NotificationString);
+	}
 
 	// First, check if the party leader ID has changed and if so, set the current leader ID to be the new one from the notification
 	TSharedPtr<FOnlinePartyAccelByte> Party = GetPartyForUser(UserId, MakeShared<const FOnlinePartyIdAccelByte>(Notification.PartyId));
@@ -817,30 +1037,24 @@ void FOnlinePartySystemAccelByte::OnPartyDataChangeNotification(const FAccelByte
 	{
 		UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("User '%s' has been promoted to leader of party '%s' replacing user '%s'!"), *Notification.Leader, *Party->PartyId->ToString(), *PreviousLeaderId->GetAccelByteId());
 
-		// Get the leader ID without the platform information first, use it to get the actual ID for the leader and set that
-		FAccelByteUniqueIdComposite LeaderCompositeId;
-		LeaderCompositeId.Id = Notification.Leader;
-
-		TSharedPtr<const FUniqueNetIdAccelByteUser> ABUserId = FUniqueNetIdAccelByteUser::Create(LeaderCompositeId);
-		TSharedPtr<const FOnlinePartyMemberAccelByte> LeaderMember = Party->GetMember(ABUserId.ToSharedRef());
+		// The notification only has the leader's plain AccelByte ID, so look the member up by that and reuse their ID,
+		// which also has their platform information, rather than building a new one
+		TSharedPtr<const FOnlinePartyMemberAccelByte> LeaderMember = Party->GetMember(Notification.Leader);
 		if (LeaderMember.IsValid())
 		{
 			Party->LeaderId = LeaderMember->GetUserId();
 
-			const TSharedRef<const FUniqueNetIdAccelByteUser> LeaderMemberId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LeaderMember->GetUserId().Get().AsShared());
-			FString LeaderMemberIdStr = LeaderMemberId->GetAccelByteId();
-
-			TSharedPtr<const FUniqueNetIdAccelByteUser> PartyLeaderId = StaticCastSharedPtr<const FUniqueNetIdAccelByteUser>(Party->LeaderId);
-			FString PartyLeaderIdStr = PartyLeaderId->GetAccelByteId();
 			//Send the notif for all local users that have the same party object
-			for (auto Member : Party->GetAllMembers())
+			const TSharedRef<const FOnlinePartyIdAccelByte> PartyId = StaticCastSharedRef<const FOnlinePartyIdAccelByte>(Party->PartyId);
+			const TSharedRef<const FAccelBytePartyRoster> Roster = Party->GetRoster();
+			for (const FOnlinePartyMemberConstRef& Member : Roster->Members)
 			{
 				if (Member->GetUserId().Get() != *PreviousLeaderId.Get())
 				{
-					FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(FUniqueNetIdAccelByteUser::Cast(Member->GetUserId().Get()));
+					FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(FUniqueNetIdAccelByteUser::Cast(Member->GetUserId().Get()).Get());
 					if (FoundPartyMap != nullptr)
 					{
-						TSharedRef<FOnlinePartyAccelByte>* FoundPartyRef = FoundPartyMap->Find(MakeShared<const FOnlinePartyIdAccelByte>(Notification.PartyId));
+						TSharedRef<FOnlinePartyAccelByte>* FoundPartyRef = FoundPartyMap->Find(PartyId);
 						if(FoundPartyRef != nullptr && *FoundPartyRef == Party)
 						{
 							TriggerOnPartyMemberPromotedDelegates(Member->GetUserId().Get(), Party->PartyId.Get(), *Party->LeaderId.Get());
@@ -855,43 +1069,26 @@ void FOnlinePartySystemAccelByte::OnPartyDataChangeNotification(const FAccelByte
 		}
 	}
 
-	// Now from here, this also could be a notification for when party storage changes, so we want to try and update that
-	// First, check if we have a valid JSON object in the first place
-	if (!Notification.Custom_attribute.JsonObject.IsValid())
+	// Party storage was read off the game thread when the notification was queued, null if there was none
+	if (StorageAttrs == nullptr)
 	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Finished updating party with no party storage update."));
 		return;
 	}
 
-	// Now, we can use the JSON wrapper util to convert our response to a string
-	FString JSONString;
-	if (!Notification.Custom_attribute.JsonObjectToString(JSONString))
+	// Notifications carry the whole of party storage, so only apply and announce the attributes that actually changed.
+	// Attributes we are still writing keep their local value, as this storage was written before our changes land.
+	const FAccelBytePartyStorageDelta Delta = FAccelBytePartyStorageDelta::FromPartyStorage(Party->GetPartyData().Get(), *StorageAttrs, GetUnwrittenPartyStorageDelta(*Party->PartyId));
+	if (Delta.IsEmpty())
 	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Finished updating party as party storage matched our party data."));
 		return;
 	}
 
-	// If empty then don't update
-	if (JSONString.Len() == 2)
-	{
-		UE_LOG_AB(Log, TEXT("FOnlinePartySystemAccelByte::OnPartyDataChangeNotification there is no party storage update"));
-		return;
-	}
-
-	// Add attrs field for the use of FOnlinePartyData::FromJson()
-	TSharedRef<FJsonObject> MainJsonObj = MakeShared<FJsonObject>();
-	TSharedRef<FJsonValueObject> JsonValue = MakeShared<FJsonValueObject>(Notification.Custom_attribute.JsonObject);
-	MainJsonObj->SetField("Attrs", JsonValue);
+	Party->ApplyPartyDataDelta(Delta);
 
-	FString PartyDataStr;
-	FJsonObjectWrapper PartyStorageData;
-	PartyStorageData.JsonObject = MainJsonObj;
-	PartyStorageData.JsonObjectToString(JSONString);
-
-	// Finally, we can provide this JSON string to the FromJson method of our PartyData instance which will populate our values
-	TSharedRef<FOnlinePartyData> PartyData = MakeShared<FOnlinePartyData>();
-	PartyData->FromJson(JSONString);
-	Party->SetPartyData(PartyData);
-
-	TriggerOnPartyDataReceivedDelegates(UserId.Get(), *Party->PartyId, NAME_Game, *PartyData);
+	TriggerOnPartyDataAttributesChangedDelegates(UserId.Get(), *Party->PartyId, NAME_Game, Delta);
+	TriggerOnPartyDataReceivedDelegates(UserId.Get(), *Party->PartyId, NAME_Game, Party->GetPartyData().Get());
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT("Finished updating data on party."));
 }
@@ -951,22 +1148,30 @@ void FOnlinePartySystemAccelByte::RegisterRealTimeLobbyDelegates(const TSharedRe
 		return;
 	}
 
+	// Notifications go through the notification queue so that a burst of them is spread over several frames, or are
+	// handled straight away if there is no queue to go through
+	const FOnlineNotificationDispatcherAccelBytePtr NotificationDispatcher = AccelByteSubsystem->GetNotificationDispatcher();
+	int32 LocalUserNum = INDEX_NONE;
+	IdentityInterface->GetLocalUserNum(UserId.Get(), LocalUserNum);
+
 	AccelByte::Api::Lobby::FPartyGetInvitedNotif OnReceivedPartyInviteNotifDelegate = AccelByte::Api::Lobby::FPartyGetInvitedNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnReceivedPartyInviteNotification, UserId);
-	ApiClient->Lobby.SetPartyGetInvitedNotifDelegate(OnReceivedPartyInviteNotifDelegate);
+	ApiClient->Lobby.SetPartyGetInvitedNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("PartyInviteReceived"), LocalUserNum, OnReceivedPartyInviteNotifDelegate));
 
 	AccelByte::Api::Lobby::FPartyInviteNotif OnPartyInviteSentNotifDelegate = AccelByte::Api::Lobby::FPartyInviteNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnPartyInviteSentNotification, UserId);
-	ApiClient->Lobby.SetPartyInviteNotifDelegate(OnPartyInviteSentNotifDelegate);
+	ApiClient->Lobby.SetPartyInviteNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("PartyInviteSent"), LocalUserNum, OnPartyInviteSentNotifDelegate));
 
 	AccelByte::Api::Lobby::FPartyJoinNotif OnPartyJoinNotificationDelegate = AccelByte::Api::Lobby::FPartyJoinNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnPartyJoinNotification, UserId);
-	ApiClient->Lobby.SetPartyJoinNotifDelegate(OnPartyJoinNotificationDelegate);
+	ApiClient->Lobby.SetPartyJoinNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("PartyJoin"), LocalUserNum, OnPartyJoinNotificationDelegate));
 
 	AccelByte::Api::Lobby::FPartyMemberLeaveNotif OnPartyMemberLeaveNotificationDelegate = AccelByte::Api::Lobby::FPartyMemberLeaveNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnPartyMemberLeaveNotification, UserId);
-	ApiClient->Lobby.SetPartyMemberLeaveNotifDelegate(OnPartyMemberLeaveNotificationDelegate);
+	ApiClient->Lobby.SetPartyMemberLeaveNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("PartyMemberLeave"), LocalUserNum, OnPartyMemberLeaveNotificationDelegate));
 
 	AccelByte::Api::Lobby::FPartyKickNotif OnPartyKickNotificationDelegate = AccelByte::Api::Lobby::FPartyKickNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnPartyKickNotification, UserId);
-	ApiClient->Lobby.SetPartyKickNotifDelegate(OnPartyKickNotificationDelegate);
+	ApiClient->Lobby.SetPartyKickNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("PartyKick"), LocalUserNum, OnPartyKickNotificationDelegate));
 
-	AccelByte::Api::Lobby::FPartyDataUpdateNotif OnPartyDataChangeNotificationDelegate = AccelByte::Api::Lobby::FPartyDataUpdateNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnPartyDataChangeNotification, UserId);
+	// Party data changes carry the whole of party storage, so they are queued by hand to parse storage off the game thread
+	// and to only handle the latest change to each party
+	AccelByte::Api::Lobby::FPartyDataUpdateNotif OnPartyDataChangeNotificationDelegate = AccelByte::Api::Lobby::FPartyDataUpdateNotif::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::QueuePartyDataChangeNotification, UserId, LocalUserNum);
 	ApiClient->Lobby.SetPartyDataUpdateResponseDelegate(OnPartyDataChangeNotificationDelegate);
 	
 	FOnPartyJoinedDelegate PartyJoinedDelegate = FOnPartyJoinedDelegate::CreateThreadSafeSP(this, &FOnlinePartySystemAccelByte::OnPartyJoinedComplete);
@@ -975,17 +1180,8 @@ void FOnlinePartySystemAccelByte::RegisterRealTimeLobbyDelegates(const TSharedRe
 
 void FOnlinePartySystemAccelByte::AddPartyToInterface(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<FOnlinePartyAccelByte>& Party)
 {
-	FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(UserId);
-	if (FoundPartyMap != nullptr)
-	{
-		FoundPartyMap->Add(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(Party->PartyId), Party);
-	}
-	else
-	{
-		FPartyIDToPartyMap NewPartyMap;
-		NewPartyMap.Add(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(Party->PartyId), Party);
-		UserIdToPartiesMap.Add(UserId, NewPartyMap);
-	}
+	FPartyIDToPartyMap& PartyMap = MemberIdToPartiesMap.FindOrAdd(UserId->GetAccelByteId());
+	PartyMap.Add(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(Party->PartyId), Party);
 }
 
 bool FOnlinePartySystemAccelByte::RemovePartyFromInterface(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId)
@@ -1006,13 +1202,26 @@ bool FOnlinePartySystemAccelByte::RemovePartyFromInterface(const TSharedRef<cons
 
 bool FOnlinePartySystemAccelByte::RemovePartyFromInterface(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FOnlinePartyIdAccelByte>& PartyId)
 {
-	FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(UserId);
+	// Changes a user made to a party they are no longer in can never be written, so drop them along with the party
+	const FString CoalescerKey = GetPartyStorageWriteCoalescerKey(UserId.Get(), PartyId.Get());
+	const TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>* FoundCoalescer = PartyStorageWriteCoalescers.Find(CoalescerKey);
+	if (FoundCoalescer != nullptr)
+	{
+		RemovedCoalescerWriteStats.Accumulate((*FoundCoalescer)->GetStats());
+		PartyStorageWriteCoalescers.Remove(CoalescerKey);
+	}
+
+	FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(UserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
-		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(PartyId);
-		if (FoundParty != nullptr)
+		if (FoundPartyMap->Remove(PartyId) > 0)
 		{
-			FoundPartyMap->Remove(PartyId);
+			// Drop the member from the index entirely once they have no parties left, otherwise a server that sees many
+			// players come and go would keep an entry for every one of them
+			if (FoundPartyMap->Num() <= 0)
+			{
+				MemberIdToPartiesMap.Remove(UserId->GetAccelByteId());
+			}
 			return true;
 		}
 	}
@@ -1027,7 +1236,7 @@ bool FOnlinePartySystemAccelByte::IsPlayerInParty(const FUniqueNetId& UserId, co
 		return false;
 	}
 
-	FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(AccelByteId);
+	FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(AccelByteId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<const FOnlinePartyIdAccelByte> AccelBytePartyId = StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared());
@@ -1036,13 +1245,7 @@ bool FOnlinePartySystemAccelByte::IsPlayerInParty(const FUniqueNetId& UserId, co
 			return false;
 		}
 
-		for (auto FoundPartyPair : *FoundPartyMap)
-		{
-			if(FoundPartyPair.Key->ToString() == AccelBytePartyId->ToString())
-			{
-				return true;
-			}
-		}
+		return FoundPartyMap->Contains(AccelBytePartyId);
 	}
 	return false;
 }
@@ -1055,7 +1258,7 @@ bool FOnlinePartySystemAccelByte::IsPlayerInAnyParty(const FUniqueNetId& UserId)
 		return false;
 	}
 
-	FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(AccelByteId);
+	FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(AccelByteId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		return FoundPartyMap->Num() > 0;
@@ -1082,48 +1285,31 @@ int32 FOnlinePartySystemAccelByte::GetCurrentPartyMemberCount(const FUniqueNetId
 
 TSharedPtr<const FAccelBytePartyInvite> FOnlinePartySystemAccelByte::GetInviteForParty(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FOnlinePartyIdAccelByte>& PartyId)
 {
-	FPartyInviteArray* FoundInvitesArray = UserIdToPartyInvitesMap.Find(UserId);
-	if (FoundInvitesArray != nullptr)
-	{
-		TSharedRef<const FAccelBytePartyInvite>* FoundInvite = FoundInvitesArray->FindByPredicate([&PartyId](const TSharedRef<const FAccelBytePartyInvite>& Invite) {
-			return Invite->PartyId.Get() == PartyId.Get();
-		});
-
-		if (FoundInvite != nullptr)
-		{
-			return *FoundInvite;
-		}
-	}
-	return nullptr;
+	return PartyInviteStore.FindInviteForParty(UserId.Get(), PartyId->ToString());
 }
 
 TSharedPtr<const FAccelBytePartyInvite> FOnlinePartySystemAccelByte::GetInviteForParty(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& InviterId)
 {
-	FPartyInviteArray* FoundInvitesArray = UserIdToPartyInvitesMap.Find(UserId);
-	if (FoundInvitesArray != nullptr)
-	{
-		TSharedRef<const FAccelBytePartyInvite>* FoundInvite = FoundInvitesArray->FindByPredicate([&InviterId](const TSharedRef<const FAccelBytePartyInvite>& Invite) {
-			return Invite->InviterId.Get() == InviterId.Get();
-		});
-
-		if (FoundInvite != nullptr)
-		{
-			return *FoundInvite;
-		}
-	}
-	return nullptr;
+	return PartyInviteStore.FindInviteFromInviter(UserId.Get(), InviterId->GetAccelByteId());
 }
 
 void FOnlinePartySystemAccelByte::AddPartyInvite(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<FAccelBytePartyInvite>& Invite)
 {
-	FPartyInviteArray& InvitesArray = UserIdToPartyInvitesMap.FindOrAdd(UserId);
-	// Remove existing invite with same party Id, so it won't duplicates
-	InvitesArray.RemoveAll([Invite](const TSharedRef<const FAccelBytePartyInvite>& ExistingInvite)
+	// Any existing invite for the same party or from the same inviter is replaced, so it won't duplicate
+	const FOnlineSubsystemAccelByteSettings& Settings = AccelByteSubsystem->GetSettings();
+	TArray<TSharedRef<const FAccelBytePartyInvite>> EvictedInvites;
+	PartyInviteStore.AddInvite(UserId, Invite, FPlatformTime::Seconds(), Settings.PartyInviteTTLSeconds, Settings.MaxPartyInvitesPerUser, EvictedInvites);
+
+	for (const TSharedRef<const FAccelBytePartyInvite>& EvictedInvite : EvictedInvites)
 	{
-		return Invite->PartyId->ToString() == ExistingInvite->PartyId->ToString()
-			|| Invite->InviterId->ToString() == ExistingInvite->InviterId->ToString();
-	});
-	InvitesArray.Add(Invite);
+		UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Dropping party invite to '%s' from '%s' for user '%s' as they are holding %d invites"), *EvictedInvite->PartyId->ToString(), *EvictedInvite->InviterId->ToDebugString(), *UserId->ToDebugString(), Settings.MaxPartyInvitesPerUser);
+		TriggerOnPartyInviteRemovedDelegates(UserId.Get(), EvictedInvite->PartyId.Get(), EvictedInvite->InviterId.Get(), EPartyInvitationRemovedReason::Invalidated);
+	}
+	if (EvictedInvites.Num() > 0)
+	{
+		TriggerOnPartyInvitesChangedDelegates(UserId.Get());
+	}
+
 	TriggerOnPartyInviteReceivedDelegates(UserId.Get(), Invite->PartyId.Get(), Invite->InviterId.Get());
 #if (ENGINE_MAJOR_VERSION == 5) || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 26)
 	TSharedRef<FOnlinePartyJoinInfoAccelByte> JoinInfoRef = MakeShared<FOnlinePartyJoinInfoAccelByte>(Invite->PartyId, Invite->InviterId, Invite->InviterDisplayName);
@@ -1133,41 +1319,23 @@ void FOnlinePartySystemAccelByte::AddPartyInvite(const TSharedRef<const FUniqueN
 
 bool FOnlinePartySystemAccelByte::RemoveInviteForParty(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FOnlinePartyIdAccelByte>& PartyId, const EPartyInvitationRemovedReason& InvitationRemovalReason)
 {
-	FPartyInviteArray* FoundInvitesArray = UserIdToPartyInvitesMap.Find(UserId);
-	if (FoundInvitesArray != nullptr)
+	const TSharedPtr<const FAccelBytePartyInvite> RemovedInvite = PartyInviteStore.RemoveInviteForParty(UserId.Get(), PartyId->ToString());
+	if (RemovedInvite.IsValid())
 	{
-		int32 FoundInviteIndex = FoundInvitesArray->IndexOfByPredicate([&PartyId](const TSharedRef<const FAccelBytePartyInvite>& Invite) {
-			return Invite->PartyId.Get() == PartyId.Get();
-		});
-
-		if (FoundInviteIndex != INDEX_NONE)
-		{
-			const TSharedRef<const FUniqueNetIdAccelByteUser> SenderId = (*FoundInvitesArray)[FoundInviteIndex]->InviterId;
-			FoundInvitesArray->RemoveAt(FoundInviteIndex);
-			TriggerOnPartyInviteRemovedDelegates(UserId.Get(), PartyId.Get(), SenderId.Get(), InvitationRemovalReason);
-			TriggerOnPartyInvitesChangedDelegates(UserId.Get());
-			return true;
-		}
+		TriggerOnPartyInviteRemovedDelegates(UserId.Get(), PartyId.Get(), RemovedInvite->InviterId.Get(), InvitationRemovalReason);
+		TriggerOnPartyInvitesChangedDelegates(UserId.Get());
+		return true;
 	}
 	return false;
 }
 
 bool FOnlinePartySystemAccelByte::RemoveInviteForParty(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& InviterId, const EPartyInvitationRemovedReason& InvitationRemovalReason)
 {
-	FPartyInviteArray* FoundInvitesArray = UserIdToPartyInvitesMap.Find(UserId);
-	if (FoundInvitesArray != nullptr)
+	const TSharedPtr<const FAccelBytePartyInvite> RemovedInvite = PartyInviteStore.RemoveInviteFromInviter(UserId.Get(), InviterId->GetAccelByteId());
+	if (RemovedInvite.IsValid())
 	{
-		int32 FoundInviteIndex = FoundInvitesArray->IndexOfByPredicate([&InviterId](const TSharedRef<const FAccelBytePartyInvite>& Invite) {
-			return Invite->InviterId.Get() == InviterId.Get();
-		});
-
-		if (FoundInviteIndex != INDEX_NONE)
-		{
-			TSharedRef<const FAccelBytePartyInvite> Invite = (*FoundInvitesArray)[FoundInviteIndex];
-			TriggerOnPartyInviteRemovedDelegates(UserId.Get(), Invite->PartyId.Get(), Invite->InviterId.Get(), InvitationRemovalReason);
-			FoundInvitesArray->RemoveAt(FoundInviteIndex);
-			return true;
-		}
+		TriggerOnPartyInviteRemovedDelegates(UserId.Get(), RemovedInvite->PartyId.Get(), RemovedInvite->InviterId.Get(), InvitationRemovalReason);
+		return true;
 	}
 	return false;
 }
@@ -1175,23 +1343,21 @@ bool FOnlinePartySystemAccelByte::RemoveInviteForParty(const TSharedRef<const FU
 bool FOnlinePartySystemAccelByte::ClearInviteForParty(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedPtr<const FOnlinePartyId>& PartyId, const EPartyInvitationRemovedReason& InvitationRemovalReason)
 {
 	// ClearInvitiations will just clear the local cache for now, as we cannot restore invites between sessions
-	FPartyInviteArray* FoundInvites = UserIdToPartyInvitesMap.Find(UserId);
-	if (FoundInvites != nullptr)
+	// If we have a party ID associated with this request, then it means that we want to remove a specific party invite
+	if (PartyId.IsValid())
 	{
-		// If we have a party ID associated with this request, then it means that we want to remove a specific party invite
-		// With this in mind, we will iterate through all invites, check if the party ID matches, and if so, remove it.
-		if (PartyId.IsValid())
-		{
-			FoundInvites->RemoveAll([&PartyId](const TSharedRef<const FAccelBytePartyInvite>& Invite) { return Invite->PartyId == PartyId; });
-		}
-		// Otherwise, just remove all invites we have cached
-		else
-		{
-			FoundInvites->Empty();
-		}
-		return true;
+		return PartyInviteStore.RemoveInviteForParty(UserId.Get(), PartyId->ToString()).IsValid();
 	}
-	return false;
+
+	// Otherwise, just remove all invites we have cached
+	return PartyInviteStore.RemoveAllInvites(UserId.Get());
+}
+
+void FOnlinePartySystemAccelByte::OnPartyInviteExpired(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FAccelBytePartyInvite>& Invite)
+{
+	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Party invite to '%s' from '%s' for user '%s' has expired"), *Invite->PartyId->ToString(), *Invite->InviterId->ToDebugString(), *LocalUserId->ToDebugString());
+	TriggerOnPartyInviteRemovedDelegates(LocalUserId.Get(), Invite->PartyId.Get(), Invite->InviterId.Get(), EPartyInvitationRemovedReason::Expired);
+	TriggerOnPartyInvitesChangedDelegates(LocalUserId.Get());
 }
 
 bool FOnlinePartySystemAccelByte::RemovePartyForUser(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId)
@@ -1212,7 +1378,7 @@ bool FOnlinePartySystemAccelByte::RemovePartyForUser(const TSharedRef<const FUni
 
 TSharedPtr<FOnlinePartyAccelByte> FOnlinePartySystemAccelByte::GetPartyForUser(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FOnlinePartyIdAccelByte>& PartyId)
 {
-	FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(UserId);
+	FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(UserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(PartyId);
@@ -1433,7 +1599,9 @@ bool FOnlinePartySystemAccelByte::RejectInvitation(const FUniqueNetId& LocalUser
 void FOnlinePartySystemAccelByte::ClearInvitations(const FUniqueNetId& LocalUserId, const FUniqueNetId& SenderId, const FOnlinePartyId* PartyId)
 {
 	// ClearInvitiations will just clear the local cache for now, as we cannot restore invites between sessions
-	ClearInviteForParty(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared()), MakeShareable(PartyId), EPartyInvitationRemovedReason::Cleared);
+	// Share the caller's party ID rather than wrapping it in a new shared pointer, which would delete it once released
+	const TSharedPtr<const FOnlinePartyId> PartyIdPtr = (PartyId != nullptr) ? PartyId->AsShared() : TSharedPtr<const FOnlinePartyId>();
+	ClearInviteForParty(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared()), PartyIdPtr, EPartyInvitationRemovedReason::Cleared);
 }
 
 bool FOnlinePartySystemAccelByte::KickMember(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, const FUniqueNetId& TargetMemberId, const FOnKickPartyMemberComplete& Delegate)
@@ -1450,10 +1618,225 @@ bool FOnlinePartySystemAccelByte::PromoteMember(const FUniqueNetId& LocalUserId,
 
 bool FOnlinePartySystemAccelByte::UpdatePartyData(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, const FName& Namespace, const FOnlinePartyData& PartyData)
 {
-	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdatePartyData>(AccelByteSubsystem, LocalUserId, PartyId, Namespace, PartyData);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> LocalUserIdAccelByte = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
+
+	// Rather than writing party storage straight away, hand the changes to the coalescer for this user and party so that
+	// a burst of changes, such as from several members joining at once, goes out as a single write. Each local user has
+	// their own coalescer, so one user's changes are never sent on behalf of another who may have left the party.
+	const FString CoalescerKey = GetPartyStorageWriteCoalescerKey(LocalUserIdAccelByte.Get(), PartyId);
+	TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>* FoundCoalescer = PartyStorageWriteCoalescers.Find(CoalescerKey);
+	if (FoundCoalescer == nullptr)
+	{
+		const TSharedRef<const FOnlinePartyId> SharedPartyId = PartyId.AsShared();
+		FAccelBytePartyStorageWriteFunction WriteFunction = [Subsystem = AccelByteSubsystem, SharedPartyId](const TSharedRef<const FUniqueNetIdAccelByteUser>& WriterUserId, const FAccelBytePartyStorageDelta& Delta, const FOnPartyStorageWriteComplete& OnComplete) {
+			Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdatePartyData>(Subsystem, WriterUserId.Get(), SharedPartyId.Get(), Delta, OnComplete);
+		};
+
+		const FOnlineSubsystemAccelByteSettings& Settings = AccelByteSubsystem->GetSettings();
+		FoundCoalescer = &PartyStorageWriteCoalescers.Add(CoalescerKey, MakeShared<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>(WriteFunction, Settings.PartyStorageWriteCoalesceWindowSeconds, Settings.PartyStorageWriteMaxRetries));
+	}
+
+	FAccelBytePartyStorageDelta Delta = FAccelBytePartyStorageDelta::FromDirtyPartyData(PartyData);
+
+	// Party data built by the caller may set attributes to the values that the party already has, which should not cost
+	// a write. Our own party objects apply their changes before calling this, so their data has nothing to compare with.
+	// Changes that have not been written yet are not in the party data, so compare against the data with them applied,
+	// otherwise setting an attribute back while a change to it is pending would be dropped and the pending value written.
+	const TSharedPtr<FOnlinePartyAccelByte> Party = GetPartyForUser(LocalUserIdAccelByte, StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
+	if (Party.IsValid() && &Party->GetPartyData().Get() != &PartyData)
+	{
+		const FAccelBytePartyStorageDelta UnwrittenDelta = GetUnwrittenPartyStorageDelta(PartyId);
+		if (UnwrittenDelta.IsEmpty())
+		{
+			Delta.RemoveUnchangedAttrs(Party->GetPartyData().Get());
+		}
+		else
+		{
+			FOnlinePartyData ExpectedPartyData = Party->GetPartyData().Get();
+			UnwrittenDelta.ApplyToPartyData(ExpectedPartyData);
+			Delta.RemoveUnchangedAttrs(ExpectedPartyData);
+		}
+	}
+
+	(*FoundCoalescer)->AddWrite(LocalUserIdAccelByte, Delta, FPlatformTime::Seconds());
 	return true;
 }
 
+void FOnlinePartySystemAccelByte::RecordSkippedPartyDataWrite()
+{
+	NumSkippedPartyDataWrites++;
+}
+
+void FOnlinePartySystemAccelByte::Tick(float DeltaTime)
+{
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	PartyInviteStore.Tick(CurrentTimeSeconds);
+
+	for (auto It = PartyStorageWriteCoalescers.CreateIterator(); It; ++It)
+	{
+		It->Value->Tick(CurrentTimeSeconds);
+
+		// Drop coalescers that have nothing left to do, a new one is made the next time the party is written to
+		if (It->Value->IsIdle())
+		{
+			RemovedCoalescerWriteStats.Accumulate(It->Value->GetStats());
+			It.RemoveCurrent();
+		}
+	}
+
+	// Keep snapshots in step with members joining and leaving, the leader being promoted and party data changing, so a
+	// crash leaves the most recent party on disk
+	TArray<TPair<FString, TSharedRef<FOnlinePartyAccelByte>>> PartiesToSnapshot;
+	for (const TPair<FString, FPartySnapshotVersions>& SavedVersions : PartySnapshotVersions)
+	{
+		const FPartyIDToPartyMap* FoundPartyMap = MemberIdToPartiesMap.Find(SavedVersions.Key);
+		if (FoundPartyMap == nullptr)
+		{
+			continue;
+		}
+
+		for (const TPair<TSharedRef<const FOnlinePartyIdAccelByte>, TSharedRef<FOnlinePartyAccelByte>>& KV : *FoundPartyMap)
+		{
+			const FAccelBytePartySnapshot* SavedSnapshot = PartySnapshots.Find(SavedVersions.Key);
+			const FString LeaderId = KV.Value->LeaderId.IsValid() ? StaticCastSharedPtr<const FUniqueNetIdAccelByteUser>(KV.Value->LeaderId)->GetAccelByteId() : FString();
+			if (KV.Value->GetRosterVersion() != SavedVersions.Value.RosterVersion
+				|| KV.Value->GetPartyDataVersion() != SavedVersions.Value.PartyDataVersion
+				|| SavedSnapshot == nullptr
+				|| SavedSnapshot->LeaderId != LeaderId)
+			{
+				PartiesToSnapshot.Emplace(SavedVersions.Key, KV.Value);
+			}
+			break;
+		}
+	}
+
+	for (const TPair<FString, TSharedRef<FOnlinePartyAccelByte>>& PartyToSnapshot : PartiesToSnapshot)
+	{
+		WritePartySnapshot(PartyToSnapshot.Key, PartyToSnapshot.Value.Get());
+	}
+}
+
+void FOnlinePartySystemAccelByte::SavePartySnapshot(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<FOnlinePartyAccelByte>& Party)
+{
+	WritePartySnapshot(LocalUserId->GetAccelByteId(), Party.Get());
+}
+
+void FOnlinePartySystemAccelByte::RemovePartySnapshot(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId)
+{
+	const FString& LocalAccelByteId = LocalUserId->GetAccelByteId();
+	PartySnapshots.Remove(LocalAccelByteId);
+	PartySnapshotVersions.Remove(LocalAccelByteId);
+	PartySnapshotsBeingRead.Remove(LocalAccelByteId);
+
+	if (AccelByteSubsystem->GetSettings().bEnablePartySnapshotDiskCache)
+	{
+		PartySnapshotFileWriter->QueueDelete(GetPartySnapshotFilePath(LocalAccelByteId));
+	}
+}
+
+void FOnlinePartySystemAccelByte::RemoveQueuedPartyStorages(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId)
+{
+	const FString KeyPrefix = FString::Printf(TEXT("PartyData:%s:"), *LocalUserId->GetAccelByteId());
+	for (auto It = QueuedPartyStorages.CreateIterator(); It; ++It)
+	{
+		if (It.Key().StartsWith(KeyPrefix))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FOnlinePartySystemAccelByte::GetLastKnownPartySnapshot(const FUniqueNetId& LocalUserId, FAccelBytePartySnapshot& OutSnapshot)
+{
+	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
+	const FString& LocalAccelByteId = SharedUserId->GetAccelByteId();
+	const FAccelBytePartySnapshot* FoundSnapshot = PartySnapshots.Find(LocalAccelByteId);
+	if (FoundSnapshot != nullptr)
+	{
+		OutSnapshot = *FoundSnapshot;
+		return true;
+	}
+	return false;
+}
+
+void FOnlinePartySystemAccelByte::LoadPartySnapshot(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId)
+{
+	if (!AccelByteSubsystem->GetSettings().bEnablePartySnapshotDiskCache)
+	{
+		return;
+	}
+
+	const FString& LocalAccelByteId = LocalUserId->GetAccelByteId();
+	PartySnapshotsBeingRead.Add(LocalAccelByteId);
+	PartySnapshotFileWriter->QueueRead(GetPartySnapshotFilePath(LocalAccelByteId), FOnAccelBytePartySnapshotRead::CreateThreadSafeSP(AsShared(), &FOnlinePartySystemAccelByte::OnPartySnapshotRead, LocalAccelByteId));
+}
+
+void FOnlinePartySystemAccelByte::OnPartySnapshotRead(bool bWasRead, const FAccelBytePartySnapshot& Snapshot, FString LocalAccelByteId)
+{
+	// The user logging out, or this session saving a snapshot of its own, makes what a previous session persisted out of
+	// date. A file with a write or delete still queued is out of date too, and as nothing is in memory for it that must
+	// be a delete.
+	if (PartySnapshotsBeingRead.Remove(LocalAccelByteId) == 0 || !bWasRead || PartySnapshots.Contains(LocalAccelByteId))
+	{
+		return;
+	}
+
+	if (PartySnapshotFileWriter->HasPendingOperation(GetPartySnapshotFilePath(LocalAccelByteId)))
+	{
+		return;
+	}
+
+	PartySnapshots.Add(LocalAccelByteId, Snapshot);
+}
+
+FString FOnlinePartySystemAccelByte::GetPartySnapshotFilePath(const FString& LocalAccelByteId) const
+{
+	return FPaths::ProjectSavedDir() / TEXT("AccelByte") / TEXT("PartySnapshots") / FPaths::MakeValidFileName(LocalAccelByteId + TEXT(".json"));
+}
+
+void FOnlinePartySystemAccelByte::WritePartySnapshot(const FString& LocalAccelByteId, const FOnlinePartyAccelByte& Party)
+{
+	FAccelBytePartySnapshot Snapshot = FAccelBytePartySnapshot::FromParty(Party);
+
+	FPartySnapshotVersions& SavedVersions = PartySnapshotVersions.FindOrAdd(LocalAccelByteId);
+	SavedVersions.RosterVersion = Party.GetRosterVersion();
+	SavedVersions.PartyDataVersion = Party.GetPartyDataVersion();
+
+	if (AccelByteSubsystem->GetSettings().bEnablePartySnapshotDiskCache)
+	{
+		PartySnapshotFileWriter->QueueWrite(GetPartySnapshotFilePath(LocalAccelByteId), Snapshot);
+	}
+
+	PartySnapshots.Add(LocalAccelByteId, MoveTemp(Snapshot));
+}
+
+FAccelBytePartyStorageDelta FOnlinePartySystemAccelByte::GetUnwrittenPartyStorageDelta(const FOnlinePartyId& PartyId) const
+{
+	// Coalescers are keyed by local user then party, see GetPartyStorageWriteCoalescerKey
+	const FString KeySuffix = FString::Printf(TEXT(":%s"), *PartyId.ToString());
+
+	FAccelBytePartyStorageDelta UnwrittenDelta;
+	for (const TPair<FString, TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>>& Coalescer : PartyStorageWriteCoalescers)
+	{
+		if (Coalescer.Key.EndsWith(KeySuffix))
+		{
+			UnwrittenDelta.Merge(Coalescer.Value->GetUnwrittenDelta());
+		}
+	}
+	return UnwrittenDelta;
+}
+
+FAccelBytePartyStorageWriteStats FOnlinePartySystemAccelByte::GetPartyStorageWriteStats() const
+{
+	FAccelBytePartyStorageWriteStats Stats = RemovedCoalescerWriteStats;
+	Stats.NumSkippedWrites += NumSkippedPartyDataWrites;
+	for (const TPair<FString, TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>>& Coalescer : PartyStorageWriteCoalescers)
+	{
+		Stats.Accumulate(Coalescer.Value->GetStats());
+	}
+	return Stats;
+}
+
 bool FOnlinePartySystemAccelByte::UpdatePartyMemberData(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, const FName& Namespace, const FOnlinePartyData& PartyMemberData)
 {
 	// No ability natively to add/update data on a party member. This could potentially be supported by adding per-member objects
@@ -1467,7 +1850,7 @@ bool FOnlinePartySystemAccelByte::IsMemberLeader(const FUniqueNetId& LocalUserId
 {
 	// Convert the LocalUserId to a shared reference to a FUniqueNetIdAccelByte for searching
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
@@ -1486,7 +1869,7 @@ bool FOnlinePartySystemAccelByte::IsMemberLeader(const FUniqueNetId& LocalUserId
 uint32 FOnlinePartySystemAccelByte::GetPartyMemberCount(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
@@ -1501,7 +1884,7 @@ uint32 FOnlinePartySystemAccelByte::GetPartyMemberCount(const FUniqueNetId& Loca
 FOnlinePartyConstPtr FOnlinePartySystemAccelByte::GetParty(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
@@ -1516,7 +1899,7 @@ FOnlinePartyConstPtr FOnlinePartySystemAccelByte::GetParty(const FUniqueNetId& L
 FOnlinePartyConstPtr FOnlinePartySystemAccelByte::GetParty(const FUniqueNetId& LocalUserId, const FOnlinePartyTypeId& PartyTypeId) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		for (const TPair<TSharedRef<const FOnlinePartyIdAccelByte>, TSharedRef<FOnlinePartyAccelByte>>& Pair : *FoundPartyMap)
@@ -1537,7 +1920,7 @@ FOnlinePartyConstPtr FOnlinePartySystemAccelByte::GetParty(const FUniqueNetId& L
 FOnlinePartyMemberConstPtr FOnlinePartySystemAccelByte::GetPartyMember(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, const FUniqueNetId& MemberId) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
@@ -1552,7 +1935,7 @@ FOnlinePartyMemberConstPtr FOnlinePartySystemAccelByte::GetPartyMember(const FUn
 FOnlinePartyDataConstPtr FOnlinePartySystemAccelByte::GetPartyData(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, const FName& Namespace) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
@@ -1579,7 +1962,7 @@ IOnlinePartyJoinInfoConstPtr FOnlinePartySystemAccelByte::GetAdvertisedParty(con
 bool FOnlinePartySystemAccelByte::GetJoinedParties(const FUniqueNetId& LocalUserId, TArray<TSharedRef<const FOnlinePartyId>>& OutPartyIdArray) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		OutPartyIdArray.Empty(FoundPartyMap->Num());
@@ -1595,13 +1978,14 @@ bool FOnlinePartySystemAccelByte::GetJoinedParties(const FUniqueNetId& LocalUser
 bool FOnlinePartySystemAccelByte::GetPartyMembers(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, TArray<FOnlinePartyMemberConstRef>& OutPartyMembersArray) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
 		if (FoundParty != nullptr)
 		{
-			OutPartyMembersArray = (*FoundParty)->GetAllMembers();
+			OutPartyMembersArray = (*FoundParty)->GetRoster()->Members;
+			return true;
 		}
 	}
 	return false;
@@ -1609,13 +1993,13 @@ bool FOnlinePartySystemAccelByte::GetPartyMembers(const FUniqueNetId& LocalUserI
 
 bool FOnlinePartySystemAccelByte::GetPendingInvites(const FUniqueNetId& LocalUserId, TArray<IOnlinePartyJoinInfoConstRef>& OutPendingInvitesArray) const
 {
-	const FPartyInviteArray* FoundInvites = UserIdToPartyInvitesMap.Find(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared()));
-	if (FoundInvites != nullptr)
+	TArray<TSharedRef<const FAccelBytePartyInvite>> FoundInvites;
+	if (PartyInviteStore.GetInvites(FUniqueNetIdAccelByteUser::Cast(LocalUserId).Get(), FoundInvites))
 	{
-		// If we found an array of invites for this user, then we want to add all of these invites to the out array
-		// using the join info structure that was created along with the invite structure with extra information
-		OutPendingInvitesArray.Reserve(FoundInvites->Num());
-		for (const TSharedRef<const FAccelBytePartyInvite>& Invite : *FoundInvites)
+		// If we found invites for this user, then we want to add all of these invites to the out array using the join
+		// info structure that was created along with the invite structure with extra information
+		OutPendingInvitesArray.Reserve(FoundInvites.Num());
+		for (const TSharedRef<const FAccelBytePartyInvite>& Invite : FoundInvites)
 		{
 			OutPendingInvitesArray.Add(Invite->JoinInfo);
 		}
@@ -1633,19 +2017,34 @@ bool FOnlinePartySystemAccelByte::GetPendingJoinRequests(const FUniqueNetId& Loc
 bool FOnlinePartySystemAccelByte::GetPendingInvitedUsers(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId, TArray<TSharedRef<const FUniqueNetId>>& OutPendingInvitedUserArray) const
 {
 	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
-	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(SharedUserId);
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
 	if (FoundPartyMap != nullptr)
 	{
 		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
 		if (FoundParty != nullptr)
 		{
-			OutPendingInvitedUserArray = (*FoundParty)->GetAllPendingInvitedUsers();
+			OutPendingInvitedUserArray = (*FoundParty)->GetRoster()->PendingInvitedUsers;
 			return true;
 		}
 	}
 	return false;
 }
 
+TSharedPtr<const FAccelBytePartyRoster> FOnlinePartySystemAccelByte::GetPartyRoster(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId) const
+{
+	const TSharedRef<const FUniqueNetIdAccelByteUser> SharedUserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.AsShared());
+	const FPartyIDToPartyMap* FoundPartyMap = FindPartiesForUser(SharedUserId.Get());
+	if (FoundPartyMap != nullptr)
+	{
+		const TSharedRef<FOnlinePartyAccelByte>* FoundParty = FoundPartyMap->Find(StaticCastSharedRef<const FOnlinePartyIdAccelByte>(PartyId.AsShared()));
+		if (FoundParty != nullptr)
+		{
+			return (*FoundParty)->GetRoster();
+		}
+	}
+	return nullptr;
+}
+
 FString FOnlinePartySystemAccelByte::MakeJoinInfoJson(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId)
 {
 	return TEXT("");
@@ -1673,6 +2072,8 @@ IOnlinePartyJoinInfoConstPtr FOnlinePartySystemAccelByte::ConsumePendingCommandL
 
 void FOnlinePartySystemAccelByte::DumpPartyState()
 {
+	const FAccelBytePartyStorageWriteStats Stats = GetPartyStorageWriteStats();
+	UE_LOG_AB(Display, TEXT("Party storage writes: Requested: %d; Sent: %d; Merged: %d; Skipped: %d; Retried: %d; Failed: %d"), Stats.NumRequestedWrites, Stats.NumSentWrites, Stats.NumMergedWrites, Stats.NumSkippedWrites, Stats.NumRetriedWrites, Stats.NumFailedWrites);
 }
 
 #undef ONLINE_ERROR_NAMESPACE
@@ -0,0 +1,221 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlinePartyInviteStoreAccelByte.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+
+FAccelBytePartyInviteStore::FAccelBytePartyInviteStore(const FOnAccelBytePartyInviteExpired& InOnInviteExpired)
+	: OnInviteExpired(InOnInviteExpired)
+{
+}
+
+void FAccelBytePartyInviteStore::AddInvite(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FAccelBytePartyInvite>& Invite, double CurrentTimeSeconds, double TTLSeconds, int32 MaxInvitesPerUser, TArray<TSharedRef<const FAccelBytePartyInvite>>& OutEvictedInvites)
+{
+	FUserInvites& UserInvites = InvitesByUserId.FindOrAdd(LocalUserId->GetAccelByteId());
+	UserInvites.LocalUserId = LocalUserId;
+
+	const FString PartyId = Invite->PartyId->ToString();
+	const FString& InviterId = Invite->InviterId->GetAccelByteId();
+
+	// A newer invite for the same party, or from the same inviter, replaces the older one
+	RemoveStoredInvite(UserInvites, PartyId);
+	const FString* FoundPartyId = UserInvites.PartyIdsByInviterId.Find(InviterId);
+	if (FoundPartyId != nullptr)
+	{
+		const FString PartyIdToRemove = *FoundPartyId;
+		RemoveStoredInvite(UserInvites, PartyIdToRemove);
+	}
+
+	// Make room for the new invite by evicting the oldest ones, the cap is small so a scan is cheaper than another index
+	const int32 MaxInvites = FMath::Max(MaxInvitesPerUser, 1);
+	while (UserInvites.InvitesByPartyId.Num() >= MaxInvites)
+	{
+		const FString* OldestPartyId = nullptr;
+		uint64 OldestReceivedOrder = MAX_uint64;
+		for (const TPair<FString, FStoredInvite>& StoredInvite : UserInvites.InvitesByPartyId)
+		{
+			if (StoredInvite.Value.ReceivedOrder < OldestReceivedOrder)
+			{
+				OldestReceivedOrder = StoredInvite.Value.ReceivedOrder;
+				OldestPartyId = &StoredInvite.Key;
+			}
+		}
+
+		const FString PartyIdToEvict = *OldestPartyId;
+		TSharedPtr<const FAccelBytePartyInvite> EvictedInvite = RemoveStoredInvite(UserInvites, PartyIdToEvict);
+		OutEvictedInvites.Add(EvictedInvite.ToSharedRef());
+	}
+
+	const double ExpireTimeSeconds = (TTLSeconds > 0.0) ? CurrentTimeSeconds + TTLSeconds : MAX_dbl;
+	UserInvites.InvitesByPartyId.Add(PartyId, FStoredInvite(Invite, NextReceivedOrder++, ExpireTimeSeconds));
+	UserInvites.PartyIdsByInviterId.Add(InviterId, PartyId);
+	NextExpireTimeSeconds = FMath::Min(NextExpireTimeSeconds, ExpireTimeSeconds);
+}
+
+TSharedPtr<const FAccelBytePartyInvite> FAccelBytePartyInviteStore::FindInviteForParty(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& PartyId) const
+{
+	const FUserInvites* UserInvites = InvitesByUserId.Find(LocalUserId.GetAccelByteId());
+	if (UserInvites == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FStoredInvite* StoredInvite = UserInvites->InvitesByPartyId.Find(PartyId);
+	if (StoredInvite == nullptr)
+	{
+		return nullptr;
+	}
+
+	return StoredInvite->Invite;
+}
+
+TSharedPtr<const FAccelBytePartyInvite> FAccelBytePartyInviteStore::FindInviteFromInviter(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& InviterAccelByteId) const
+{
+	const FUserInvites* UserInvites = InvitesByUserId.Find(LocalUserId.GetAccelByteId());
+	if (UserInvites == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FString* PartyId = UserInvites->PartyIdsByInviterId.Find(InviterAccelByteId);
+	if (PartyId == nullptr)
+	{
+		return nullptr;
+	}
+
+	return UserInvites->InvitesByPartyId.FindChecked(*PartyId).Invite;
+}
+
+TSharedPtr<const FAccelBytePartyInvite> FAccelBytePartyInviteStore::RemoveInviteForParty(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& PartyId)
+{
+	FUserInvites* UserInvites = InvitesByUserId.Find(LocalUserId.GetAccelByteId());
+	if (UserInvites == nullptr)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<const FAccelBytePartyInvite> RemovedInvite = RemoveStoredInvite(*UserInvites, PartyId);
+	if (UserInvites->InvitesByPartyId.Num() <= 0)
+	{
+		InvitesByUserId.Remove(LocalUserId.GetAccelByteId());
+	}
+	return RemovedInvite;
+}
+
+TSharedPtr<const FAccelBytePartyInvite> FAccelBytePartyInviteStore::RemoveInviteFromInviter(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& InviterAccelByteId)
+{
+	FUserInvites* UserInvites = InvitesByUserId.Find(LocalUserId.GetAccelByteId());
+	if (UserInvites == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FString* PartyId = UserInvites->PartyIdsByInviterId.Find(InviterAccelByteId);
+	if (PartyId == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FString PartyIdToRemove = *PartyId;
+	return RemoveInviteForParty(LocalUserId, PartyIdToRemove);
+}
+
+bool FAccelBytePartyInviteStore::RemoveAllInvites(const FUniqueNetIdAccelByteUser& LocalUserId)
+{
+	return InvitesByUserId.Remove(LocalUserId.GetAccelByteId()) > 0;
+}
+
+bool FAccelBytePartyInviteStore::GetInvites(const FUniqueNetIdAccelByteUser& LocalUserId, TArray<TSharedRef<const FAccelBytePartyInvite>>& OutInvites) const
+{
+	const FUserInvites* UserInvites = InvitesByUserId.Find(LocalUserId.GetAccelByteId());
+	if (UserInvites == nullptr)
+	{
+		return false;
+	}
+
+	TArray<const FStoredInvite*> StoredInvites;
+	StoredInvites.Reserve(UserInvites->InvitesByPartyId.Num());
+	for (const TPair<FString, FStoredInvite>& StoredInvite : UserInvites->InvitesByPartyId)
+	{
+		StoredInvites.Add(&StoredInvite.Value);
+	}
+	StoredInvites.Sort([](const FStoredInvite& A, const FStoredInvite& B) { return A.ReceivedOrder < B.ReceivedOrder; });
+
+	OutInvites.Reserve(OutInvites.Num() + StoredInvites.Num());
+	for (const FStoredInvite* StoredInvite : StoredInvites)
+	{
+		OutInvites.Add(StoredInvite->Invite);
+	}
+	return true;
+}
+
+int32 FAccelBytePartyInviteStore::GetNumInvites(const FUniqueNetIdAccelByteUser& LocalUserId) const
+{
+	const FUserInvites* UserInvites = InvitesByUserId.Find(LocalUserId.GetAccelByteId());
+	return (UserInvites != nullptr) ? UserInvites->InvitesByPartyId.Num() : 0;
+}
+
+int32 FAccelBytePartyInviteStore::GetTotalNumInvites() const
+{
+	int32 NumInvites = 0;
+	for (const TPair<FString, FUserInvites>& UserInvites : InvitesByUserId)
+	{
+		NumInvites += UserInvites.Value.InvitesByPartyId.Num();
+	}
+	return NumInvites;
+}
+
+void FAccelBytePartyInviteStore::Tick(double CurrentTimeSeconds)
+{
+	if (CurrentTimeSeconds < NextExpireTimeSeconds)
+	{
+		return;
+	}
+
+	// Collect the expired invites before firing any delegates, as handlers are free to add or remove invites
+	TArray<TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<const FAccelBytePartyInvite>>> ExpiredInvites;
+	NextExpireTimeSeconds = MAX_dbl;
+	for (auto UserIt = InvitesByUserId.CreateIterator(); UserIt; ++UserIt)
+	{
+		FUserInvites& UserInvites = UserIt->Value;
+		for (auto InviteIt = UserInvites.InvitesByPartyId.CreateIterator(); InviteIt; ++InviteIt)
+		{
+			const FStoredInvite& StoredInvite = InviteIt->Value;
+			if (StoredInvite.ExpireTimeSeconds <= CurrentTimeSeconds)
+			{
+				ExpiredInvites.Emplace(UserInvites.LocalUserId.ToSharedRef(), StoredInvite.Invite);
+				UserInvites.PartyIdsByInviterId.Remove(StoredInvite.Invite->InviterId->GetAccelByteId());
+				InviteIt.RemoveCurrent();
+			}
+			else
+			{
+				NextExpireTimeSeconds = FMath::Min(NextExpireTimeSeconds, StoredInvite.ExpireTimeSeconds);
+			}
+		}
+
+		if (UserInvites.InvitesByPartyId.Num() <= 0)
+		{
+			UserIt.RemoveCurrent();
+		}
+	}
+
+	for (const TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<const FAccelBytePartyInvite>>& ExpiredInvite : ExpiredInvites)
+	{
+		OnInviteExpired.ExecuteIfBound(ExpiredInvite.Key, ExpiredInvite.Value);
+	}
+}
+
+TSharedPtr<const FAccelBytePartyInvite> FAccelBytePartyInviteStore::RemoveStoredInvite(FUserInvites& UserInvites, const FString& PartyId)
+{
+	FStoredInvite* StoredInvite = UserInvites.InvitesByPartyId.Find(PartyId);
+	if (StoredInvite == nullptr)
+	{
+		return nullptr;
+	}
+
+	TSharedRef<const FAccelBytePartyInvite> RemovedInvite = StoredInvite->Invite;
+	UserInvites.PartyIdsByInviterId.Remove(RemovedInvite->InviterId->GetAccelByteId());
+	UserInvites.InvitesByPartyId.Remove(PartyId);
+	return RemovedInvite;
+}
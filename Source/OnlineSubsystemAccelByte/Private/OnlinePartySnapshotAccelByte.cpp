@@ -0,0 +1,218 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlinePartySnapshotAccelByte.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+#define PARTY_SNAPSHOT_FORMAT_VERSION 1
+#define PARTY_SNAPSHOT_FIELD_FORMAT_VERSION TEXT("formatVersion")
+#define PARTY_SNAPSHOT_FIELD_PARTY_ID TEXT("partyId")
+#define PARTY_SNAPSHOT_FIELD_LEADER_ID TEXT("leaderId")
+#define PARTY_SNAPSHOT_FIELD_MEMBERS TEXT("members")
+#define PARTY_SNAPSHOT_FIELD_MEMBER_ID TEXT("userId")
+#define PARTY_SNAPSHOT_FIELD_MEMBER_DISPLAY_NAME TEXT("displayName")
+#define PARTY_SNAPSHOT_FIELD_PARTY_DATA TEXT("partyData")
+#define PARTY_SNAPSHOT_FIELD_SAVED_AT TEXT("savedAt")
+
+FAccelBytePartySnapshot FAccelBytePartySnapshot::FromParty(const FOnlinePartyAccelByte& Party)
+{
+	FAccelBytePartySnapshot Snapshot;
+	Snapshot.PartyId = Party.PartyId->ToString();
+	if (Party.LeaderId.IsValid())
+	{
+		Snapshot.LeaderId = StaticCastSharedPtr<const FUniqueNetIdAccelByteUser>(Party.LeaderId)->GetAccelByteId();
+	}
+
+	Party.ForEachMember([&Snapshot](const FOnlinePartyMemberAccelByte& Member) {
+		FAccelBytePartySnapshotMember& SnapshotMember = Snapshot.Members.AddDefaulted_GetRef();
+		SnapshotMember.AccelByteId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(Member.GetUserId())->GetAccelByteId();
+		SnapshotMember.DisplayName = Member.GetDisplayName();
+		return true;
+	});
+
+	Party.GetPartyData()->ToJsonFull(Snapshot.PartyDataJson);
+	Snapshot.SavedAt = FDateTime::UtcNow();
+	return Snapshot;
+}
+
+FString FAccelBytePartySnapshot::ToJsonString() const
+{
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_FORMAT_VERSION, PARTY_SNAPSHOT_FORMAT_VERSION);
+	JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_PARTY_ID, PartyId);
+	JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_LEADER_ID, LeaderId);
+	JsonWriter->WriteArrayStart(PARTY_SNAPSHOT_FIELD_MEMBERS);
+	for (const FAccelBytePartySnapshotMember& Member : Members)
+	{
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_MEMBER_ID, Member.AccelByteId);
+		JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_MEMBER_DISPLAY_NAME, Member.DisplayName);
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+	JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_PARTY_DATA, PartyDataJson);
+	JsonWriter->WriteValue(PARTY_SNAPSHOT_FIELD_SAVED_AT, SavedAt.ToIso8601());
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+	return JsonString;
+}
+
+bool FAccelBytePartySnapshot::FromJsonString(const FString& JsonString, FAccelBytePartySnapshot& OutSnapshot)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	// Snapshots written in an older format are ignored, a new one is written as soon as the party is restored
+	int32 FormatVersion = 0;
+	if (!JsonObject->TryGetNumberField(PARTY_SNAPSHOT_FIELD_FORMAT_VERSION, FormatVersion) || FormatVersion != PARTY_SNAPSHOT_FORMAT_VERSION)
+	{
+		return false;
+	}
+
+	FAccelBytePartySnapshot Snapshot;
+	FString SavedAtStr;
+	const TArray<TSharedPtr<FJsonValue>>* MemberValues = nullptr;
+	if (!JsonObject->TryGetStringField(PARTY_SNAPSHOT_FIELD_PARTY_ID, Snapshot.PartyId)
+		|| !JsonObject->TryGetStringField(PARTY_SNAPSHOT_FIELD_LEADER_ID, Snapshot.LeaderId)
+		|| !JsonObject->TryGetArrayField(PARTY_SNAPSHOT_FIELD_MEMBERS, MemberValues)
+		|| !JsonObject->TryGetStringField(PARTY_SNAPSHOT_FIELD_PARTY_DATA, Snapshot.PartyDataJson)
+		|| !JsonObject->TryGetStringField(PARTY_SNAPSHOT_FIELD_SAVED_AT, SavedAtStr)
+		|| !FDateTime::ParseIso8601(*SavedAtStr, Snapshot.SavedAt))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& MemberValue : *MemberValues)
+	{
+		const TSharedPtr<FJsonObject>* MemberObject = nullptr;
+		if (!MemberValue.IsValid() || !MemberValue->TryGetObject(MemberObject))
+		{
+			return false;
+		}
+
+		FAccelBytePartySnapshotMember& Member = Snapshot.Members.AddDefaulted_GetRef();
+		if (!(*MemberObject)->TryGetStringField(PARTY_SNAPSHOT_FIELD_MEMBER_ID, Member.AccelByteId)
+			|| !(*MemberObject)->TryGetStringField(PARTY_SNAPSHOT_FIELD_MEMBER_DISPLAY_NAME, Member.DisplayName))
+		{
+			return false;
+		}
+	}
+
+	OutSnapshot = MoveTemp(Snapshot);
+	return true;
+}
+
+#undef PARTY_SNAPSHOT_FORMAT_VERSION
+#undef PARTY_SNAPSHOT_FIELD_FORMAT_VERSION
+#undef PARTY_SNAPSHOT_FIELD_PARTY_ID
+#undef PARTY_SNAPSHOT_FIELD_LEADER_ID
+#undef PARTY_SNAPSHOT_FIELD_MEMBERS
+#undef PARTY_SNAPSHOT_FIELD_MEMBER_ID
+#undef PARTY_SNAPSHOT_FIELD_MEMBER_DISPLAY_NAME
+#undef PARTY_SNAPSHOT_FIELD_PARTY_DATA
+#undef PARTY_SNAPSHOT_FIELD_SAVED_AT
+
+void FAccelBytePartySnapshotFileWriter::QueueWrite(const FString& FilePath, const FAccelBytePartySnapshot& Snapshot)
+{
+	QueueOperation(FilePath, TOptional<FAccelBytePartySnapshot>(Snapshot));
+}
+
+void FAccelBytePartySnapshotFileWriter::QueueDelete(const FString& FilePath)
+{
+	QueueOperation(FilePath, TOptional<FAccelBytePartySnapshot>());
+}
+
+bool FAccelBytePartySnapshotFileWriter::HasPendingOperation(const FString& FilePath) const
+{
+	FScopeLock ScopeLock(&GenerationLock);
+	return LatestGenerations.Contains(FilePath);
+}
+
+void FAccelBytePartySnapshotFileWriter::QueueRead(const FString& FilePath, const FOnAccelBytePartySnapshotRead& OnRead)
+{
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Writer = AsShared(), FilePath, OnRead]() {
+		Writer->RunRead(FilePath, OnRead);
+	});
+}
+
+void FAccelBytePartySnapshotFileWriter::QueueOperation(const FString& FilePath, TOptional<FAccelBytePartySnapshot>&& Snapshot)
+{
+	uint64 Generation = 0;
+	{
+		FScopeLock ScopeLock(&GenerationLock);
+		Generation = NextGeneration++;
+		LatestGenerations.Add(FilePath, Generation);
+	}
+
+	// The task holds a reference to the writer, so that it outlives an interface that is destroyed while writing
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Writer = AsShared(), FilePath, Generation, Snapshot = MoveTemp(Snapshot)]() {
+		Writer->RunOperation(FilePath, Generation, Snapshot);
+	});
+}
+
+void FAccelBytePartySnapshotFileWriter::RunOperation(const FString& FilePath, uint64 Generation, const TOptional<FAccelBytePartySnapshot>& Snapshot)
+{
+	FScopeLock FileScopeLock(&FileLock);
+
+	{
+		FScopeLock ScopeLock(&GenerationLock);
+		const uint64* LatestGeneration = LatestGenerations.Find(FilePath);
+		if (LatestGeneration == nullptr || *LatestGeneration != Generation)
+		{
+			return;
+		}
+	}
+
+	if (Snapshot.IsSet())
+	{
+		if (!FFileHelper::SaveStringToFile(Snapshot->ToJsonString(), *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG_AB(Warning, TEXT("Failed to persist party snapshot to '%s'"), *FilePath);
+		}
+	}
+	else
+	{
+		IFileManager::Get().Delete(*FilePath, false, false, true);
+	}
+
+	FScopeLock ScopeLock(&GenerationLock);
+	if (LatestGenerations.FindRef(FilePath) == Generation)
+	{
+		LatestGenerations.Remove(FilePath);
+	}
+}
+
+void FAccelBytePartySnapshotFileWriter::RunRead(const FString& FilePath, const FOnAccelBytePartySnapshotRead& OnRead)
+{
+	FString JsonString;
+	bool bWasLoaded = false;
+	{
+		FScopeLock FileScopeLock(&FileLock);
+		bWasLoaded = FFileHelper::LoadFileToString(JsonString, *FilePath);
+	}
+
+	FAccelBytePartySnapshot Snapshot;
+	const bool bWasRead = bWasLoaded && FAccelBytePartySnapshot::FromJsonString(JsonString, Snapshot);
+	if (bWasLoaded && !bWasRead)
+	{
+		UE_LOG_AB(Warning, TEXT("Ignoring unreadable party snapshot file '%s'"), *FilePath);
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [OnRead, bWasRead, Snapshot = MoveTemp(Snapshot)]() {
+		OnRead.ExecuteIfBound(bWasRead, Snapshot);
+	});
+}
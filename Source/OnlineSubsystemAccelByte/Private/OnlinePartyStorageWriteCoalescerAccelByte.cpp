@@ -0,0 +1,268 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlinePartyStorageWriteCoalescerAccelByte.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Interfaces/OnlinePartyInterface.h"
+#include "Dom/JsonObject.h"
+
+FAccelBytePartyStorageDelta FAccelBytePartyStorageDelta::FromDirtyPartyData(const FOnlinePartyData& PartyData)
+{
+	FOnlineKeyValuePairs<FString, FVariantData> DirtyAttrs;
+	TArray<FString> RemovedAttrs;
+	PartyData.GetDirtyKeyValAttrs(DirtyAttrs, RemovedAttrs);
+
+	FAccelBytePartyStorageDelta Delta;
+	for (const TPair<FString, FVariantData>& Attr : DirtyAttrs)
+	{
+		Delta.UpdatedAttrs.Add(Attr.Key, Attr.Value);
+	}
+	Delta.RemovedAttrs.Append(RemovedAttrs);
+	return Delta;
+}
+
+FAccelBytePartyStorageDelta FAccelBytePartyStorageDelta::FromPartyStorage(const FOnlinePartyData& CurrentPartyData, const TMap<FString, FVariantData>& StorageAttrs, const FAccelBytePartyStorageDelta& UnwrittenDelta)
+{
+	FAccelBytePartyStorageDelta Delta;
+
+	FVariantData CurrentValue;
+	for (const TPair<FString, FVariantData>& Attr : StorageAttrs)
+	{
+		if (UnwrittenDelta.TouchesAttr(Attr.Key))
+		{
+			continue;
+		}
+
+		if (!CurrentPartyData.GetAttribute(Attr.Key, CurrentValue) || CurrentValue != Attr.Value)
+		{
+			Delta.UpdatedAttrs.Add(Attr.Key, Attr.Value);
+		}
+	}
+
+	for (const TPair<FString, FVariantData>& Attr : CurrentPartyData.GetKeyValAttrs())
+	{
+		if (!StorageAttrs.Contains(Attr.Key) && !UnwrittenDelta.TouchesAttr(Attr.Key))
+		{
+			Delta.RemovedAttrs.Add(Attr.Key);
+		}
+	}
+	return Delta;
+}
+
+void FAccelBytePartyStorageDelta::ReadPartyStorage(const FJsonObject& StorageObject, TMap<FString, FVariantData>& OutStorageAttrs)
+{
+	OutStorageAttrs.Reserve(StorageObject.Values.Num());
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : StorageObject.Values)
+	{
+		if (!Field.Value.IsValid())
+		{
+			continue;
+		}
+
+		// Same parsing as FOnlinePartyData::FromJson, which strips the type suffix that ApplyToJsonObject adds
+		FString AttrName;
+		FVariantData AttrValue;
+		if (AttrValue.FromJsonValue(Field.Key, Field.Value.ToSharedRef(), AttrName))
+		{
+			OutStorageAttrs.Add(MoveTemp(AttrName), MoveTemp(AttrValue));
+		}
+	}
+}
+
+void FAccelBytePartyStorageDelta::Merge(const FAccelBytePartyStorageDelta& Newer)
+{
+	for (const TPair<FString, FVariantData>& Attr : Newer.UpdatedAttrs)
+	{
+		UpdatedAttrs.Add(Attr.Key, Attr.Value);
+		RemovedAttrs.Remove(Attr.Key);
+	}
+
+	for (const FString& Key : Newer.RemovedAttrs)
+	{
+		UpdatedAttrs.Remove(Key);
+		RemovedAttrs.Add(Key);
+	}
+}
+
+bool FAccelBytePartyStorageDelta::IsEmpty() const
+{
+	return UpdatedAttrs.Num() <= 0 && RemovedAttrs.Num() <= 0;
+}
+
+bool FAccelBytePartyStorageDelta::TouchesAttr(const FString& Key) const
+{
+	return UpdatedAttrs.Contains(Key) || RemovedAttrs.Contains(Key);
+}
+
+void FAccelBytePartyStorageDelta::RemoveUnchangedAttrs(const FOnlinePartyData& CurrentPartyData)
+{
+	FVariantData CurrentValue;
+	for (auto It = UpdatedAttrs.CreateIterator(); It; ++It)
+	{
+		if (CurrentPartyData.GetAttribute(It->Key, CurrentValue) && CurrentValue == It->Value)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = RemovedAttrs.CreateIterator(); It; ++It)
+	{
+		if (!CurrentPartyData.GetAttribute(*It, CurrentValue))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FAccelBytePartyStorageDelta::ApplyToJsonObject(const TSharedRef<FJsonObject>& JsonObject) const
+{
+	for (const TPair<FString, FVariantData>& Attr : UpdatedAttrs)
+	{
+		// Party storage is read back through FOnlinePartyData::FromJson, which expects the type suffix on each field
+		Attr.Value.AddToJsonObject(JsonObject, Attr.Key, true);
+	}
+
+	for (const FString& Key : RemovedAttrs)
+	{
+		JsonObject->RemoveField(Key);
+	}
+}
+
+void FAccelBytePartyStorageDelta::ApplyToPartyData(FOnlinePartyData& PartyData) const
+{
+	for (const TPair<FString, FVariantData>& Attr : UpdatedAttrs)
+	{
+		PartyData.SetAttribute(Attr.Key, Attr.Value);
+	}
+
+	for (const FString& Key : RemovedAttrs)
+	{
+		PartyData.RemoveAttribute(Key);
+	}
+}
+
+void FAccelBytePartyStorageWriteStats::Accumulate(const FAccelBytePartyStorageWriteStats& Other)
+{
+	NumRequestedWrites += Other.NumRequestedWrites;
+	NumSentWrites += Other.NumSentWrites;
+	NumMergedWrites += Other.NumMergedWrites;
+	NumSkippedWrites += Other.NumSkippedWrites;
+	NumRetriedWrites += Other.NumRetriedWrites;
+	NumFailedWrites += Other.NumFailedWrites;
+}
+
+FAccelBytePartyStorageWriteCoalescer::FAccelBytePartyStorageWriteCoalescer(const FAccelBytePartyStorageWriteFunction& InWriteFunction, double InCoalesceWindowSeconds, int32 InMaxRetries)
+	: WriteFunction(InWriteFunction)
+	, CoalesceWindowSeconds(InCoalesceWindowSeconds)
+	, MaxRetries(InMaxRetries)
+{
+}
+
+void FAccelBytePartyStorageWriteCoalescer::AddWrite(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const FAccelBytePartyStorageDelta& Delta, double CurrentTimeSeconds)
+{
+	Stats.NumRequestedWrites++;
+
+	// Nothing would change, so there is no reason to send or even hold on to this write
+	if (Delta.IsEmpty())
+	{
+		Stats.NumSkippedWrites++;
+		return;
+	}
+
+	if (NumPendingRequests <= 0)
+	{
+		PendingSinceTimeSeconds = CurrentTimeSeconds;
+	}
+	else
+	{
+		Stats.NumMergedWrites++;
+	}
+
+	PendingDelta.Merge(Delta);
+	if (!WriterUserId.IsValid())
+	{
+		WriterUserId = LocalUserId;
+	}
+	NumPendingRequests++;
+}
+
+void FAccelBytePartyStorageWriteCoalescer::Tick(double CurrentTimeSeconds)
+{
+	if (bIsWriteInFlight || NumPendingRequests <= 0 || !WriterUserId.IsValid())
+	{
+		return;
+	}
+
+	if (CurrentTimeSeconds - PendingSinceTimeSeconds < CoalesceWindowSeconds)
+	{
+		return;
+	}
+
+	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Writing %d party storage attributes merged from %d requests"), PendingDelta.UpdatedAttrs.Num() + PendingDelta.RemovedAttrs.Num(), NumPendingRequests);
+
+	InFlightDelta = MoveTemp(PendingDelta);
+	const FAccelBytePartyStorageDelta DeltaToWrite = InFlightDelta;
+	InFlightRetryCount = PendingRetryCount;
+	InFlightSentTimeSeconds = CurrentTimeSeconds;
+	bIsWriteInFlight = true;
+
+	PendingDelta = FAccelBytePartyStorageDelta();
+	NumPendingRequests = 0;
+	PendingRetryCount = 0;
+	Stats.NumSentWrites++;
+
+	// Pass a copy of the delta, as the write function is allowed to complete before returning
+	WriteFunction(WriterUserId.ToSharedRef(), DeltaToWrite, FOnPartyStorageWriteComplete::CreateThreadSafeSP(AsShared(), &FAccelBytePartyStorageWriteCoalescer::OnWriteComplete));
+}
+
+bool FAccelBytePartyStorageWriteCoalescer::IsIdle() const
+{
+	return !bIsWriteInFlight && NumPendingRequests <= 0;
+}
+
+FAccelBytePartyStorageDelta FAccelBytePartyStorageWriteCoalescer::GetUnwrittenDelta() const
+{
+	FAccelBytePartyStorageDelta UnwrittenDelta = InFlightDelta;
+	UnwrittenDelta.Merge(PendingDelta);
+	return UnwrittenDelta;
+}
+
+const FAccelBytePartyStorageWriteStats& FAccelBytePartyStorageWriteCoalescer::GetStats() const
+{
+	return Stats;
+}
+
+void FAccelBytePartyStorageWriteCoalescer::OnWriteComplete(bool bWasSuccessful)
+{
+	bIsWriteInFlight = false;
+
+	if (bWasSuccessful)
+	{
+		InFlightDelta = FAccelBytePartyStorageDelta();
+		return;
+	}
+
+	if (InFlightRetryCount >= MaxRetries)
+	{
+		UE_LOG(LogAccelByteOSSParty, Warning, TEXT("Dropping %d party storage attribute changes after %d failed writes"), InFlightDelta.UpdatedAttrs.Num() + InFlightDelta.RemovedAttrs.Num(), InFlightRetryCount + 1);
+		InFlightDelta = FAccelBytePartyStorageDelta();
+		Stats.NumFailedWrites++;
+		return;
+	}
+
+	// Put the failed changes back underneath anything that was changed while they were in flight, so that the newer
+	// values still win, and send them again on the next tick
+	FAccelBytePartyStorageDelta RetryDelta = MoveTemp(InFlightDelta);
+	RetryDelta.Merge(PendingDelta);
+	PendingDelta = MoveTemp(RetryDelta);
+	InFlightDelta = FAccelBytePartyStorageDelta();
+
+	if (NumPendingRequests <= 0)
+	{
+		PendingSinceTimeSeconds = InFlightSentTimeSeconds;
+	}
+	NumPendingRequests++;
+	PendingRetryCount = FMath::Max(PendingRetryCount, InFlightRetryCount + 1);
+	Stats.NumRetriedWrites++;
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineQosManagerAccelByte.h"
+#include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "OnlineIdentityInterfaceAccelByte.h"
+#include "Api/AccelByteQosApi.h"
+
+FOnlineQosManagerAccelByte::FOnlineQosManagerAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
+	: AccelByteSubsystem(InSubsystem)
+{
+}
+
+void FOnlineQosManagerAccelByte::StartLatencyRefresh(int32 LocalUserNum)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("LocalUserNum: %d"), LocalUserNum);
+
+	// Latencies are per machine rather than per user, so keep using the first user that started a refresh
+	if (RefreshUserNum != INVALID_CONTROLLERID && RefreshUserNum != LocalUserNum)
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Latencies are already being refreshed for user %d"), RefreshUserNum);
+		return;
+	}
+
+	RefreshUserNum = LocalUserNum;
+	RefreshLatencies();
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
+}
+
+void FOnlineQosManagerAccelByte::StopLatencyRefresh()
+{
+	RefreshUserNum = INVALID_CONTROLLERID;
+}
+
+void FOnlineQosManagerAccelByte::Tick(float DeltaTime)
+{
+	if (RefreshUserNum == INVALID_CONTROLLERID || bIsRefreshInFlight)
+	{
+		return;
+	}
+
+	if (FPlatformTime::Seconds() - LastRefreshTimeSeconds >= AccelByteSubsystem->GetSettings().QosLatencyRefreshIntervalSeconds)
+	{
+		RefreshLatencies();
+	}
+}
+
+void FOnlineQosManagerAccelByte::RefreshLatencies()
+{
+	if (bIsRefreshInFlight)
+	{
+		return;
+	}
+
+	// Stop refreshing once the user we were refreshing for has logged out, the next login will start it again
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	const AccelByte::FApiClientPtr ApiClient = AccelByteSubsystem->GetApiClient(RefreshUserNum);
+	if (!IdentityInterface.IsValid() || IdentityInterface->GetLoginStatus(RefreshUserNum) != ELoginStatus::LoggedIn || !ApiClient.IsValid())
+	{
+		UE_LOG_AB(Verbose, TEXT("Stopping QoS latency refresh as user %d is no longer logged in"), RefreshUserNum);
+		StopLatencyRefresh();
+		return;
+	}
+
+	bIsRefreshInFlight = true;
+	LastRefreshTimeSeconds = FPlatformTime::Seconds();
+
+	const THandler<TArray<TPair<FString, float>>> OnGetServerLatenciesSuccessDelegate = THandler<TArray<TPair<FString, float>>>::CreateThreadSafeSP(AsShared(), &FOnlineQosManagerAccelByte::OnGetServerLatenciesSuccess);
+	const FErrorHandler OnGetServerLatenciesErrorDelegate = FErrorHandler::CreateThreadSafeSP(AsShared(), &FOnlineQosManagerAccelByte::OnGetServerLatenciesError);
+	ApiClient->Qos.GetServerLatencies(OnGetServerLatenciesSuccessDelegate, OnGetServerLatenciesErrorDelegate);
+}
+
+void FOnlineQosManagerAccelByte::OnGetServerLatenciesSuccess(const TArray<TPair<FString, float>>& Result)
+{
+	bIsRefreshInFlight = false;
+	AddLatencySamples(Result);
+}
+
+void FOnlineQosManagerAccelByte::OnGetServerLatenciesError(int32 ErrorCode, const FString& ErrorMessage)
+{
+	// Keep the last known latencies, they are still a better estimate than nothing and the next refresh will retry
+	bIsRefreshInFlight = false;
+	UE_LOG_AB(Warning, TEXT("Failed to refresh QoS server latencies! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
+}
+
+void FOnlineQosManagerAccelByte::AddLatencySamples(const TArray<TPair<FString, float>>& Samples)
+{
+	if (Samples.Num() <= 0)
+	{
+		return;
+	}
+
+	{
+		FScopeLock ScopeLock(&RegionLatenciesLock);
+		const double CurrentTimeSeconds = FPlatformTime::Seconds();
+		const double SmoothingFactor = AccelByteSubsystem->GetSettings().QosLatencySmoothingFactor;
+		for (const TPair<FString, float>& Sample : Samples)
+		{
+			FAccelByteQosRegionLatency& Region = RegionLatencies.FindOrAdd(Sample.Key);
+			if (Region.SampleCount == 0)
+			{
+				Region.LatencyMs = Sample.Value;
+				Region.JitterMs = 0.0;
+			}
+			else
+			{
+				const double Deviation = FMath::Abs(Sample.Value - Region.LatencyMs);
+				Region.JitterMs += SmoothingFactor * (Deviation - Region.JitterMs);
+				Region.LatencyMs += SmoothingFactor * (Sample.Value - Region.LatencyMs);
+			}
+			Region.SampleCount++;
+			Region.LastUpdatedTimeSeconds = CurrentTimeSeconds;
+		}
+	}
+
+	TriggerOnQosLatenciesUpdatedDelegates();
+}
+
+bool FOnlineQosManagerAccelByte::GetLatencies(TArray<TPair<FString, float>>& OutLatencies) const
+{
+	FScopeLock ScopeLock(&RegionLatenciesLock);
+	OutLatencies.Reset(RegionLatencies.Num());
+	for (const TPair<FString, FAccelByteQosRegionLatency>& Region : RegionLatencies)
+	{
+		OutLatencies.Emplace(Region.Key, static_cast<float>(Region.Value.LatencyMs));
+	}
+	return OutLatencies.Num() > 0;
+}
+
+TMap<FString, FAccelByteQosRegionLatency> FOnlineQosManagerAccelByte::GetRegionLatencies() const
+{
+	FScopeLock ScopeLock(&RegionLatenciesLock);
+	return RegionLatencies;
+}
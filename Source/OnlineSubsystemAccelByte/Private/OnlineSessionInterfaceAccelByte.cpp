@@ -6,6 +6,7 @@
 #include "OnlineSubsystemAccelByteTypes.h"
 #include "OnlineSubsystemAccelByte.h"
 #include "OnlineSubsystemAccelByteModule.h"
+#include "OnlineSubsystemAccelByteUtils.h"
 #include "OnlineSessionSettings.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemUtils.h"
@@ -33,6 +34,10 @@
 #include "AsyncTasks/OnlineAsyncTaskAccelByteEnqueueJoinableSession.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteDequeueJoinableSession.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteBanUser.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByteUpdateSession.h"
+#include "OnlineQosManagerAccelByte.h"
+#include "OnlineSessionPingManagerAccelByte.h"
+#include "OnlineNotificationDispatcherAccelByte.h"
 
 bool GetConnectionStringFromSessionInfo(TSharedPtr<FOnlineSessionInfoAccelByte> SessionInfo, FString& ConnectInfo, int32 PortOverride = 0)
 {
@@ -55,6 +60,45 @@ bool GetConnectionStringFromSessionInfo(TSharedPtr<FOnlineSessionInfoAccelByte>
 	}
 }
 
+/** Version of the session layout written by AppendSessionToPacket, LAN responses with any other version are ignored */
+#define LAN_SESSION_PACKET_VERSION_ACCELBYTE 2
+
+/** Setting key token that ends the list of settings in a LAN packet */
+#define LAN_SETTING_KEY_TOKEN_END 0
+
+/** Setting key token for a setting whose name follows as a string */
+#define LAN_SETTING_KEY_TOKEN_LITERAL 1
+
+/** Offset added to the index of an interned setting name to get its key token */
+#define LAN_SETTING_KEY_TOKEN_INTERNED_OFFSET 2
+
+/**
+ * Setting names common enough to be sent as a one byte index into this list rather than by name. Hosts and clients must
+ * agree on the indices, so only ever append to this list, removing or reordering entries needs a packet version bump.
+ */
+const TArray<FName>& GetLANInternedSettingKeys()
+{
+	static const TArray<FName> InternedSettingKeys = {
+		SETTING_GAMEMODE,
+		SETTING_MAPNAME,
+		SETTING_NUMBOTS,
+		SETTING_REGION,
+		SETTING_MATCHING_HOPPER,
+		SETTING_MATCHING_TIMEOUT,
+		SETTING_SESSION_TEMPLATE_NAME,
+		SETTING_CHANNELNAME,
+		SETTING_SUBGAMEMODE,
+		SETTING_SEARCH_TYPE,
+		SETTING_SESSION_LOCAL,
+		SETTING_SESSION_SERVER_NAME,
+		SETTING_SESSION_START_TIME,
+		SETTING_SESSION_END_TIME,
+		FName(SETTING_ACCELBYTE_ICE_ENABLED),
+		FName(SETTING_SERVER_DEDICATED_REGISTER_SESSION),
+	};
+	return InternedSettingKeys;
+}
+
 FOnlineSessionAccelByte::FOnlineSessionAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
 	: AccelByteSubsystem(InSubsystem)
 	, SessionSearchHandle(nullptr)
@@ -124,9 +168,7 @@ void FOnlineSessionAccelByte::OnMatchmakingNotificationReceived(const FAccelByte
 			PendingMatchesUnderConstruction.Add(Notification.MatchId, ConstructMatchInfo);
 		}
 		
-		bool bAutoSendReadyConsent = false;
-		GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bAutoSendReadyConsent"), bAutoSendReadyConsent, GEngineIni);
-		if(bAutoSendReadyConsent)
+		if (AccelByteSubsystem->GetSettings().bAutoSendReadyConsent)
 		{
 			// TODO : @damar how to get the player index?
 			SendReady(0, Notification.MatchId);
@@ -168,11 +210,14 @@ void FOnlineSessionAccelByte::CreatePendingMatchFromDSNotif(const FAccelByteMode
 	MatchInfo.ServerName = Notification.PodName;
 	MatchInfo.Ip = Notification.Ip;
 	MatchInfo.Port = Notification.Port;
+	MatchInfo.Region = Notification.Region;
 	MatchInfo.bIsLocalServer = Notification.Region.IsEmpty();
 	MatchInfo.ReceivedTimeSeconds = FPlatformTime::Seconds();
 	MatchInfo.NotificationMessage = Notification.Message;
 	
-	ConstructSessionResultForMatch(MatchInfo);
+	// Rather than joining whichever server notification arrives first, wait a short window for other candidates and
+	// join the best of them from Tick
+	AddPendingMatchCandidate(MatchInfo);
 	
 	// We also want to query the session information itself to get the current players that are in our session
 	// to fill on our OSS side, we do this after we get a DS for this session, as we probably will have the
@@ -182,6 +227,29 @@ void FOnlineSessionAccelByte::CreatePendingMatchFromDSNotif(const FAccelByteMode
 	// GetSessionInformation(NewPendingMatch.MatchId);
 }
 
+void FOnlineSessionAccelByte::AddPendingMatchCandidate(const FAccelBytePendingMatchInfo& PendingMatch)
+{
+	// A later notification for the same match, such as BUSY after READY, carries the most recent server state. Only take
+	// the server fields from it, so that the matchmaking fields and the age of the candidate are kept for scoring.
+	FAccelBytePendingMatchInfo* ExistingCandidate = PendingMatchesToFilter.FindByPredicate([&PendingMatch](const FAccelBytePendingMatchInfo& Candidate) {
+		return Candidate.MatchId == PendingMatch.MatchId;
+	});
+	if (ExistingCandidate != nullptr)
+	{
+		ExistingCandidate->ServerName = PendingMatch.ServerName;
+		ExistingCandidate->Ip = PendingMatch.Ip;
+		ExistingCandidate->Port = PendingMatch.Port;
+		ExistingCandidate->Region = PendingMatch.Region;
+		ExistingCandidate->bIsLocalServer = PendingMatch.bIsLocalServer;
+		ExistingCandidate->NotificationMessage = PendingMatch.NotificationMessage;
+		return;
+	}
+
+	PendingMatchesToFilter.Add(PendingMatch);
+	const FOnlineSubsystemAccelByteSettings& Settings = AccelByteSubsystem->GetSettings();
+	PendingMatchWaitTimeSeconds = FMath::Min(PendingMatchWaitTimeSeconds + Settings.PendingMatchWaitTimeIncreaseSeconds, Settings.PendingMatchMaxWaitTimeSeconds);
+}
+
 void FOnlineSessionAccelByte::ContinueCreatePendingMatchFromDSNotif(const FString& MatchId)
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *MatchId);
@@ -193,17 +261,122 @@ void FOnlineSessionAccelByte::ContinueCreatePendingMatchFromDSNotif(const FStrin
 		return;
 	}
 
-	// #TICKETID party member continue to create pending match data
-	// From here, even if the match is invalid we want to add it to the array of match data structures, as it will be filtered
-	PendingMatchWaitTimeSeconds += PendingMatchWaitTimeIncreaseSeconds;
-	PendingMatchesToFilter.Add(*FoundMatchInfo);
-
-	// Finally, remove this particular match from the matches under construction list so that we don't have any false duplicates
-	PendingMatchesUnderConstruction.Remove(MatchId);
+	AddPendingMatchCandidate(*FoundMatchInfo);
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT("Pushing data for match '%s' to array for filtering!"), *MatchId);
 }
 
+void FOnlineSessionAccelByte::SelectBestPendingMatch()
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Candidate Count: %d"), PendingMatchesToFilter.Num());
+
+	bIsFilteringPendingMatches = true;
+
+	// Gather everything the score depends on up front, so that scoring each candidate is constant time
+	TMap<FString, FAccelByteQosRegionLatency> RegionLatencies;
+	const FOnlineQosManagerAccelBytePtr QosManager = AccelByteSubsystem->GetQosManager();
+	if (QosManager.IsValid())
+	{
+		RegionLatencies = QosManager->GetRegionLatencies();
+	}
+
+	// Servers in a region we have no latency for are assumed to be as far away as the worst region we know of
+	double WorstLatencyMs = 0.0;
+	for (const TPair<FString, FAccelByteQosRegionLatency>& Region : RegionLatencies)
+	{
+		WorstLatencyMs = FMath::Max(WorstLatencyMs, Region.Value.LatencyMs);
+	}
+
+	TSet<FString> PartyMemberIds;
+	const FOnlinePartySystemAccelBytePtr PartyInterface = StaticCastSharedPtr<FOnlinePartySystemAccelByte>(AccelByteSubsystem->GetPartyInterface());
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (PartyInterface.IsValid() && IdentityInterface.IsValid())
+	{
+		const TSharedPtr<const FUniqueNetId> LocalUserId = IdentityInterface->GetUniquePlayerId(AccelByteSubsystem->GetLocalUserNumCached());
+		const TSharedPtr<FOnlinePartyAccelByte> Party = LocalUserId.IsValid() ? PartyInterface->GetFirstPartyForUser(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(LocalUserId.ToSharedRef())) : nullptr;
+		if (Party.IsValid())
+		{
+			Party->ForEachMember([&PartyMemberIds](const FOnlinePartyMemberAccelByte& Member) {
+				PartyMemberIds.Add(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(Member.GetUserId())->GetAccelByteId());
+				return true;
+			});
+		}
+	}
+
+	const FOnlineSubsystemAccelByteSettings& Settings = AccelByteSubsystem->GetSettings();
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	TArray<TPair<double, int32>> ScoredCandidates;
+	ScoredCandidates.Reserve(PendingMatchesToFilter.Num());
+	for (int32 CandidateIndex = 0; CandidateIndex < PendingMatchesToFilter.Num(); CandidateIndex++)
+	{
+		const FAccelBytePendingMatchInfo& Candidate = PendingMatchesToFilter[CandidateIndex];
+		if (!Candidate.IsValid())
+		{
+			UE_LOG_AB(Warning, TEXT("Discarding pending match '%s' as its server information is incomplete! Notification: %s"), *Candidate.MatchId, *Candidate.NotificationMessage);
+			continue;
+		}
+
+		double LatencyMs = 0.0;
+		if (!Candidate.bIsLocalServer)
+		{
+			const FAccelByteQosRegionLatency* RegionLatency = RegionLatencies.Find(Candidate.Region);
+			LatencyMs = (RegionLatency != nullptr) ? RegionLatency->LatencyMs : WorstLatencyMs;
+		}
+
+		int32 AllyCount = 0;
+		for (const FString& MatchedPlayer : Candidate.MatchedPlayers)
+		{
+			if (PartyMemberIds.Contains(MatchedPlayer))
+			{
+				AllyCount++;
+			}
+		}
+		const double AllyOverlap = (PartyMemberIds.Num() > 0) ? static_cast<double>(AllyCount) / PartyMemberIds.Num() : 0.0;
+
+		const double AgeSeconds = FMath::Max(0.0, CurrentTimeSeconds - Candidate.ReceivedTimeSeconds);
+
+		double Score = (LatencyMs * Settings.PendingMatchLatencyWeight) - (AllyOverlap * Settings.PendingMatchAllyOverlapWeight) - (AgeSeconds * Settings.PendingMatchAgeWeight);
+		if (PendingMatchScoringDelegate.IsBound())
+		{
+			Score += PendingMatchScoringDelegate.Execute(Candidate);
+		}
+
+		UE_LOG_AB(Verbose, TEXT("Pending match '%s' on server '%s' (region '%s') scored %.2f. LatencyMs: %.1f; AllyOverlap: %.2f; AgeSeconds: %.2f"), *Candidate.MatchId, *Candidate.ServerName, *Candidate.Region, Score, LatencyMs, AllyOverlap, AgeSeconds);
+		ScoredCandidates.Emplace(Score, CandidateIndex);
+	}
+
+	// Rank the candidates by score, lowest first, keeping arrival order for ties so the earliest notification wins
+	ScoredCandidates.StableSort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; });
+
+	TArray<FAccelBytePendingMatchInfo> Candidates = MoveTemp(PendingMatchesToFilter);
+	PendingMatchesToFilter.Reset();
+
+	// The matchmaking information for these matches is no longer needed now that one of them has been picked
+	for (const FAccelBytePendingMatchInfo& Candidate : Candidates)
+	{
+		PendingMatchesUnderConstruction.Remove(Candidate.MatchId);
+	}
+	PendingMatchWaitTimeSeconds = 0.0;
+	PendingMatchFilterTimerSeconds = 0.0;
+	bIsFilteringPendingMatches = false;
+
+	if (ScoredCandidates.Num() <= 0)
+	{
+		AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Warning, TEXT("None of the %d pending matches had valid server information, unable to join a match!"), Candidates.Num());
+		return;
+	}
+
+	const FAccelBytePendingMatchInfo& BestMatch = Candidates[ScoredCandidates[0].Value];
+	ConstructSessionResultForMatch(BestMatch);
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Selected match '%s' on server '%s' out of %d candidates"), *BestMatch.MatchId, *BestMatch.ServerName, ScoredCandidates.Num());
+}
+
+void FOnlineSessionAccelByte::SetPendingMatchScoringDelegate(const FOnScorePendingMatch& Delegate)
+{
+	PendingMatchScoringDelegate = Delegate;
+}
+
 void FOnlineSessionAccelByte::OnDedicatedServerNotificationReceived(const FAccelByteModelsDsNotice& Notification)
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Dedicated Server Status: %s"), *Notification.Status);
@@ -381,6 +554,7 @@ void FOnlineSessionAccelByte::RemoveNamedSession(FName SessionName)
 			break;
 		}
 	}
+	SessionNameToUpdateStateMap.Remove(SessionName);
 
 	if (bHasRemovedSession)
 	{
@@ -552,7 +726,7 @@ void FOnlineSessionAccelByte::CreateP2PSession(FNamedOnlineSession* Session)
 		return;
 	}
 
-	const auto Setting = Session->SessionSettings;
+	const FOnlineSessionSettings& Setting = Session->SessionSettings;
 	FString GameMode;
 	FString GameMapName;
 	const FString GameVersion = FString::Printf(TEXT("%d"), GetBuildUniqueId());
@@ -561,13 +735,13 @@ void FOnlineSessionAccelByte::CreateP2PSession(FNamedOnlineSession* Session)
 	Setting.Get(SETTING_MAPNAME, GameMapName);
 	Setting.Get(SETTING_NUMBOTS, GameNumBot);
 
-	auto SettingJson = MakeShared<FJsonObject>();    	
-	for(const auto &Set : Setting.Settings)
-	{
-		auto const &Data = Set.Value.Data;
-		auto JsonShared = Set.Value.Data.ToJson();
-		SettingJson->SetField(Set.Key.ToString(), JsonShared->TryGetField(TEXT("value")));
-	}
+	const TSharedRef<FJsonObject> SettingJson = FOnlineSubsystemAccelByteUtils::SessionSettingsToJsonObject(Setting.Settings);
+
+	// Keep what we are about to advertise, so that later calls to UpdateSession only send what changed from it
+	FAccelByteSessionUpdateState& UpdateState = SessionNameToUpdateStateMap.FindOrAdd(Session->SessionName);
+	UpdateState = FAccelByteSessionUpdateState();
+	UpdateState.AdvertisedSettings = Setting;
+	UpdateState.AdvertisedPlayerCount = Session->RegisteredPlayers.Num();
 		
 	THandler<FAccelByteModelsSessionBrowserData> OnSessionCreateSuccessDelegate =
 		THandler<FAccelByteModelsSessionBrowserData>::CreateThreadSafeSP(
@@ -601,6 +775,14 @@ void FOnlineSessionAccelByte::OnSessionCreateSuccess(const FAccelByteModelsSessi
 	}
 
 	AccelByteSessionInfo->SetSessionId(SessionBrowserData.Session_id);
+
+	FAccelByteSessionUpdateState* UpdateState = SessionNameToUpdateStateMap.Find(SessionName);
+	if (UpdateState != nullptr)
+	{
+		UpdateState->bHasAdvertisedSettings = true;
+		UpdateState->LastRequestTimeSeconds = FPlatformTime::Seconds();
+	}
+
 	TriggerOnCreateSessionCompleteDelegates(SessionName, true);
 }
 
@@ -640,12 +822,179 @@ bool FOnlineSessionAccelByte::StartSession(FName SessionName)
 
 bool FOnlineSessionAccelByte::UpdateSession(FName SessionName, FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData)
 {
-	// Currently we do not support updating a session through the backend, aside from registering and unregistering players
-	UE_LOG_AB(Warning, TEXT("FOnlineSessionAccelByte::UpdateSession is currently unsupported!"));
-	AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName]() {
-		SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
-	});
-	return false;
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionName: %s; bShouldRefreshOnlineData: %s"), *SessionName.ToString(), LOG_BOOL_FORMAT(bShouldRefreshOnlineData));
+
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Warning, TEXT("Failed to update session '%s' as it does not exist!"), *SessionName.ToString());
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName]() {
+			SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
+		});
+		return false;
+	}
+
+	// Keep the open connection counts in step with any change to the total number of connections
+	Session->NumOpenPublicConnections = FMath::Max(0, Session->NumOpenPublicConnections + UpdatedSessionSettings.NumPublicConnections - Session->SessionSettings.NumPublicConnections);
+	Session->NumOpenPrivateConnections = FMath::Max(0, Session->NumOpenPrivateConnections + UpdatedSessionSettings.NumPrivateConnections - Session->SessionSettings.NumPrivateConnections);
+
+	const int32 BuildUniqueId = Session->SessionSettings.BuildUniqueId;
+	Session->SessionSettings = UpdatedSessionSettings;
+	Session->SessionSettings.BuildUniqueId = BuildUniqueId;
+
+	// LAN sessions are advertised straight from the local settings, so there is nothing more to do for them
+	FAccelByteSessionUpdateState* UpdateState = SessionNameToUpdateStateMap.Find(SessionName);
+	if (!bShouldRefreshOnlineData || Session->SessionSettings.bIsLANMatch)
+	{
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Updated settings for session '%s' locally."), *SessionName.ToString());
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName]() {
+			SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+		});
+		return true;
+	}
+
+	// Only hosted P2P sessions have a session browser entry that we are able to update
+	if (UpdateState == nullptr)
+	{
+		AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Warning, TEXT("Updated settings for session '%s' locally, but the session is not advertised through the session browser so the backend was not updated!"), *SessionName.ToString());
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName]() {
+			SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
+		});
+		return false;
+	}
+
+	// Mark the session as dirty, the diff and request are made from Tick so that rapid updates are coalesced into one
+	UpdateState->bIsUpdatePending = true;
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Queued update for session '%s' to the session browser."), *SessionName.ToString());
+	return true;
+}
+
+void FOnlineSessionAccelByte::ProcessPendingSessionUpdates()
+{
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	const double SessionUpdateIntervalSeconds = AccelByteSubsystem->GetSettings().SessionUpdateIntervalSeconds;
+	TArray<FName> UnchangedSessionNames;
+	for (TPair<FName, FAccelByteSessionUpdateState>& Pair : SessionNameToUpdateStateMap)
+	{
+		FAccelByteSessionUpdateState& UpdateState = Pair.Value;
+		if (!UpdateState.bIsUpdatePending || UpdateState.bIsRequestInFlight || !UpdateState.bHasAdvertisedSettings)
+		{
+			continue;
+		}
+
+		if (CurrentTimeSeconds - UpdateState.LastRequestTimeSeconds < SessionUpdateIntervalSeconds)
+		{
+			continue;
+		}
+
+		UpdateState.bIsUpdatePending = false;
+
+		FNamedOnlineSession* Session = GetNamedSession(Pair.Key);
+		if (Session == nullptr)
+		{
+			continue;
+		}
+
+		// The session browser tracks private connections as spectator slots that cannot be changed after creation, so
+		// only the public connection count is sent alongside the settings
+		const FOnlineSessionSettings& CurrentSettings = Session->SessionSettings;
+		const bool bUpdatePlayerCounts = (CurrentSettings.NumPublicConnections != UpdateState.AdvertisedSettings.NumPublicConnections)
+			|| (Session->RegisteredPlayers.Num() != UpdateState.AdvertisedPlayerCount);
+		const TSharedPtr<FJsonObject> ChangedSettings = DiffSessionSettings(UpdateState.AdvertisedSettings, CurrentSettings);
+		if (!bUpdatePlayerCounts && !ChangedSettings.IsValid())
+		{
+			UnchangedSessionNames.Add(Pair.Key);
+			continue;
+		}
+
+		FString SessionId;
+		const TSharedPtr<FOnlineSessionInfoAccelByte> SessionInfo = StaticCastSharedPtr<FOnlineSessionInfoAccelByte>(Session->SessionInfo);
+		if (SessionInfo.IsValid())
+		{
+			SessionId = SessionInfo->GetSessionId().ToString();
+		}
+
+		UpdateState.bIsRequestInFlight = true;
+		UpdateState.LastRequestTimeSeconds = CurrentTimeSeconds;
+		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdateSession>(AccelByteSubsystem
+			, Session->HostingPlayerNum
+			, Pair.Key
+			, SessionId
+			, CurrentSettings
+			, bUpdatePlayerCounts
+			, Session->RegisteredPlayers.Num()
+			, ChangedSettings);
+	}
+
+	// Nothing that the session browser knows about changed for these sessions, so they are already up to date. Fired
+	// after iterating as a handler may update or destroy a session.
+	for (const FName& SessionName : UnchangedSessionNames)
+	{
+		TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+	}
+}
+
+TSharedPtr<FJsonObject> FOnlineSessionAccelByte::DiffSessionSettings(const FOnlineSessionSettings& AdvertisedSettings, const FOnlineSessionSettings& CurrentSettings)
+{
+	TSharedPtr<FJsonObject> ChangedSettings = nullptr;
+	for (const TPair<FName, FOnlineSessionSetting>& Setting : CurrentSettings.Settings)
+	{
+		const FOnlineSessionSetting* AdvertisedSetting = AdvertisedSettings.Settings.Find(Setting.Key);
+		if (AdvertisedSetting != nullptr && AdvertisedSetting->Data == Setting.Value.Data)
+		{
+			continue;
+		}
+
+		if (!ChangedSettings.IsValid())
+		{
+			ChangedSettings = MakeShared<FJsonObject>();
+		}
+		ChangedSettings->SetField(Setting.Key.ToString(), FOnlineSubsystemAccelByteUtils::VariantDataToJsonValue(Setting.Value.Data));
+	}
+
+	for (const TPair<FName, FOnlineSessionSetting>& Setting : AdvertisedSettings.Settings)
+	{
+		if (CurrentSettings.Settings.Contains(Setting.Key))
+		{
+			continue;
+		}
+
+		if (!ChangedSettings.IsValid())
+		{
+			ChangedSettings = MakeShared<FJsonObject>();
+		}
+		ChangedSettings->SetField(Setting.Key.ToString(), MakeShared<FJsonValueNull>());
+	}
+
+	return ChangedSettings;
+}
+
+void FOnlineSessionAccelByte::OnSessionUpdateRequestComplete(FName SessionName, bool bWasSuccessful, const FOnlineSessionSettings& AdvertisedSettings, int32 AdvertisedPlayerCount)
+{
+	FAccelByteSessionUpdateState* UpdateState = SessionNameToUpdateStateMap.Find(SessionName);
+	if (UpdateState == nullptr)
+	{
+		return;
+	}
+
+	// On failure the advertised settings are left as they were, so the failed changes are sent again with the next update
+	UpdateState->bIsRequestInFlight = false;
+	if (bWasSuccessful)
+	{
+		UpdateState->AdvertisedSettings = AdvertisedSettings;
+		UpdateState->AdvertisedPlayerCount = AdvertisedPlayerCount;
+	}
+}
+
+void FOnlineSessionAccelByte::OnSessionPlayersChanged(FName SessionName)
+{
+	// Only hosted P2P sessions have a session browser entry to keep in step, the rest are tracked by the backend
+	FAccelByteSessionUpdateState* UpdateState = SessionNameToUpdateStateMap.Find(SessionName);
+	if (UpdateState != nullptr)
+	{
+		UpdateState->bIsUpdatePending = true;
+	}
 }
 
 bool FOnlineSessionAccelByte::EndSession(FName SessionName)
@@ -752,6 +1101,12 @@ bool FOnlineSessionAccelByte::DestroySession(FName SessionName, const FOnDestroy
 		return false;
 	}
 
+	// Settings cached from a LAN host for this session are stale once we are done with it
+	if (Session->SessionInfo.IsValid())
+	{
+		LANHostSettingsCache.Remove(Session->SessionInfo->GetSessionId().ToString());
+	}
+
 	RemoveNamedSession(Session->SessionName);
 	CompletionDelegate.ExecuteIfBound(SessionName, true);
 	TriggerOnDestroySessionCompleteDelegates(SessionName, true);
@@ -894,10 +1249,213 @@ bool FOnlineSessionAccelByte::FindSessions(int32 SearchingPlayerNum, const TShar
 
 bool FOnlineSessionAccelByte::FindSessions(const FUniqueNetId& SearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& SearchSettings)
 {
-	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindSessions>(AccelByteSubsystem, SearchingPlayerId, SearchSettings);
+	const double CacheTTLSeconds = AccelByteSubsystem->GetSettings().SessionSearchCacheTTLSeconds;
+	if (CacheTTLSeconds <= 0.0 || SearchSettings->bIsLanQuery)
+	{
+		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindSessions>(AccelByteSubsystem, SearchingPlayerId, SearchSettings);
+		return true;
+	}
+
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SearchingPlayerId: %s"), *SearchingPlayerId.ToDebugString());
+
+	if (SearchSettings->SearchState != EOnlineAsyncTaskState::NotStarted)
+	{
+		AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Error, TEXT("Search is in a state other than 'NotStarted', cannot continue with finding sessions! Current search state: %s"), EOnlineAsyncTaskState::ToString(SearchSettings->SearchState));
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared()]{
+			SessionInterface->TriggerOnFindSessionsCompleteDelegates(false);
+		});
+		return false;
+	}
+
+	const FString SearchKey = GetSessionSearchCacheKey(SearchingPlayerId, SearchSettings.Get());
+	FAccelByteSessionSearchCacheEntry& Entry = SessionSearchCache.FindOrAdd(SearchKey);
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	Entry.QuerySettings = SearchSettings->QuerySettings;
+	Entry.MaxSearchResults = SearchSettings->MaxSearchResults;
+	Entry.SearchingPlayerId = SearchingPlayerId.AsShared();
+	Entry.LastRequestTimeSeconds = CurrentTimeSeconds;
+	Entry.LatestSearch = SearchSettings;
+
+	SearchSettings->SearchResults.Empty();
+	if (Entry.bHasResults && CurrentTimeSeconds - Entry.LastRefreshTimeSeconds < CacheTTLSeconds)
+	{
+		SearchSettings->SearchResults = Entry.Results;
+		SearchSettings->SearchState = EOnlineAsyncTaskState::Done;
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared()]{
+			SessionInterface->TriggerOnFindSessionsCompleteDelegates(true);
+		});
+
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Found %d sessions in the search cache, refreshed %.2f seconds ago."), Entry.Results.Num(), CurrentTimeSeconds - Entry.LastRefreshTimeSeconds);
+		return true;
+	}
+
+	// Results are missing or stale, wait on a refresh, joining the one in flight for this query if there is one
+	SearchSettings->SearchState = EOnlineAsyncTaskState::InProgress;
+	Entry.WaitingSearches.Add(SearchSettings);
+	if (!Entry.bIsRefreshInFlight)
+	{
+		StartSessionSearchRefresh(SearchKey, Entry);
+	}
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Waiting on a session browser refresh for the search, %d searches waiting."), Entry.WaitingSearches.Num());
 	return true;
 }
 
+FString FOnlineSessionAccelByte::GetSessionSearchCacheKey(const FUniqueNetId& SearchingPlayerId, const FOnlineSessionSearch& SearchSettings)
+{
+	TArray<FString> QueryParams;
+	QueryParams.Reserve(SearchSettings.QuerySettings.SearchParams.Num());
+	for (const TPair<FName, FOnlineSessionSearchParam>& Param : SearchSettings.QuerySettings.SearchParams)
+	{
+		QueryParams.Add(FString::Printf(TEXT("%s:%s:%s"), *Param.Key.ToString().ToLower(), EOnlineComparisonOp::ToString(Param.Value.ComparisonOp), *Param.Value.Data.ToString()));
+	}
+	QueryParams.Sort();
+
+	return FString::Printf(TEXT("%s;%d;%s"), *FUniqueNetIdAccelByteUser::Cast(SearchingPlayerId)->GetAccelByteId(), SearchSettings.MaxSearchResults, *FString::Join(QueryParams, TEXT(";")));
+}
+
+void FOnlineSessionAccelByte::DiffSessionSearchResults(const TArray<FOnlineSessionSearchResult>& OldResults, const TArray<FOnlineSessionSearchResult>& NewResults, FAccelByteSessionSearchDiff& OutDiff)
+{
+	TMap<FString, const FOnlineSessionSearchResult*> OldResultsById;
+	OldResultsById.Reserve(OldResults.Num());
+	for (const FOnlineSessionSearchResult& OldResult : OldResults)
+	{
+		OldResultsById.Add(OldResult.GetSessionIdStr(), &OldResult);
+	}
+
+	for (const FOnlineSessionSearchResult& NewResult : NewResults)
+	{
+		const FOnlineSessionSearchResult* OldResult = nullptr;
+		if (!OldResultsById.RemoveAndCopyValue(NewResult.GetSessionIdStr(), OldResult))
+		{
+			OutDiff.AddedSessions.Add(NewResult);
+			continue;
+		}
+
+		const FOnlineSession& OldSession = OldResult->Session;
+		const FOnlineSession& NewSession = NewResult.Session;
+		const TSharedPtr<FInternetAddr> OldHostAddr = OldSession.SessionInfo.IsValid() ? StaticCastSharedPtr<FOnlineSessionInfoAccelByte>(OldSession.SessionInfo)->GetHostAddr() : nullptr;
+		const TSharedPtr<FInternetAddr> NewHostAddr = NewSession.SessionInfo.IsValid() ? StaticCastSharedPtr<FOnlineSessionInfoAccelByte>(NewSession.SessionInfo)->GetHostAddr() : nullptr;
+		const bool bHostChanged = (OldHostAddr.IsValid() != NewHostAddr.IsValid()) || (OldHostAddr.IsValid() && OldHostAddr->ToString(true) != NewHostAddr->ToString(true));
+
+		if (bHostChanged
+			|| OldSession.NumOpenPublicConnections != NewSession.NumOpenPublicConnections
+			|| OldSession.NumOpenPrivateConnections != NewSession.NumOpenPrivateConnections
+			|| OldSession.SessionSettings.NumPublicConnections != NewSession.SessionSettings.NumPublicConnections
+			|| OldSession.SessionSettings.bAllowJoinInProgress != NewSession.SessionSettings.bAllowJoinInProgress
+			|| OldSession.SessionSettings.BuildUniqueId != NewSession.SessionSettings.BuildUniqueId
+			|| OldSession.OwningUserName != NewSession.OwningUserName
+			|| DiffSessionSettings(OldSession.SessionSettings, NewSession.SessionSettings).IsValid())
+		{
+			OutDiff.ChangedSessions.Add(NewResult);
+		}
+	}
+
+	OldResultsById.GenerateKeyArray(OutDiff.RemovedSessionIds);
+}
+
+void FOnlineSessionAccelByte::StartSessionSearchRefresh(const FString& SearchKey, FAccelByteSessionSearchCacheEntry& Entry)
+{
+	// Refresh into a search of our own, so that the results of a search the game is holding on to only change once the
+	// refresh completes and the differences are known
+	const TSharedRef<FOnlineSessionSearch> RefreshSearch = MakeShared<FOnlineSessionSearch>();
+	RefreshSearch->QuerySettings = Entry.QuerySettings;
+	RefreshSearch->MaxSearchResults = Entry.MaxSearchResults;
+
+	Entry.bIsRefreshInFlight = true;
+	Entry.LastAttemptTimeSeconds = FPlatformTime::Seconds();
+	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteFindSessions>(AccelByteSubsystem, *Entry.SearchingPlayerId, RefreshSearch, SearchKey);
+}
+
+void FOnlineSessionAccelByte::OnSessionSearchRefreshComplete(const FString& SearchKey, bool bWasSuccessful, const TArray<FOnlineSessionSearchResult>& Results)
+{
+	FAccelByteSessionSearchCacheEntry* Entry = SessionSearchCache.Find(SearchKey);
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	Entry->bIsRefreshInFlight = false;
+	if (bWasSuccessful)
+	{
+		FAccelByteSessionSearchDiff Diff;
+		if (Entry->bHasResults)
+		{
+			DiffSessionSearchResults(Entry->Results, Results, Diff);
+		}
+
+		Entry->Results = Results;
+		Entry->bHasResults = true;
+		Entry->LastRefreshTimeSeconds = FPlatformTime::Seconds();
+
+		// A search that is still waiting gets the new results below, only a search the game already has needs the diff
+		const TSharedPtr<FOnlineSessionSearch> LatestSearch = Entry->LatestSearch.Pin();
+		if (Diff.HasChanges() && LatestSearch.IsValid() && LatestSearch->SearchState == EOnlineAsyncTaskState::Done)
+		{
+			LatestSearch->SearchResults = Results;
+			TriggerOnSessionSearchResultsChangedDelegates(LatestSearch.ToSharedRef(), Diff);
+		}
+	}
+	else
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to refresh cached session search, keeping the last known results."));
+	}
+
+	// Move the waiting searches out first, as completing them can call back into FindSessions and modify the cache
+	TArray<TSharedRef<FOnlineSessionSearch>> WaitingSearches = MoveTemp(Entry->WaitingSearches);
+	Entry->WaitingSearches.Reset();
+	for (const TSharedRef<FOnlineSessionSearch>& WaitingSearch : WaitingSearches)
+	{
+		if (bWasSuccessful)
+		{
+			WaitingSearch->SearchResults = Results;
+			WaitingSearch->SearchState = EOnlineAsyncTaskState::Done;
+		}
+		else
+		{
+			WaitingSearch->SearchState = EOnlineAsyncTaskState::Failed;
+		}
+	}
+
+	for (int32 SearchIndex = 0; SearchIndex < WaitingSearches.Num(); SearchIndex++)
+	{
+		TriggerOnFindSessionsCompleteDelegates(bWasSuccessful);
+	}
+}
+
+void FOnlineSessionAccelByte::ProcessSessionSearchCache()
+{
+	if (SessionSearchCache.Num() <= 0)
+	{
+		return;
+	}
+
+	const FOnlineSubsystemAccelByteSettings& Settings = AccelByteSubsystem->GetSettings();
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	for (auto EntryIt = SessionSearchCache.CreateIterator(); EntryIt; ++EntryIt)
+	{
+		FAccelByteSessionSearchCacheEntry& Entry = EntryIt.Value();
+		if (Entry.bIsRefreshInFlight)
+		{
+			continue;
+		}
+
+		const bool bIsIdle = CurrentTimeSeconds - Entry.LastRequestTimeSeconds >= Settings.SessionSearchCacheIdleTimeoutSeconds;
+		const bool bIsUserLoggedIn = IdentityInterface.IsValid() && Entry.SearchingPlayerId.IsValid() && IdentityInterface->GetLoginStatus(*Entry.SearchingPlayerId) == ELoginStatus::LoggedIn;
+		if (bIsIdle || !bIsUserLoggedIn || Settings.SessionSearchCacheTTLSeconds <= 0.0)
+		{
+			EntryIt.RemoveCurrent();
+			continue;
+		}
+
+		if (CurrentTimeSeconds - Entry.LastAttemptTimeSeconds >= Settings.SessionSearchCacheTTLSeconds)
+		{
+			StartSessionSearchRefresh(EntryIt.Key(), Entry);
+		}
+	}
+}
+
 bool FOnlineSessionAccelByte::FindSessionById(const FUniqueNetId& SearchingUserId, const FUniqueNetId& SessionId, const FUniqueNetId& FriendId, const FOnSingleSessionResultCompleteDelegate& CompletionDelegate)
 {
 	// @todo not supported by SDK yet, in subsequent version that we will upgrade to as soon as released
@@ -915,8 +1473,9 @@ bool FOnlineSessionAccelByte::CancelFindSessions()
 
 bool FOnlineSessionAccelByte::PingSearchResults(const FOnlineSessionSearchResult& SearchResult)
 {
-	// @todo Going to need a way to ping for dedicated servers as well as P2P.
-	return false;
+	// Only sessions with a server address can be pinged, P2P sessions are reached through the relay
+	const FOnlineSessionPingManagerAccelBytePtr PingManager = AccelByteSubsystem->GetSessionPingManager();
+	return PingManager.IsValid() && PingManager->PingSearchResult(SearchResult);
 }
 
 bool FOnlineSessionAccelByte::JoinSession(const FUniqueNetId& PlayerId, FName SessionName, const FOnlineSessionSearchResult& DesiredSession)
@@ -1301,8 +1860,11 @@ void FOnlineSessionAccelByte::RegisterRealTimeLobbyDelegates(int32 LocalUserNum)
 	// keep a search handle around so that the client can act on matchmaking results.
 	const AccelByte::Api::Lobby::FMatchmakingNotif OnMatchmakingNotificationReceivedDelegate = AccelByte::Api::Lobby::FMatchmakingNotif::CreateRaw(this, &FOnlineSessionAccelByte::OnMatchmakingNotificationReceived);
 	const AccelByte::Api::Lobby::FDsNotif OnDedicatedServerNotificationReceivedDelegate = AccelByte::Api::Lobby::FDsNotif::CreateRaw(this, &FOnlineSessionAccelByte::OnDedicatedServerNotificationReceived);
-	ApiClient->Lobby.SetMatchmakingNotifDelegate(OnMatchmakingNotificationReceivedDelegate);
-	ApiClient->Lobby.SetDsNotifDelegate(OnDedicatedServerNotificationReceivedDelegate);
+	// Queue both notifications so they are handled within the per-frame notification budget
+	const FOnlineNotificationDispatcherAccelBytePtr NotificationDispatcher = AccelByteSubsystem->GetNotificationDispatcher();
+
+	ApiClient->Lobby.SetMatchmakingNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("Matchmaking"), LocalUserNum, OnMatchmakingNotificationReceivedDelegate));
+	ApiClient->Lobby.SetDsNotifDelegate(FOnlineNotificationDispatcherAccelByte::WrapIfValid(NotificationDispatcher, TEXT("DedicatedServer"), LocalUserNum, OnDedicatedServerNotificationReceivedDelegate));
 }
 
 void FOnlineSessionAccelByte::OnSessionResultCreateSuccess(const FOnlineSessionSearchResult& Result)
@@ -1318,6 +1880,8 @@ void FOnlineSessionAccelByte::OnSessionResultCreateSuccess(const FOnlineSessionS
 void FOnlineSessionAccelByte::Tick(float DeltaTime)
 {
 	LANSessionManager.Tick(DeltaTime);
+	ProcessPendingSessionUpdates();
+	ProcessSessionSearchCache();
 
 	// If we have some pending matches to filter, start timer and attempt filtering once timer has been reached
 	if (PendingMatchesToFilter.Num() > 0 && !bIsFilteringPendingMatches)
@@ -1325,7 +1889,7 @@ void FOnlineSessionAccelByte::Tick(float DeltaTime)
 		PendingMatchFilterTimerSeconds += DeltaTime;
 		if (PendingMatchFilterTimerSeconds >= PendingMatchWaitTimeSeconds)
 		{
-			PendingMatchFilterTimerSeconds = 0.0;
+			SelectBestPendingMatch();
 		}
 	}
 	// If we have no pending matches to filter but we still have timer values, then we want to reset these
@@ -1350,6 +1914,19 @@ bool FOnlineSessionAccelByte::NeedsAdvertising()
 	return false;
 }
 
+bool FOnlineSessionAccelByte::IsHostingSession()
+{
+	FScopeLock ScopeLock(&SessionLock);
+	for (const FNamedOnlineSession& Session : Sessions)
+	{
+		if (IsHost(Session))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 bool FOnlineSessionAccelByte::NeedsAdvertising(const FNamedOnlineSession& Session)
 {
 	return Session.SessionSettings.bIsLANMatch && Session.SessionSettings.bShouldAdvertise && IsHost(Session);
@@ -1413,6 +1990,7 @@ uint32 FOnlineSessionAccelByte::FindLANSession()
 	FNboSerializeToBufferAccelByte Packet(LAN_BEACON_MAX_PACKET_SIZE);
 	LANSessionManager.CreateClientQueryPacket(Packet, LANSessionManager.LanNonce);
 	LANPingStartSeconds = FPlatformTime::Seconds();
+	LANHostsAnsweredSearch.Reset();
 	if (!LANSessionManager.Search(Packet, ResponseDelegate, TimeoutDelegate))
 	{
 		Return = ONLINE_FAIL;
@@ -1432,63 +2010,98 @@ uint32 FOnlineSessionAccelByte::FinalizeLANSearch()
 	return UpdateLANStatus();
 }
 
-void FOnlineSessionAccelByte::AppendSessionToPacket(FNboSerializeToBufferAccelByte& Packet, FOnlineSession* Session)
+bool FOnlineSessionAccelByte::AppendSessionToPacket(FNboSerializeToBufferAccelByte& Packet, FOnlineSession* Session)
 {
+	Packet << static_cast<uint8>(LAN_SESSION_PACKET_VERSION_ACCELBYTE);
 	Packet << *StaticCastSharedPtr<const FUniqueNetIdAccelByteUser>(Session->OwningUserId)
-		<< Session->OwningUserName
-		<< Session->NumOpenPrivateConnections
-		<< Session->NumOpenPublicConnections;
+		<< Session->OwningUserName;
+	Packet.WriteVarUInt(FMath::Max(Session->NumOpenPrivateConnections, 0));
+	Packet.WriteVarUInt(FMath::Max(Session->NumOpenPublicConnections, 0));
 	SetPortFromNetDriver(*AccelByteSubsystem, Session->SessionInfo);
 	Packet << *StaticCastSharedPtr<FOnlineSessionInfoAccelByte>(Session->SessionInfo);
-	AppendSessionSettingsToPacket(Packet, &Session->SessionSettings);
+
+	// Settings are written to their own buffer first so that they can be hashed, which lets searching clients skip
+	// parsing them again when this host answers with the same settings as last time
+	FNboSerializeToBufferAccelByte SettingsPacket(LAN_BEACON_MAX_PACKET_SIZE);
+	AppendSessionSettingsToPacket(SettingsPacket, &Session->SessionSettings);
+	if (SettingsPacket.HasOverflow())
+	{
+		return false;
+	}
+
+	const uint8* SettingsBytes = SettingsPacket;
+	const int32 SettingsByteCount = SettingsPacket.GetByteCount();
+	Packet << FCrc::MemCrc32(SettingsBytes, SettingsByteCount);
+	Packet.WriteCompactBytes(SettingsBytes, SettingsByteCount);
+	return !Packet.HasOverflow();
 }
 
 void FOnlineSessionAccelByte::AppendSessionSettingsToPacket(FNboSerializeToBufferAccelByte& Packet,
 	FOnlineSessionSettings* SessionSettings)
 {
-	Packet << SessionSettings->NumPublicConnections
-		<< SessionSettings->NumPrivateConnections
-		<< static_cast<uint8>(SessionSettings->bShouldAdvertise)
-		<< static_cast<uint8>(SessionSettings->bIsLANMatch)
-		<< static_cast<uint8>(SessionSettings->bIsDedicated)
-		<< static_cast<uint8>(SessionSettings->bUsesStats)
-		<< static_cast<uint8>(SessionSettings->bAllowJoinInProgress)
-		<< static_cast<uint8>(SessionSettings->bAllowInvites)
-		<< static_cast<uint8>(SessionSettings->bUsesPresence)
-		<< static_cast<uint8>(SessionSettings->bAllowJoinViaPresence)
-		<< static_cast<uint8>(SessionSettings->bAllowJoinViaPresenceFriendsOnly)
-		<< static_cast<uint8>(SessionSettings->bAntiCheatProtected)
-		<< SessionSettings->BuildUniqueId;
+	const uint32 Flags = (SessionSettings->bShouldAdvertise ? 1 << 0 : 0)
+		| (SessionSettings->bIsLANMatch ? 1 << 1 : 0)
+		| (SessionSettings->bIsDedicated ? 1 << 2 : 0)
+		| (SessionSettings->bUsesStats ? 1 << 3 : 0)
+		| (SessionSettings->bAllowJoinInProgress ? 1 << 4 : 0)
+		| (SessionSettings->bAllowInvites ? 1 << 5 : 0)
+		| (SessionSettings->bUsesPresence ? 1 << 6 : 0)
+		| (SessionSettings->bAllowJoinViaPresence ? 1 << 7 : 0)
+		| (SessionSettings->bAllowJoinViaPresenceFriendsOnly ? 1 << 8 : 0)
+		| (SessionSettings->bAntiCheatProtected ? 1 << 9 : 0);
+
+	Packet.WriteVarUInt(FMath::Max(SessionSettings->NumPublicConnections, 0));
+	Packet.WriteVarUInt(FMath::Max(SessionSettings->NumPrivateConnections, 0));
+	Packet.WriteVarUInt(Flags);
+	Packet.WriteVarInt(SessionSettings->BuildUniqueId);
+
+	// Settings are written in a single pass and terminated with an end token, rather than counted up front
+	const TArray<FName>& InternedSettingKeys = GetLANInternedSettingKeys();
+	for (const TPair<FName, FOnlineSessionSetting>& Setting : SessionSettings->Settings)
+	{
+		if (Setting.Value.AdvertisementType < EOnlineDataAdvertisementType::ViaOnlineService)
+		{
+			continue;
+		}
 
-	int32 Num = 0;
-	for (FSessionSettings::TConstIterator It(SessionSettings->Settings); It; ++It)
-	{	
-		const auto& Setting = It.Value();
-		if (Setting.AdvertisementType >= EOnlineDataAdvertisementType::ViaOnlineService)
+		// A bare type byte for a value we cannot encode would make the client reject the whole session, so leave it out
+		if (!FNboSerializeToBufferAccelByte::IsCompactVariantTypeSupported(Setting.Value.Data.GetType()))
 		{
-			Num++;
+			UE_LOG_AB(Verbose, TEXT("Not advertising LAN session setting '%s' as its type '%s' cannot be written to a packet"), *Setting.Key.ToString(), Setting.Value.Data.GetTypeString());
+			continue;
 		}
-	}
 
-	Packet << Num;
-	for (FSessionSettings::TConstIterator It(SessionSettings->Settings); It; ++It)
-	{
-		const auto& Setting = It.Value();
-		if (Setting.AdvertisementType >= EOnlineDataAdvertisementType::ViaOnlineService)
+		const int32 InternedKeyIndex = InternedSettingKeys.IndexOfByKey(Setting.Key);
+		if (InternedKeyIndex != INDEX_NONE)
+		{
+			Packet.WriteVarUInt(InternedKeyIndex + LAN_SETTING_KEY_TOKEN_INTERNED_OFFSET);
+		}
+		else
 		{
-			Packet << It.Key();
-			Packet << Setting;
+			Packet.WriteVarUInt(LAN_SETTING_KEY_TOKEN_LITERAL);
+			Packet.WriteCompactString(Setting.Key.ToString());
 		}
+		Packet.WriteCompactVariantData(Setting.Value.Data);
+		Packet << static_cast<uint8>(Setting.Value.AdvertisementType);
 	}
+	Packet.WriteVarUInt(LAN_SETTING_KEY_TOKEN_END);
 }
 
-void FOnlineSessionAccelByte::ReadSessionFromPacket(FNboSerializeFromBufferAccelByte& Packet, FOnlineSession* Session)
+bool FOnlineSessionAccelByte::ReadSessionFromPacket(FNboSerializeFromBufferAccelByte& Packet, FOnlineSession* Session)
 {
+	uint8 Version = 0;
+	Packet >> Version;
+	if (Version != LAN_SESSION_PACKET_VERSION_ACCELBYTE)
+	{
+		UE_LOG_AB(Verbose, TEXT("Ignoring LAN session with packet version %d, expected version %d"), Version, LAN_SESSION_PACKET_VERSION_ACCELBYTE);
+		return false;
+	}
+
 	TSharedRef<FUniqueNetIdAccelByteUser> UniqueId = MakeShared<FUniqueNetIdAccelByteUser>();
 	Packet >> *UniqueId
-		>> Session->OwningUserName
-		>> Session->NumOpenPrivateConnections
-		>> Session->NumOpenPublicConnections;
+		>> Session->OwningUserName;
+	Session->NumOpenPrivateConnections = static_cast<int32>(Packet.ReadVarUInt());
+	Session->NumOpenPublicConnections = static_cast<int32>(Packet.ReadVarUInt());
 
 	Session->OwningUserId = UniqueId;
 	TSharedRef<FOnlineSessionInfoAccelByte> SessionInfo = MakeShared<FOnlineSessionInfoAccelByte>();
@@ -1496,54 +2109,102 @@ void FOnlineSessionAccelByte::ReadSessionFromPacket(FNboSerializeFromBufferAccel
 	Packet >> *SessionInfo;
 	Session->SessionInfo = SessionInfo;
 
-	ReadSettingsFromPacket(Packet, Session->SessionSettings);
-}
-
-void FOnlineSessionAccelByte::ReadSettingsFromPacket(FNboSerializeFromBufferAccelByte& Packet, FOnlineSessionSettings& SessionSettings)
-{
-	SessionSettings.Settings.Empty();
-	Packet >> SessionSettings.NumPublicConnections >> SessionSettings.NumPrivateConnections;
-	uint8 Read = 0;
-	Packet >> Read;
-	SessionSettings.bShouldAdvertise = !!Read;
-	Packet >> Read;
-	SessionSettings.bIsLANMatch = !!Read;
-	Packet >> Read;
-	SessionSettings.bIsDedicated = !!Read;
-	Packet >> Read;
-	SessionSettings.bUsesStats = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowJoinInProgress = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowInvites = !!Read;
-	Packet >> Read;
-	SessionSettings.bUsesPresence = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowJoinViaPresence = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowJoinViaPresenceFriendsOnly = !!Read;
-	Packet >> Read;
-	SessionSettings.bAntiCheatProtected = !!Read;
-	Packet >> SessionSettings.BuildUniqueId;
-	int32 Num = 0;
-	Packet >> Num;
-	if (!Packet.HasOverflow())
+	uint32 SettingsHash = 0;
+	Packet >> SettingsHash;
+	const uint64 SettingsByteCount = Packet.ReadVarUInt();
+	FNboSerializeFromBufferAccelByte SettingsPacket = Packet.ReadSubBuffer(SettingsByteCount);
+	if (Packet.HasOverflow())
+	{
+		UE_LOG_AB(Verbose, TEXT("Packet overflow detected"));
+		return false;
+	}
+
+	// Hosts answer every query with their full settings, but these rarely change between searches, so reuse what we
+	// parsed last time if the hash matches
+	const FString SessionId = SessionInfo->GetSessionId().ToString();
+	LANHostsAnsweredSearch.Add(SessionId);
+	const TPair<uint32, FOnlineSessionSettings>* CachedSettings = LANHostSettingsCache.Find(SessionId);
+	if (CachedSettings != nullptr && CachedSettings->Key == SettingsHash)
+	{
+		Session->SessionSettings = CachedSettings->Value;
+		return true;
+	}
+
+	// Settings are parsed from their own reader, and must use up exactly the bytes the host said they take
+	if (!ReadSettingsFromPacket(SettingsPacket, Session->SessionSettings))
+	{
+		return false;
+	}
+	if (SettingsPacket.GetBytesRemaining() != 0)
 	{
+		Session->SessionSettings.Settings.Reset();
+		UE_LOG_AB(Verbose, TEXT("Ignoring LAN session with %d unread bytes at the end of its settings"), SettingsPacket.GetBytesRemaining());
+		return false;
+	}
+
+	LANHostSettingsCache.Emplace(SessionId, TPair<uint32, FOnlineSessionSettings>(SettingsHash, Session->SessionSettings));
+	return true;
+}
+
+bool FOnlineSessionAccelByte::ReadSettingsFromPacket(FNboSerializeFromBufferAccelByte& Packet, FOnlineSessionSettings& SessionSettings)
+{
+	SessionSettings.Settings.Reset();
+	SessionSettings.NumPublicConnections = static_cast<int32>(Packet.ReadVarUInt());
+	SessionSettings.NumPrivateConnections = static_cast<int32>(Packet.ReadVarUInt());
+	const uint64 Flags = Packet.ReadVarUInt();
+	SessionSettings.bShouldAdvertise = (Flags & (1 << 0)) != 0;
+	SessionSettings.bIsLANMatch = (Flags & (1 << 1)) != 0;
+	SessionSettings.bIsDedicated = (Flags & (1 << 2)) != 0;
+	SessionSettings.bUsesStats = (Flags & (1 << 3)) != 0;
+	SessionSettings.bAllowJoinInProgress = (Flags & (1 << 4)) != 0;
+	SessionSettings.bAllowInvites = (Flags & (1 << 5)) != 0;
+	SessionSettings.bUsesPresence = (Flags & (1 << 6)) != 0;
+	SessionSettings.bAllowJoinViaPresence = (Flags & (1 << 7)) != 0;
+	SessionSettings.bAllowJoinViaPresenceFriendsOnly = (Flags & (1 << 8)) != 0;
+	SessionSettings.bAntiCheatProtected = (Flags & (1 << 9)) != 0;
+	SessionSettings.BuildUniqueId = static_cast<int32>(Packet.ReadVarInt());
+
+	const TArray<FName>& InternedSettingKeys = GetLANInternedSettingKeys();
+	while (!Packet.HasOverflow())
+	{
+		const uint64 KeyToken = Packet.ReadVarUInt();
+		if (KeyToken == LAN_SETTING_KEY_TOKEN_END)
+		{
+			break;
+		}
+
 		FName Key;
-		for (int32 i = 0; i < Num && !Packet.HasOverflow(); i++)
+		if (KeyToken == LAN_SETTING_KEY_TOKEN_LITERAL)
+		{
+			Key = FName(*Packet.ReadCompactString());
+		}
+		else if (KeyToken - LAN_SETTING_KEY_TOKEN_INTERNED_OFFSET < static_cast<uint64>(InternedSettingKeys.Num()))
+		{
+			Key = InternedSettingKeys[static_cast<int32>(KeyToken - LAN_SETTING_KEY_TOKEN_INTERNED_OFFSET)];
+		}
+		else
 		{
-			FOnlineSessionSetting Setting;
-			Packet >> Key;
-			Packet >> Setting;
-			SessionSettings.Set(Key, Setting);
+			UE_LOG_AB(Verbose, TEXT("Unknown interned setting key %llu in LAN packet"), KeyToken);
+			SessionSettings.Settings.Reset();
+			return false;
 		}
+
+		FOnlineSessionSetting Setting;
+		Packet.ReadCompactVariantData(Setting.Data);
+		uint8 AdvertisementType = 0;
+		Packet >> AdvertisementType;
+		Setting.AdvertisementType = static_cast<EOnlineDataAdvertisementType::Type>(AdvertisementType);
+		SessionSettings.Settings.Emplace(Key, MoveTemp(Setting));
 	}
 	
 	if (Packet.HasOverflow())
 	{
-		SessionSettings.Settings.Empty();
+		SessionSettings.Settings.Reset();
 		UE_LOG_AB(Verbose, TEXT("Packet overflow detected"));
+		return false;
 	}
+
+	return true;
 }
 
 void FOnlineSessionAccelByte::OnValidQueryPacketReceived(uint8* PacketData, int32 PacketLength, uint64 ClientNonce)
@@ -1556,8 +2217,7 @@ void FOnlineSessionAccelByte::OnValidQueryPacketReceived(uint8* PacketData, int3
 		{
 			FNboSerializeToBufferAccelByte Packet(LAN_BEACON_MAX_PACKET_SIZE);
 			LANSessionManager.CreateHostResponsePacket(Packet, ClientNonce);
-			AppendSessionToPacket(Packet, Session);
-			if (!Packet.HasOverflow())
+			if (AppendSessionToPacket(Packet, Session))
 			{
 				LANSessionManager.BroadcastPacket(Packet, Packet.GetByteCount());
 			}
@@ -1571,18 +2231,17 @@ void FOnlineSessionAccelByte::OnValidQueryPacketReceived(uint8* PacketData, int3
 
 void FOnlineSessionAccelByte::OnValidResponsePacketReceived(uint8* PacketData, int32 PacketLength)
 {
-	FOnlineSessionSettings NewServer;
 	if (SessionSearchHandle.IsValid())
 	{
-		// NOTE(Maxwell, 6/17/2021): For anyone else that might stumble upon this. This line creates the new search
-		// result, but also calls an `operator new` that's set up in the TArray header (Array.h, around line 3062),
-		// which will also allocate one uninitialized space in the array.
-		FOnlineSessionSearchResult* NewResult = new (SessionSearchHandle->SearchResults) FOnlineSessionSearchResult();
-		
-		NewResult->PingInMs = static_cast<int32>((FPlatformTime::Seconds() - LANPingStartSeconds) * 1000);
-		FOnlineSession* NewSession = &NewResult->Session;
-		FNboSerializeFromBufferAccelByte Packet(PacketData, PacketLength);		
-		ReadSessionFromPacket(Packet, NewSession);
+		// Parse into a local result first, so that responses from hosts on another packet version or with a malformed
+		// packet never show up in the search results
+		FOnlineSessionSearchResult NewResult;
+		NewResult.PingInMs = static_cast<int32>((FPlatformTime::Seconds() - LANPingStartSeconds) * 1000);
+		FNboSerializeFromBufferAccelByte Packet(PacketData, PacketLength);
+		if (ReadSessionFromPacket(Packet, &NewResult.Session))
+		{
+			SessionSearchHandle->SearchResults.Add(MoveTemp(NewResult));
+		}
 	}
 	else
 	{
@@ -1592,6 +2251,16 @@ void FOnlineSessionAccelByte::OnValidResponsePacketReceived(uint8* PacketData, i
 
 void FOnlineSessionAccelByte::OnLANSearchTimeout()
 {
+	// Hosts that did not answer this search have torn down their session, so drop the settings cached for them
+	for (auto It = LANHostSettingsCache.CreateIterator(); It; ++It)
+	{
+		if (!LANHostsAnsweredSearch.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+	LANHostsAnsweredSearch.Reset();
+
 	FinalizeLANSearch();
 	if (SessionSearchHandle.IsValid())
 	{
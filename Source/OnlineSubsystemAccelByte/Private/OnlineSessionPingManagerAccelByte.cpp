@@ -0,0 +1,507 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineSessionPingManagerAccelByte.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "OnlineSessionInterfaceAccelByte.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+// Pings are the magic bytes followed by a nonce, and a reply must echo all of it back
+#define ACCELBYTE_SESSION_PING_MAGIC 0x47504241 // "ABPG" read as little endian
+#define ACCELBYTE_SESSION_PING_PAYLOAD_SIZE 12
+
+// Number of cached host pings above which expired entries are removed whenever a new ping is cached
+#define ACCELBYTE_SESSION_PING_CACHE_PRUNE_THRESHOLD 256
+
+// Maximum number of pings the responder echoes per socket each tick, anything past this waits for the next tick
+#define ACCELBYTE_SESSION_PING_MAX_ECHOES_PER_TICK 256
+
+static void WriteSessionPingPayload(uint8* OutPayload, uint64 Nonce)
+{
+	const uint32 Magic = ACCELBYTE_SESSION_PING_MAGIC;
+	FMemory::Memcpy(OutPayload, &Magic, sizeof(uint32));
+	FMemory::Memcpy(OutPayload + sizeof(uint32), &Nonce, sizeof(uint64));
+}
+
+static bool IsSessionPingPayload(const uint8* Payload, int32 PayloadSize)
+{
+	uint32 Magic = 0;
+	if (PayloadSize != ACCELBYTE_SESSION_PING_PAYLOAD_SIZE)
+	{
+		return false;
+	}
+	FMemory::Memcpy(&Magic, Payload, sizeof(uint32));
+	return Magic == ACCELBYTE_SESSION_PING_MAGIC;
+}
+
+FOnlineSessionPingManagerAccelByte::FOnlineSessionPingManagerAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
+	: AccelByteSubsystem(InSubsystem)
+{
+}
+
+FOnlineSessionPingManagerAccelByte::~FOnlineSessionPingManagerAccelByte()
+{
+	StopPingResponder();
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem == nullptr)
+	{
+		return;
+	}
+
+	for (const FAccelByteInFlightPing& Ping : InFlightPings)
+	{
+		SocketSubsystem->DestroySocket(Ping.Socket);
+	}
+	for (const TPair<FName, TArray<FSocket*>>& ProtocolSockets : IdleSockets)
+	{
+		for (FSocket* Socket : ProtocolSockets.Value)
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+	}
+}
+
+TSharedPtr<FInternetAddr> FOnlineSessionPingManagerAccelByte::GetSearchResultPingAddr(const FOnlineSessionSearchResult& SearchResult) const
+{
+	// Nothing answers pings on the game port, so without a responder port there is nothing to ping
+	const int32 PingPort = AccelByteSubsystem->GetSettings().SessionPingPort;
+	if (PingPort <= 0)
+	{
+		return nullptr;
+	}
+
+	// P2P sessions have no address of their own to ping, only sessions with a server do
+	const TSharedPtr<FOnlineSessionInfoAccelByte> SessionInfo = StaticCastSharedPtr<FOnlineSessionInfoAccelByte>(SearchResult.Session.SessionInfo);
+	if (!SessionInfo.IsValid() || SessionInfo->GetHostAddr() == nullptr || !SessionInfo->GetHostAddr()->IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FInternetAddr> PingAddr = SessionInfo->GetHostAddr()->Clone();
+	PingAddr->SetPort(PingPort);
+	return PingAddr;
+}
+
+bool FOnlineSessionPingManagerAccelByte::PingSearchResults(const TSharedRef<FOnlineSessionSearch>& Search)
+{
+	bool bPingedAnyResult = false;
+	for (const FOnlineSessionSearchResult& SearchResult : Search->SearchResults)
+	{
+		const TSharedPtr<FInternetAddr> PingAddr = GetSearchResultPingAddr(SearchResult);
+		if (!PingAddr.IsValid())
+		{
+			continue;
+		}
+
+		// Results are matched back by session ID, as the search may have been refreshed and reordered by the time a reply arrives
+		const FString SessionId = SearchResult.GetSessionIdStr();
+		const TWeakPtr<FOnlineSessionSearch> WeakSearch = Search;
+		// Completion delegates are only ever held and fired by this manager, so capturing this is safe
+		PingHost(PingAddr.ToSharedRef(), FOnHostPingComplete::CreateLambda([this, WeakSearch, SessionId](int32 PingInMs) {
+			// A host that did not answer has no ping to report, so leave the result as it was rather than record a timeout
+			const TSharedPtr<FOnlineSessionSearch> PinnedSearch = WeakSearch.Pin();
+			if (PinnedSearch.IsValid() && PingInMs < MAX_QUERY_PING)
+			{
+				FOnlineSessionSearchResult* Result = PinnedSearch->SearchResults.FindByPredicate([&SessionId](const FOnlineSessionSearchResult& Candidate) {
+					return Candidate.GetSessionIdStr() == SessionId;
+				});
+				if (Result != nullptr)
+				{
+					Result->PingInMs = PingInMs;
+				}
+			}
+			TriggerOnSearchResultPingUpdatedDelegates(SessionId, PingInMs);
+		}));
+		bPingedAnyResult = true;
+	}
+
+	return bPingedAnyResult;
+}
+
+bool FOnlineSessionPingManagerAccelByte::PingSearchResult(const FOnlineSessionSearchResult& SearchResult)
+{
+	const TSharedPtr<FInternetAddr> PingAddr = GetSearchResultPingAddr(SearchResult);
+	if (!PingAddr.IsValid())
+	{
+		return false;
+	}
+
+	const FString SessionId = SearchResult.GetSessionIdStr();
+	PingHost(PingAddr.ToSharedRef(), FOnHostPingComplete::CreateLambda([this, SessionId](int32 PingInMs) {
+		TriggerOnSearchResultPingUpdatedDelegates(SessionId, PingInMs);
+	}));
+	return true;
+}
+
+void FOnlineSessionPingManagerAccelByte::PingHost(const TSharedRef<FInternetAddr>& HostAddr, const FOnHostPingComplete& Delegate)
+{
+	const FString HostKey = HostAddr->ToString(true);
+
+	const int32 CachedPingInMs = FindCachedPing(HostKey);
+	if (CachedPingInMs != INDEX_NONE)
+	{
+		Delegate.ExecuteIfBound(CachedPingInMs);
+		return;
+	}
+
+	FAccelByteHostPingRequest* PendingHost = PendingHosts.Find(HostKey);
+	if (PendingHost == nullptr)
+	{
+		PendingHost = &PendingHosts.Add(HostKey);
+		PendingHost->HostAddr = HostAddr;
+		QueuedHostKeys.Add(HostKey);
+	}
+	PendingHost->CompleteDelegates.Add(Delegate);
+}
+
+bool FOnlineSessionPingManagerAccelByte::GetCachedPing(const FOnlineSessionSearchResult& SearchResult, int32& OutPingInMs) const
+{
+	const TSharedPtr<FInternetAddr> PingAddr = GetSearchResultPingAddr(SearchResult);
+	return PingAddr.IsValid() && GetCachedHostPing(*PingAddr, OutPingInMs);
+}
+
+bool FOnlineSessionPingManagerAccelByte::GetCachedHostPing(const FInternetAddr& HostAddr, int32& OutPingInMs) const
+{
+	const int32 CachedPingInMs = FindCachedPing(HostAddr.ToString(true));
+	if (CachedPingInMs == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutPingInMs = CachedPingInMs;
+	return true;
+}
+
+int32 FOnlineSessionPingManagerAccelByte::FindCachedPing(const FString& HostKey) const
+{
+	FScopeLock ScopeLock(&HostPingCacheLock);
+	const TPair<int32, double>* CachedPing = HostPingCache.Find(HostKey);
+	if (CachedPing == nullptr || FPlatformTime::Seconds() - CachedPing->Value >= AccelByteSubsystem->GetSettings().SessionPingCacheTTLSeconds)
+	{
+		return INDEX_NONE;
+	}
+	return CachedPing->Key;
+}
+
+bool FOnlineSessionPingManagerAccelByte::StartPingResponder(int32 Port)
+{
+	StopPingResponder();
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem == nullptr || Port <= 0)
+	{
+		return false;
+	}
+
+	// IPv6 is bound first, as on platforms with dual stack sockets it also answers IPv4 and the IPv4 bind then fails
+	const FName ProtocolTypes[] = { FNetworkProtocolTypes::IPv6, FNetworkProtocolTypes::IPv4 };
+	for (const FName& ProtocolType : ProtocolTypes)
+	{
+		FSocket* Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("AccelByte session ping responder"), ProtocolType);
+		if (Socket == nullptr)
+		{
+			continue;
+		}
+
+		const TSharedRef<FInternetAddr> BindAddr = SocketSubsystem->CreateInternetAddr(ProtocolType);
+		BindAddr->SetAnyAddress();
+		BindAddr->SetPort(Port);
+		if (!Socket->SetNonBlocking(true) || !Socket->Bind(*BindAddr))
+		{
+			SocketSubsystem->DestroySocket(Socket);
+			continue;
+		}
+		ResponderSockets.Add(Socket);
+	}
+
+	if (ResponderSockets.Num() <= 0)
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to bind the session ping responder to port %d!"), Port);
+		return false;
+	}
+
+	ResponderPort = Port;
+	bIsResponderAutoStarted = false;
+	UE_LOG_AB(Log, TEXT("Answering session pings on port %d"), Port);
+	return true;
+}
+
+void FOnlineSessionPingManagerAccelByte::StopPingResponder()
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem != nullptr)
+	{
+		for (FSocket* Socket : ResponderSockets)
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+	}
+	ResponderSockets.Reset();
+	ResponderPort = 0;
+	bIsResponderAutoStarted = false;
+}
+
+void FOnlineSessionPingManagerAccelByte::UpdatePingResponder()
+{
+	// A responder that was started explicitly is left alone until it is stopped explicitly
+	if (ResponderPort > 0 && !bIsResponderAutoStarted)
+	{
+		return;
+	}
+
+	const int32 PingPort = AccelByteSubsystem->GetSettings().SessionPingPort;
+	bool bShouldRespond = PingPort > 0 && AccelByteSubsystem->IsDedicated();
+	if (PingPort > 0 && !bShouldRespond)
+	{
+		const FOnlineSessionAccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionAccelByte>(AccelByteSubsystem->GetSessionInterface());
+		bShouldRespond = SessionInterface.IsValid() && SessionInterface->IsHostingSession();
+	}
+
+	if (bShouldRespond && ResponderPort != PingPort)
+	{
+		// Only try once per port, so a port that cannot be bound does not log a warning every tick
+		StartPingResponder(PingPort);
+		ResponderPort = PingPort;
+		bIsResponderAutoStarted = true;
+	}
+	else if (!bShouldRespond && ResponderPort > 0)
+	{
+		StopPingResponder();
+	}
+}
+
+void FOnlineSessionPingManagerAccelByte::EchoPings()
+{
+	if (ResponderSockets.Num() <= 0)
+	{
+		return;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem == nullptr)
+	{
+		return;
+	}
+
+	for (FSocket* Socket : ResponderSockets)
+	{
+		const TSharedRef<FInternetAddr> FromAddr = SocketSubsystem->CreateInternetAddr(Socket->GetProtocol());
+		uint8 Buffer[64];
+		int32 BytesRead = 0;
+		for (int32 EchoCount = 0; EchoCount < ACCELBYTE_SESSION_PING_MAX_ECHOES_PER_TICK && Socket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *FromAddr); EchoCount++)
+		{
+			if (!IsSessionPingPayload(Buffer, BytesRead))
+			{
+				continue;
+			}
+
+			int32 BytesSent = 0;
+			Socket->SendTo(Buffer, BytesRead, BytesSent, *FromAddr);
+		}
+	}
+}
+
+void FOnlineSessionPingManagerAccelByte::Tick(float DeltaTime)
+{
+	UpdatePingResponder();
+	EchoPings();
+
+	if (InFlightPings.Num() <= 0 && QueuedHostKeys.Num() <= 0)
+	{
+		return;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem == nullptr)
+	{
+		return;
+	}
+
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	const double TimeoutSeconds = AccelByteSubsystem->GetSettings().SessionPingTimeoutSeconds;
+
+	// Completing a ping fires game delegates that may ping more hosts, so gather everything that finished first
+	TArray<TPair<FString, int32>> CompletedPings;
+	TArray<FString> TimedOutHostKeys;
+	for (int32 PingIndex = InFlightPings.Num() - 1; PingIndex >= 0; PingIndex--)
+	{
+		const FAccelByteInFlightPing& Ping = InFlightPings[PingIndex];
+
+		uint8 ExpectedPayload[ACCELBYTE_SESSION_PING_PAYLOAD_SIZE];
+		WriteSessionPingPayload(ExpectedPayload, Ping.Nonce);
+
+		int32 PingInMs = INDEX_NONE;
+		uint8 Buffer[64];
+		int32 BytesRead = 0;
+		const TSharedRef<FInternetAddr> FromAddr = SocketSubsystem->CreateInternetAddr(Ping.ProtocolType);
+		while (Ping.Socket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *FromAddr))
+		{
+			if (BytesRead == ACCELBYTE_SESSION_PING_PAYLOAD_SIZE && FMemory::Memcmp(Buffer, ExpectedPayload, ACCELBYTE_SESSION_PING_PAYLOAD_SIZE) == 0)
+			{
+				PingInMs = FMath::RoundToInt((CurrentTimeSeconds - Ping.SentTimeSeconds) * 1000.0);
+				break;
+			}
+		}
+
+		if (PingInMs != INDEX_NONE)
+		{
+			CompletedPings.Emplace(Ping.HostKey, PingInMs);
+		}
+		else if (CurrentTimeSeconds - Ping.SentTimeSeconds >= TimeoutSeconds)
+		{
+			TimedOutHostKeys.Add(Ping.HostKey);
+		}
+		else
+		{
+			continue;
+		}
+
+		IdleSockets.FindOrAdd(Ping.ProtocolType).Add(Ping.Socket);
+		InFlightPings.RemoveAtSwap(PingIndex);
+	}
+
+	while (QueuedHostKeys.Num() > 0 && SendNextQueuedPing())
+	{
+	}
+
+	for (const TPair<FString, int32>& CompletedPing : CompletedPings)
+	{
+		CompleteHostPing(CompletedPing.Key, CompletedPing.Value, true);
+	}
+	for (const FString& TimedOutHostKey : TimedOutHostKeys)
+	{
+		CompleteHostPing(TimedOutHostKey, MAX_QUERY_PING, false);
+	}
+}
+
+FSocket* FOnlineSessionPingManagerAccelByte::AcquireSocket(const FName& ProtocolType)
+{
+	TArray<FSocket*>* ProtocolIdleSockets = IdleSockets.Find(ProtocolType);
+	if (ProtocolIdleSockets != nullptr && ProtocolIdleSockets->Num() > 0)
+	{
+		return ProtocolIdleSockets->Pop(false);
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Once the pool is full, make room for a socket of this protocol by closing an idle one of another protocol
+	if (NumSocketsCreated >= AccelByteSubsystem->GetSettings().SessionPingMaxConcurrentPings)
+	{
+		TArray<FSocket*>* OtherIdleSockets = nullptr;
+		for (TPair<FName, TArray<FSocket*>>& ProtocolSockets : IdleSockets)
+		{
+			if (ProtocolSockets.Value.Num() > 0)
+			{
+				OtherIdleSockets = &ProtocolSockets.Value;
+				break;
+			}
+		}
+		if (OtherIdleSockets == nullptr)
+		{
+			return nullptr;
+		}
+		SocketSubsystem->DestroySocket(OtherIdleSockets->Pop(false));
+		NumSocketsCreated--;
+	}
+
+	FSocket* Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("AccelByte session ping"), ProtocolType);
+	if (Socket == nullptr)
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to create a %s socket to ping session hosts!"), *ProtocolType.ToString());
+		return nullptr;
+	}
+
+	Socket->SetNonBlocking(true);
+	NumSocketsCreated++;
+	return Socket;
+}
+
+bool FOnlineSessionPingManagerAccelByte::SendNextQueuedPing()
+{
+	const FString HostKey = QueuedHostKeys[0];
+	const FAccelByteHostPingRequest* PendingHost = PendingHosts.Find(HostKey);
+	if (PendingHost == nullptr)
+	{
+		QueuedHostKeys.RemoveAt(0, 1, false);
+		return true;
+	}
+
+	// Hosts are pinged from a socket of their own protocol, so that IPv6 hosts are reached as well as IPv4 ones
+	const FName ProtocolType = PendingHost->HostAddr->GetProtocolType();
+	FSocket* Socket = AcquireSocket(ProtocolType);
+	if (Socket == nullptr)
+	{
+		return false;
+	}
+	QueuedHostKeys.RemoveAt(0, 1, false);
+
+	// Throw away anything left over from an earlier ping on this socket, so a late reply is never read as this one
+	uint8 Buffer[64];
+	int32 BytesRead = 0;
+	const TSharedRef<FInternetAddr> FromAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr(ProtocolType);
+	while (Socket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *FromAddr))
+	{
+	}
+
+	FAccelByteInFlightPing Ping;
+	Ping.Socket = Socket;
+	Ping.ProtocolType = ProtocolType;
+	Ping.HostKey = HostKey;
+	Ping.Nonce = NextPingNonce++;
+	Ping.SentTimeSeconds = FPlatformTime::Seconds();
+
+	uint8 Payload[ACCELBYTE_SESSION_PING_PAYLOAD_SIZE];
+	WriteSessionPingPayload(Payload, Ping.Nonce);
+
+	int32 BytesSent = 0;
+	if (!Socket->SendTo(Payload, ACCELBYTE_SESSION_PING_PAYLOAD_SIZE, BytesSent, *PendingHost->HostAddr))
+	{
+		UE_LOG_AB(Verbose, TEXT("Failed to send ping to session host %s"), *HostKey);
+		IdleSockets.FindOrAdd(ProtocolType).Add(Socket);
+		CompleteHostPing(HostKey, MAX_QUERY_PING, false);
+		return true;
+	}
+
+	InFlightPings.Add(Ping);
+	return true;
+}
+
+void FOnlineSessionPingManagerAccelByte::CompleteHostPing(const FString& HostKey, int32 PingInMs, bool bWasAnswered)
+{
+	if (bWasAnswered)
+	{
+		FScopeLock ScopeLock(&HostPingCacheLock);
+		const double CurrentTimeSeconds = FPlatformTime::Seconds();
+		if (HostPingCache.Num() >= ACCELBYTE_SESSION_PING_CACHE_PRUNE_THRESHOLD)
+		{
+			const double CacheTTLSeconds = AccelByteSubsystem->GetSettings().SessionPingCacheTTLSeconds;
+			for (auto CacheIt = HostPingCache.CreateIterator(); CacheIt; ++CacheIt)
+			{
+				if (CurrentTimeSeconds - CacheIt.Value().Value >= CacheTTLSeconds)
+				{
+					CacheIt.RemoveCurrent();
+				}
+			}
+		}
+		HostPingCache.Add(HostKey, TPair<int32, double>(PingInMs, CurrentTimeSeconds));
+	}
+
+	FAccelByteHostPingRequest PendingHost;
+	if (!PendingHosts.RemoveAndCopyValue(HostKey, PendingHost))
+	{
+		return;
+	}
+
+	for (const FOnHostPingComplete& Delegate : PendingHost.CompleteDelegates)
+	{
+		Delegate.ExecuteIfBound(PingInMs);
+	}
+}
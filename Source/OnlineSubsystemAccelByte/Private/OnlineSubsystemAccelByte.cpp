@@ -14,6 +14,11 @@
 #include "OnlineUserCacheAccelByte.h"
 #include "OnlineAgreementInterfaceAccelByte.h"
 #include "OnlineWalletInterfaceAccelByte.h"
+#include "OnlineBootstrapAccelByte.h"
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "OnlineQosManagerAccelByte.h"
+#include "OnlineSessionPingManagerAccelByte.h"
+#include "OnlineNotificationDispatcherAccelByte.h"
 #include "OnlineSubsystemAccelByteModule.h"
 #include "Api/AccelByteLobbyApi.h"
 #include "Models/AccelByteLobbyModels.h"
@@ -26,6 +31,7 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "ExecTests/ExecTestBase.h"
+#include "ExecTests/ExecTestSessionPing.h"
 #endif
 
 #define LOCTEXT_NAMESPACE "FOnlineSubsystemAccelByte"
@@ -33,6 +39,14 @@
 
 bool FOnlineSubsystemAccelByte::Init()
 {
+	// Parse settings before anything else is created, so that every interface sees them from its constructor onward
+	{
+		FScopeLock ScopeLock(&SettingsReloadLock);
+		OwnedSettings = MakeUnique<FOnlineSubsystemAccelByteSettings>();
+		OwnedSettings->LoadFromConfig();
+		CurrentSettings = OwnedSettings.Get();
+	}
+
 	// Create each shared instance of our interface implementations, passing in ourselves as the parent
 	SessionInterface = MakeShared<FOnlineSessionAccelByte, ESPMode::ThreadSafe>(this);
 	IdentityInterface = MakeShared<FOnlineIdentityAccelByte, ESPMode::ThreadSafe>(this);
@@ -48,7 +62,14 @@ bool FOnlineSubsystemAccelByte::Init()
 	EntitlementsInterface = MakeShared<FOnlineEntitlementsAccelByte, ESPMode::ThreadSafe>(this);
 	StoreV2Interface = MakeShared<FOnlineStoreV2AccelByte, ESPMode::ThreadSafe>(this);
 	PurchaseInterface = MakeShared<FOnlinePurchaseAccelByte, ESPMode::ThreadSafe>(this);
+	BootstrapInterface = MakeShared<FOnlineBootstrapAccelByte, ESPMode::ThreadSafe>(this);
+	QosManager = MakeShared<FOnlineQosManagerAccelByte, ESPMode::ThreadSafe>(this);
+	SessionPingManager = MakeShared<FOnlineSessionPingManagerAccelByte, ESPMode::ThreadSafe>(this);
+	NotificationDispatcher = MakeShared<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe>();
 	
+	// Create the metrics registry before the task manager so that every task is able to report into it
+	AsyncTaskMetrics = MakeShared<FOnlineAsyncTaskMetricsAccelByte, ESPMode::ThreadSafe>();
+
 	// Create an async task manager and a thread for the manager to process tasks on
 	AsyncTaskManager = MakeShared<FOnlineAsyncTaskManagerAccelByte, ESPMode::ThreadSafe>(this);
 	AsyncTaskManagerThread.Reset(FRunnableThread::Create(AsyncTaskManager.Get(), *FString::Printf(TEXT("OnlineAsyncTaskThread %s"), *InstanceName.ToString())));
@@ -58,11 +79,9 @@ bool FOnlineSubsystemAccelByte::Init()
 	{
 		// Note @damar disabling this, this should be handled for each user.
 		IdentityInterface->AddOnLoginCompleteDelegate_Handle(i, FOnLoginCompleteDelegate::CreateRaw(this, &FOnlineSubsystemAccelByte::OnLoginCallback));
+		IdentityInterface->AddOnLogoutCompleteDelegate_Handle(i, FOnLogoutCompleteDelegate::CreateRaw(this, &FOnlineSubsystemAccelByte::OnLogoutCallback));
 	}
 
-	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bAutoLobbyConnectAfterLoginSuccess"), bIsAutoLobbyConnectAfterLoginSuccess, GEngineIni);
-	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bMultipleLocalUsersEnabled"), bIsMultipleLocalUsersEnabled, GEngineIni);
-	
 	return true;
 }
 
@@ -101,6 +120,17 @@ bool FOnlineSubsystemAccelByte::Shutdown()
 	EntitlementsInterface.Reset();
 	StoreV2Interface.Reset();
 	PurchaseInterface.Reset();
+	BootstrapInterface.Reset();
+	QosManager.Reset();
+	SessionPingManager.Reset();
+	AsyncTaskMetrics.Reset();
+
+	// Drop anything still queued, as the handlers would run against interfaces that are going away
+	if (NotificationDispatcher.IsValid())
+	{
+		NotificationDispatcher->Reset();
+		NotificationDispatcher.Reset();
+	}
 	return true;
 }
 
@@ -190,14 +220,70 @@ FOnlineWalletAccelBytePtr FOnlineSubsystemAccelByte::GetWalletInterface() const
 	return WalletInterface;
 }
 
+FOnlineBootstrapAccelBytePtr FOnlineSubsystemAccelByte::GetBootstrapInterface() const
+{
+	return BootstrapInterface;
+}
+
+FOnlineAsyncTaskMetricsAccelBytePtr FOnlineSubsystemAccelByte::GetAsyncTaskMetrics() const
+{
+	return AsyncTaskMetrics;
+}
+
+FOnlineQosManagerAccelBytePtr FOnlineSubsystemAccelByte::GetQosManager() const
+{
+	return QosManager;
+}
+
+FOnlineSessionPingManagerAccelBytePtr FOnlineSubsystemAccelByte::GetSessionPingManager() const
+{
+	return SessionPingManager;
+}
+
+FOnlineNotificationDispatcherAccelBytePtr FOnlineSubsystemAccelByte::GetNotificationDispatcher() const
+{
+	return NotificationDispatcher;
+}
+
+const FOnlineSubsystemAccelByteSettings& FOnlineSubsystemAccelByte::GetSettings() const
+{
+	// Sequentially consistent so that a reader on another thread sees the fully parsed settings the pointer refers to
+	const FOnlineSubsystemAccelByteSettings* Settings = CurrentSettings.Load(EMemoryOrder::SequentiallyConsistent);
+	return (Settings != nullptr) ? *Settings : DefaultSettings;
+}
+
+void FOnlineSubsystemAccelByte::ReloadSettings()
+{
+	// GConfig only holds what was read at startup, so re-read our section from disk to pick up edits made since then
+	FOnlineSubsystemAccelByteSettings::ReloadConfigSection();
+
+	TUniquePtr<FOnlineSubsystemAccelByteSettings> Settings = MakeUnique<FOnlineSubsystemAccelByteSettings>();
+	Settings->LoadFromConfig();
+
+	FScopeLock ScopeLock(&SettingsReloadLock);
+	CurrentSettings = Settings.Get();
+	if (OwnedSettings.IsValid())
+	{
+		RetiredSettings.Add(MoveTemp(OwnedSettings));
+	}
+	OwnedSettings = MoveTemp(Settings);
+
+	UE_LOG_AB(Log, TEXT("Reloaded OnlineSubsystemAccelByte settings from the engine ini"));
+}
+
 bool FOnlineSubsystemAccelByte::IsAutoConnectLobby() const
 {
-	return bIsAutoLobbyConnectAfterLoginSuccess;
+	return GetSettings().bAutoLobbyConnectAfterLoginSuccess;
+}
+
+bool FOnlineSubsystemAccelByte::IsAutoBootstrapAfterLogin() const
+{
+	return GetSettings().bAutoBootstrapAfterLoginSuccess;
 }
 
 bool FOnlineSubsystemAccelByte::IsMultipleLocalUsersEnabled() const
 {
-	return bIsMultipleLocalUsersEnabled;
+	return GetSettings().bMultipleLocalUsersEnabled;
 }
 
 
@@ -215,8 +301,55 @@ bool FOnlineSubsystemAccelByte::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputD
 		{
 			bWasHandled = UserInterface->TestExec(InWorld, Cmd, Ar);
 		}
+		else if (FParse::Command(&Cmd, TEXT("SESSIONPING")))
+		{
+			const FString PortStr = FParse::Token(Cmd, false);
+			const int32 Port = PortStr.IsEmpty() ? 17778 : FCString::Atoi(*PortStr);
+
+			TSharedPtr<FExecTestSessionPing> SessionPingTest = MakeShared<FExecTestSessionPing>(InWorld, ACCELBYTE_SUBSYSTEM, Port);
+			SessionPingTest->Run();
+
+			AddExecTest(SessionPingTest);
+			bWasHandled = true;
+		}
 #endif
 	}
+	// Dump a table of latency and outcome for every async task type that has run, or clear it with TASKMETRICS RESET
+	else if (FParse::Command(&Cmd, TEXT("TASKMETRICS")) && AsyncTaskMetrics.IsValid())
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			AsyncTaskMetrics->ResetMetrics();
+		}
+		else
+		{
+			AsyncTaskMetrics->DumpMetrics(Ar);
+		}
+		bWasHandled = true;
+	}
+	// Dump the Lobby notification queue depth and the time spent handling each kind of notification, or clear it with ABNOTIFICATIONS RESET
+	else if (FParse::Command(&Cmd, TEXT("ABNOTIFICATIONS")) && NotificationDispatcher.IsValid())
+	{
+		if (FParse::Command(&Cmd, TEXT("RESET")))
+		{
+			NotificationDispatcher->ResetStats();
+		}
+		else
+		{
+			NotificationDispatcher->DumpStats(Ar);
+		}
+		bWasHandled = true;
+	}
+	// Dump the settings parsed from the engine ini, or re-read them from disk with ABSETTINGS RELOAD
+	else if (FParse::Command(&Cmd, TEXT("ABSETTINGS")))
+	{
+		if (FParse::Command(&Cmd, TEXT("RELOAD")))
+		{
+			ReloadSettings();
+		}
+		GetSettings().Dump(Ar);
+		bWasHandled = true;
+	}
 	
 	// If we didn't handle any exec tests, then just pass handling to the super method
 	if (!bWasHandled)
@@ -253,11 +386,42 @@ bool FOnlineSubsystemAccelByte::Tick(float DeltaTime)
 		AsyncTaskManager->GameTick();
 	}
 
+	if (NotificationDispatcher.IsValid())
+	{
+		const FOnlineSubsystemAccelByteSettings& Settings = GetSettings();
+		NotificationDispatcher->Tick(Settings.LobbyNotificationsPerFrame, Settings.LobbyNotificationFrameBudgetMs / 1000.0);
+	}
+
+	if (UserCache.IsValid())
+	{
+		UserCache->FlushQueuedQueries(FPlatformTime::Seconds());
+	}
+
+	if (BootstrapInterface.IsValid())
+	{
+		BootstrapInterface->Tick(FPlatformTime::Seconds());
+	}
+
 	if(SessionInterface.IsValid())
 	{
 		SessionInterface->Tick(DeltaTime);
 	}
 
+	if (PartyInterface.IsValid())
+	{
+		PartyInterface->Tick(DeltaTime);
+	}
+
+	if (QosManager.IsValid())
+	{
+		QosManager->Tick(DeltaTime);
+	}
+
+	if (SessionPingManager.IsValid())
+	{
+		SessionPingManager->Tick(DeltaTime);
+	}
+
 	// If we have automation testing enabled, check if we have any exec tests that are complete and if so, remove them
 #if WITH_DEV_AUTOMATION_TESTS
 	ActiveExecTests.RemoveAll([](const TSharedPtr<FExecTestBase>& ExecTest) { return ExecTest->bIsComplete; });
@@ -415,7 +579,28 @@ void FOnlineSubsystemAccelByte::OnLoginCallback(int LocalUserNum, bool bWasSucce
 		if (ApiClient.IsValid())
 		{
 			ApiClient->Lobby.SetMessageNotifDelegate(Delegate);
-			if (bIsAutoLobbyConnectAfterLoginSuccess)
+
+			// Start pinging QoS regions right away so that latencies are ready by the time matchmaking is started
+			if (QosManager.IsValid())
+			{
+				QosManager->StartLatencyRefresh(LocalUserNum);
+			}
+
+			// Read the party a previous session persisted now, so it can be shown without touching disk on the game thread
+			if (PartyInterface.IsValid())
+			{
+				PartyInterface->LoadPartySnapshot(FUniqueNetIdAccelByteUser::Cast(UserId));
+			}
+
+			if (IsAutoBootstrapAfterLogin())
+			{
+				// The bootstrap connects lobby itself as its first stage, alongside everything that does not need lobby
+				if (BootstrapInterface.IsValid())
+				{
+					BootstrapInterface->StartPostLoginBootstrap(LocalUserNum);
+				}
+			}
+			else if (IsAutoConnectLobby())
 			{
 				if (IdentityInterface.IsValid())
 				{
@@ -426,6 +611,31 @@ void FOnlineSubsystemAccelByte::OnLoginCallback(int LocalUserNum, bool bWasSucce
 	}
 }
 
+void FOnlineSubsystemAccelByte::OnLogoutCallback(int LocalUserNum, bool bWasSuccessful)
+{
+	// The user is logged out locally whether or not the backend call succeeded, so always drop their state
+	if (BootstrapInterface.IsValid())
+	{
+		BootstrapInterface->CancelPostLoginBootstrap(LocalUserNum);
+	}
+
+	// Notifications still queued for the user would act on state that belongs to whoever logs in next, so drop them
+	if (NotificationDispatcher.IsValid())
+	{
+		NotificationDispatcher->PurgeUser(LocalUserNum);
+	}
+
+	// The last known party belongs to the user that logged out, so forget it and its file rather than show it to whoever
+	// logs in next
+	const TSharedPtr<const FUniqueNetId> LocalUserId = IdentityInterface.IsValid() ? IdentityInterface->GetUniquePlayerId(LocalUserNum) : nullptr;
+	if (PartyInterface.IsValid() && LocalUserId.IsValid())
+	{
+		const TSharedRef<const FUniqueNetIdAccelByteUser> AccelByteUserId = FUniqueNetIdAccelByteUser::Cast(*LocalUserId);
+		PartyInterface->RemoveQueuedPartyStorages(AccelByteUserId);
+		PartyInterface->RemovePartySnapshot(AccelByteUserId);
+	}
+}
+
 void FOnlineSubsystemAccelByte::OnMessageNotif(const FAccelByteModelsNotificationMessage& InMessage, int32 LocalUserNum)
 {
 	UE_LOG_AB(Verbose, TEXT("Got freeform notification from backend at %s!\nTopic: %s\nPayload: %s"), *InMessage.SentAt.ToString(), *InMessage.Topic, *InMessage.Payload);
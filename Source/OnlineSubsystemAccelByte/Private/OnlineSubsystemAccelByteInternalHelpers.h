@@ -19,7 +19,7 @@
   * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
   * @param Args Corresponds to the types set in Format, just like in UE_LOG
   */
-#define AB_OSS_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
+#define AB_OSS_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format, ANSI_TO_TCHAR(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
 
 /**
  * Simple macro for logging a trace for when an interface method begins. Should only be called on interfaces with the parent
@@ -39,7 +39,7 @@
  * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
  * @param Args Corresponds to the types set in Format, just like in UE_LOG
  */
-#define AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
+#define AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format, ANSI_TO_TCHAR(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
 
 /**
  * Macro for logging a trace when an interface method has finished execution. Same as AB_OSS_INTERFACE_TRACE_END_VERBOSITY, except this will
@@ -58,7 +58,7 @@
   * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
   * @param Args Corresponds to the types set in Format, just like in UE_LOG
   */
-#define AB_OSS_GENERIC_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s was called. Args: ") Format, *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_GENERIC_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s was called. Args: ") Format, ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 
 /**
  * Simple macro for logging a trace for when an method begins in a class that doesn't have a subsystem instance attached.
@@ -77,7 +77,7 @@
  * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
  * @param Args Corresponds to the types set in Format, just like in UE_LOG
  */
-#define AB_OSS_GENERIC_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s has finished execution. ") Format, *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_GENERIC_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s has finished execution. ") Format, ANSI_TO_TCHAR(__func__), ##__VA_ARGS__)
 
 /**
  * Macro for logging a trace when a method has finished execution in a class without a subsystem instance attached.
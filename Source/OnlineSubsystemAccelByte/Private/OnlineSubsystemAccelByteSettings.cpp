@@ -0,0 +1,116 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#include "OnlineSubsystemAccelByteSettings.h"
+#include "Misc/ConfigCacheIni.h"
+
+#define ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION TEXT("OnlineSubsystemAccelByte")
+
+void FOnlineSubsystemAccelByteSettings::LoadFromConfig()
+{
+	GConfig->GetBool(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("bMultipleLocalUsersEnabled"), bMultipleLocalUsersEnabled, GEngineIni);
+	GConfig->GetBool(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("bAutoLobbyConnectAfterLoginSuccess"), bAutoLobbyConnectAfterLoginSuccess, GEngineIni);
+	GConfig->GetBool(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("bAutoBootstrapAfterLoginSuccess"), bAutoBootstrapAfterLoginSuccess, GEngineIni);
+	GConfig->GetBool(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("bAutoSendReadyConsent"), bAutoSendReadyConsent, GEngineIni);
+	GConfig->GetBool(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("bEnablePolicyContentDiskCache"), bEnablePolicyContentDiskCache, GEngineIni);
+	GConfig->GetBool(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("bEnablePartySnapshotDiskCache"), bEnablePartySnapshotDiskCache, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("BootstrapStageTimeoutSeconds"), BootstrapStageTimeoutSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("UserCachePurgeTimeoutSeconds"), UserCachePurgeTimeoutSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("UserQueryBatchWindowMs"), UserQueryBatchWindowMs, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("WalletCacheTTLSeconds"), WalletCacheTTLSeconds, GEngineIni);
+	GConfig->GetInt(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("WalletTransactionStreamCapacity"), WalletTransactionStreamCapacity, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionUpdateIntervalSeconds"), SessionUpdateIntervalSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionSearchCacheTTLSeconds"), SessionSearchCacheTTLSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionSearchCacheIdleTimeoutSeconds"), SessionSearchCacheIdleTimeoutSeconds, GEngineIni);
+	GConfig->GetInt(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionPingPort"), SessionPingPort, GEngineIni);
+	GConfig->GetInt(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionPingMaxConcurrentPings"), SessionPingMaxConcurrentPings, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionPingTimeoutSeconds"), SessionPingTimeoutSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("SessionPingCacheTTLSeconds"), SessionPingCacheTTLSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PartyStorageWriteCoalesceWindowSeconds"), PartyStorageWriteCoalesceWindowSeconds, GEngineIni);
+	GConfig->GetInt(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PartyStorageWriteMaxRetries"), PartyStorageWriteMaxRetries, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PartyInviteTTLSeconds"), PartyInviteTTLSeconds, GEngineIni);
+	GConfig->GetInt(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("MaxPartyInvitesPerUser"), MaxPartyInvitesPerUser, GEngineIni);
+	GConfig->GetInt(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("LobbyNotificationsPerFrame"), LobbyNotificationsPerFrame, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("LobbyNotificationFrameBudgetMs"), LobbyNotificationFrameBudgetMs, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PendingMatchWaitTimeIncreaseSeconds"), PendingMatchWaitTimeIncreaseSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PendingMatchMaxWaitTimeSeconds"), PendingMatchMaxWaitTimeSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PendingMatchLatencyWeight"), PendingMatchLatencyWeight, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PendingMatchAllyOverlapWeight"), PendingMatchAllyOverlapWeight, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("PendingMatchAgeWeight"), PendingMatchAgeWeight, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("QosLatencyRefreshIntervalSeconds"), QosLatencyRefreshIntervalSeconds, GEngineIni);
+	GConfig->GetDouble(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, TEXT("QosLatencySmoothingFactor"), QosLatencySmoothingFactor, GEngineIni);
+
+	BootstrapStageTimeoutSeconds = FMath::Max(BootstrapStageTimeoutSeconds, 0.0);
+	UserQueryBatchWindowMs = FMath::Max(UserQueryBatchWindowMs, 0.0);
+	WalletTransactionStreamCapacity = FMath::Max(WalletTransactionStreamCapacity, 1);
+	SessionSearchCacheTTLSeconds = FMath::Max(SessionSearchCacheTTLSeconds, 0.0);
+	SessionPingMaxConcurrentPings = FMath::Max(SessionPingMaxConcurrentPings, 1);
+	SessionPingTimeoutSeconds = FMath::Max(SessionPingTimeoutSeconds, 0.1);
+	PartyStorageWriteCoalesceWindowSeconds = FMath::Max(PartyStorageWriteCoalesceWindowSeconds, 0.0);
+	PartyStorageWriteMaxRetries = FMath::Max(PartyStorageWriteMaxRetries, 0);
+	PartyInviteTTLSeconds = FMath::Max(PartyInviteTTLSeconds, 0.0);
+	MaxPartyInvitesPerUser = FMath::Max(MaxPartyInvitesPerUser, 1);
+	LobbyNotificationsPerFrame = FMath::Max(LobbyNotificationsPerFrame, 1);
+	LobbyNotificationFrameBudgetMs = FMath::Max(LobbyNotificationFrameBudgetMs, 0.0);
+	PendingMatchMaxWaitTimeSeconds = FMath::Max(PendingMatchMaxWaitTimeSeconds, 0.0);
+	QosLatencyRefreshIntervalSeconds = FMath::Max(QosLatencyRefreshIntervalSeconds, 1.0);
+	QosLatencySmoothingFactor = FMath::Clamp(QosLatencySmoothingFactor, 0.01, 1.0);
+}
+
+void FOnlineSubsystemAccelByteSettings::ReloadConfigSection()
+{
+	FConfigFile* EngineConfig = GConfig->FindConfigFile(GEngineIni);
+	if (EngineConfig == nullptr)
+	{
+		return;
+	}
+
+	// Build a private copy of the engine ini hierarchy, and only copy our section from it into the live config
+	FConfigFile FreshEngineConfig;
+	FConfigCacheIni::LoadLocalIniFile(FreshEngineConfig, TEXT("Engine"), true);
+
+	EngineConfig->Remove(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION);
+	const FConfigSection* FreshSection = FreshEngineConfig.Find(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION);
+	if (FreshSection != nullptr)
+	{
+		EngineConfig->Add(ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION, *FreshSection);
+	}
+}
+
+void FOnlineSubsystemAccelByteSettings::Dump(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("[%s]"), ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION);
+	Ar.Logf(TEXT("bMultipleLocalUsersEnabled=%s"), LexToString(bMultipleLocalUsersEnabled));
+	Ar.Logf(TEXT("bAutoLobbyConnectAfterLoginSuccess=%s"), LexToString(bAutoLobbyConnectAfterLoginSuccess));
+	Ar.Logf(TEXT("bAutoBootstrapAfterLoginSuccess=%s"), LexToString(bAutoBootstrapAfterLoginSuccess));
+	Ar.Logf(TEXT("bAutoSendReadyConsent=%s"), LexToString(bAutoSendReadyConsent));
+	Ar.Logf(TEXT("bEnablePolicyContentDiskCache=%s"), LexToString(bEnablePolicyContentDiskCache));
+	Ar.Logf(TEXT("bEnablePartySnapshotDiskCache=%s"), LexToString(bEnablePartySnapshotDiskCache));
+	Ar.Logf(TEXT("BootstrapStageTimeoutSeconds=%.2f"), BootstrapStageTimeoutSeconds);
+	Ar.Logf(TEXT("UserCachePurgeTimeoutSeconds=%.2f"), UserCachePurgeTimeoutSeconds);
+	Ar.Logf(TEXT("UserQueryBatchWindowMs=%.2f"), UserQueryBatchWindowMs);
+	Ar.Logf(TEXT("WalletCacheTTLSeconds=%.2f"), WalletCacheTTLSeconds);
+	Ar.Logf(TEXT("WalletTransactionStreamCapacity=%d"), WalletTransactionStreamCapacity);
+	Ar.Logf(TEXT("SessionUpdateIntervalSeconds=%.2f"), SessionUpdateIntervalSeconds);
+	Ar.Logf(TEXT("SessionSearchCacheTTLSeconds=%.2f"), SessionSearchCacheTTLSeconds);
+	Ar.Logf(TEXT("SessionSearchCacheIdleTimeoutSeconds=%.2f"), SessionSearchCacheIdleTimeoutSeconds);
+	Ar.Logf(TEXT("SessionPingPort=%d"), SessionPingPort);
+	Ar.Logf(TEXT("SessionPingMaxConcurrentPings=%d"), SessionPingMaxConcurrentPings);
+	Ar.Logf(TEXT("SessionPingTimeoutSeconds=%.2f"), SessionPingTimeoutSeconds);
+	Ar.Logf(TEXT("SessionPingCacheTTLSeconds=%.2f"), SessionPingCacheTTLSeconds);
+	Ar.Logf(TEXT("PartyStorageWriteCoalesceWindowSeconds=%.2f"), PartyStorageWriteCoalesceWindowSeconds);
+	Ar.Logf(TEXT("PartyStorageWriteMaxRetries=%d"), PartyStorageWriteMaxRetries);
+	Ar.Logf(TEXT("PartyInviteTTLSeconds=%.2f"), PartyInviteTTLSeconds);
+	Ar.Logf(TEXT("MaxPartyInvitesPerUser=%d"), MaxPartyInvitesPerUser);
+	Ar.Logf(TEXT("LobbyNotificationsPerFrame=%d"), LobbyNotificationsPerFrame);
+	Ar.Logf(TEXT("LobbyNotificationFrameBudgetMs=%.2f"), LobbyNotificationFrameBudgetMs);
+	Ar.Logf(TEXT("PendingMatchWaitTimeIncreaseSeconds=%.2f"), PendingMatchWaitTimeIncreaseSeconds);
+	Ar.Logf(TEXT("PendingMatchMaxWaitTimeSeconds=%.2f"), PendingMatchMaxWaitTimeSeconds);
+	Ar.Logf(TEXT("PendingMatchLatencyWeight=%.2f"), PendingMatchLatencyWeight);
+	Ar.Logf(TEXT("PendingMatchAllyOverlapWeight=%.2f"), PendingMatchAllyOverlapWeight);
+	Ar.Logf(TEXT("PendingMatchAgeWeight=%.2f"), PendingMatchAgeWeight);
+	Ar.Logf(TEXT("QosLatencyRefreshIntervalSeconds=%.2f"), QosLatencyRefreshIntervalSeconds);
+	Ar.Logf(TEXT("QosLatencySmoothingFactor=%.2f"), QosLatencySmoothingFactor);
+}
+
+#undef ONLINE_SUBSYSTEM_ACCELBYTE_SETTINGS_SECTION
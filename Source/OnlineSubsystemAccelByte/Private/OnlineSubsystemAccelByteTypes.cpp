@@ -9,6 +9,7 @@
 #include "SocketSubsystem.h"
 #include "OnlineSubsystemAccelByteModule.h"
 #include "OnlineSubsystemAccelByteDefines.h"
+#include "FNboSerializeToBufferAccelByte.h"
 #include "Misc/Base64.h"
 #include "JsonObjectConverter.h"
 
@@ -38,6 +39,269 @@ bool IsAccelByteIDValid(const FString& AccelByteId)
 	return true;
 }
 
+#pragma region Binary ID Encoding
+
+// Flags written after the version byte of a binary ID, describing how the rest of the encoding is laid out
+#define ACCELBYTE_BINARY_ID_FLAG_UUID (1 << 0)
+#define ACCELBYTE_BINARY_ID_FLAG_HYPHENATED_UUID (1 << 1)
+#define ACCELBYTE_BINARY_ID_FLAG_PLATFORM (1 << 2)
+#define ACCELBYTE_BINARY_ID_FLAG_KNOWN_PLATFORM_TYPE (1 << 3)
+#define ACCELBYTE_BINARY_ID_FLAG_RAW_STRING (1 << 4)
+
+#define ACCELBYTE_UUID_BYTE_LENGTH 16
+
+/**
+ * Platform types that are written as an index into this list rather than by name. Only ever append to this list, as
+ * removing or reordering entries changes the meaning of IDs already encoded with ACCELBYTE_BINARY_ID_VERSION.
+ */
+static const TCHAR* const AccelByteBinaryIdPlatformTypes[] = {
+	TEXT("GDK"),
+	TEXT("Live"),
+	TEXT("PS4"),
+	TEXT("PS5"),
+	TEXT("STEAM"),
+};
+
+static int32 LowerHexCharToNibble(TCHAR Character)
+{
+	if (Character >= TEXT('0') && Character <= TEXT('9'))
+	{
+		return Character - TEXT('0');
+	}
+	if (Character >= TEXT('a') && Character <= TEXT('f'))
+	{
+		return Character - TEXT('a') + 10;
+	}
+	return INDEX_NONE;
+}
+
+/**
+ * Pack a lowercase UUID, with or without hyphens, into 16 bytes. Anything else, including uppercase hex, is left to be
+ * sent as a string so that the ID always decodes back to exactly the same text.
+ */
+static bool TryPackUuid(const FString& Id, uint8* OutBytes, bool& bOutIsHyphenated)
+{
+	bOutIsHyphenated = (Id.Len() == ACCELBYTE_ID_LENGTH + 4);
+	if (Id.Len() != ACCELBYTE_ID_LENGTH && !bOutIsHyphenated)
+	{
+		return false;
+	}
+
+	int32 ByteIndex = 0;
+	for (int32 CharIndex = 0; CharIndex < Id.Len(); CharIndex++)
+	{
+		if (bOutIsHyphenated && (CharIndex == 8 || CharIndex == 13 || CharIndex == 18 || CharIndex == 23))
+		{
+			if (Id[CharIndex] != TEXT('-'))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const int32 HighNibble = LowerHexCharToNibble(Id[CharIndex]);
+		const int32 LowNibble = (CharIndex + 1 < Id.Len()) ? LowerHexCharToNibble(Id[CharIndex + 1]) : INDEX_NONE;
+		if (HighNibble == INDEX_NONE || LowNibble == INDEX_NONE || ByteIndex >= ACCELBYTE_UUID_BYTE_LENGTH)
+		{
+			return false;
+		}
+		OutBytes[ByteIndex++] = static_cast<uint8>((HighNibble << 4) | LowNibble);
+		CharIndex++;
+	}
+
+	return ByteIndex == ACCELBYTE_UUID_BYTE_LENGTH;
+}
+
+static FString UnpackUuid(const uint8* Bytes, bool bIsHyphenated)
+{
+	static const TCHAR HexChars[] = TEXT("0123456789abcdef");
+
+	FString Id;
+	Id.Reserve(ACCELBYTE_ID_LENGTH + 4);
+	for (int32 ByteIndex = 0; ByteIndex < ACCELBYTE_UUID_BYTE_LENGTH; ByteIndex++)
+	{
+		if (bIsHyphenated && (ByteIndex == 4 || ByteIndex == 6 || ByteIndex == 8 || ByteIndex == 10))
+		{
+			Id.AppendChar(TEXT('-'));
+		}
+		Id.AppendChar(HexChars[Bytes[ByteIndex] >> 4]);
+		Id.AppendChar(HexChars[Bytes[ByteIndex] & 0x0F]);
+	}
+	return Id;
+}
+
+/**
+ * Write an ID as a version byte, a flags byte, the ID as a packed UUID or a string, and then the platform type and ID
+ * if there are any. Platform types that we know of are written as a one byte index. Strings are written as compact NBO
+ * strings, a varint length followed by their UTF-8 bytes.
+ */
+static void AppendBinaryId(TArray<uint8>& OutBytes, const FString& Id, const FString& PlatformType, const FString& PlatformId, bool bIsRawString)
+{
+	uint8 Flags = 0;
+	uint8 UuidBytes[ACCELBYTE_UUID_BYTE_LENGTH];
+	bool bIsHyphenated = false;
+	if (bIsRawString)
+	{
+		Flags |= ACCELBYTE_BINARY_ID_FLAG_RAW_STRING;
+	}
+	else if (TryPackUuid(Id, UuidBytes, bIsHyphenated))
+	{
+		Flags |= ACCELBYTE_BINARY_ID_FLAG_UUID | (bIsHyphenated ? ACCELBYTE_BINARY_ID_FLAG_HYPHENATED_UUID : 0);
+	}
+
+	int32 PlatformTypeIndex = INDEX_NONE;
+	if (!PlatformType.IsEmpty() || !PlatformId.IsEmpty())
+	{
+		Flags |= ACCELBYTE_BINARY_ID_FLAG_PLATFORM;
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(AccelByteBinaryIdPlatformTypes); Index++)
+		{
+			if (PlatformType.Equals(AccelByteBinaryIdPlatformTypes[Index], ESearchCase::CaseSensitive))
+			{
+				PlatformTypeIndex = Index;
+				Flags |= ACCELBYTE_BINARY_ID_FLAG_KNOWN_PLATFORM_TYPE;
+				break;
+			}
+		}
+	}
+
+	// Each string takes at most a five byte length and four UTF-8 bytes per character, which bounds the encoded size
+	const int32 MaxByteCount = 3 + ACCELBYTE_UUID_BYTE_LENGTH + (3 * 5) + ((Id.Len() + PlatformType.Len() + PlatformId.Len()) * 4);
+	FNboSerializeToBufferAccelByte Buffer(MaxByteCount);
+	Buffer << static_cast<uint8>(ACCELBYTE_BINARY_ID_VERSION) << Flags;
+	if ((Flags & ACCELBYTE_BINARY_ID_FLAG_UUID) != 0)
+	{
+		for (const uint8 Byte : UuidBytes)
+		{
+			Buffer << Byte;
+		}
+	}
+	else
+	{
+		Buffer.WriteCompactString(Id);
+	}
+
+	if ((Flags & ACCELBYTE_BINARY_ID_FLAG_PLATFORM) != 0)
+	{
+		if (PlatformTypeIndex != INDEX_NONE)
+		{
+			Buffer << static_cast<uint8>(PlatformTypeIndex);
+		}
+		else
+		{
+			Buffer.WriteCompactString(PlatformType);
+		}
+		Buffer.WriteCompactString(PlatformId);
+	}
+
+	const uint8* BufferBytes = Buffer;
+	OutBytes.Append(BufferBytes, Buffer.GetByteCount());
+}
+
+static bool ReadBinaryId(const uint8* Bytes, int32 Size, int32& OutBytesRead, FString& OutId, FString& OutPlatformType, FString& OutPlatformId, bool& bOutIsRawString)
+{
+	if (Bytes == nullptr || Size < 2)
+	{
+		return false;
+	}
+
+	FNboSerializeFromBufferAccelByte Buffer(Bytes, Size);
+	uint8 Version = 0;
+	uint8 Flags = 0;
+	Buffer >> Version >> Flags;
+	if (Version != ACCELBYTE_BINARY_ID_VERSION)
+	{
+		return false;
+	}
+
+	bOutIsRawString = (Flags & ACCELBYTE_BINARY_ID_FLAG_RAW_STRING) != 0;
+	if ((Flags & ACCELBYTE_BINARY_ID_FLAG_UUID) != 0)
+	{
+		uint8 UuidBytes[ACCELBYTE_UUID_BYTE_LENGTH];
+		for (uint8& Byte : UuidBytes)
+		{
+			Buffer >> Byte;
+		}
+		if (Buffer.HasOverflow())
+		{
+			return false;
+		}
+		OutId = UnpackUuid(UuidBytes, (Flags & ACCELBYTE_BINARY_ID_FLAG_HYPHENATED_UUID) != 0);
+	}
+	else
+	{
+		OutId = Buffer.ReadCompactString();
+	}
+
+	OutPlatformType.Reset();
+	OutPlatformId.Reset();
+	if ((Flags & ACCELBYTE_BINARY_ID_FLAG_PLATFORM) != 0)
+	{
+		if ((Flags & ACCELBYTE_BINARY_ID_FLAG_KNOWN_PLATFORM_TYPE) != 0)
+		{
+			uint8 PlatformTypeIndex = 0;
+			Buffer >> PlatformTypeIndex;
+			if (Buffer.HasOverflow() || PlatformTypeIndex >= UE_ARRAY_COUNT(AccelByteBinaryIdPlatformTypes))
+			{
+				return false;
+			}
+			OutPlatformType = AccelByteBinaryIdPlatformTypes[PlatformTypeIndex];
+		}
+		else
+		{
+			OutPlatformType = Buffer.ReadCompactString();
+		}
+		OutPlatformId = Buffer.ReadCompactString();
+	}
+
+	if (Buffer.HasOverflow())
+	{
+		return false;
+	}
+
+	OutBytesRead = Buffer.GetReadOffset();
+	return true;
+}
+
+// Maximum number of IDs kept by each decoded user ID cache before it is cleared and starts filling up again
+#define ACCELBYTE_DECODED_USER_ID_CACHE_CAPACITY 1024
+
+// Maximum length of a replicated binary ID that will be read, anything longer is treated as a corrupt packet
+#define ACCELBYTE_MAX_REPLICATED_BINARY_ID_LENGTH 512
+
+/**
+ * Bounded map of user IDs that have already been decoded. Replicated player states and session members send the same
+ * handful of IDs over and over, so handing back a shared instance skips building a new ID for every copy received.
+ */
+class FAccelByteDecodedUserIdCache
+{
+public:
+	TSharedPtr<const FUniqueNetIdAccelByteUser> Find(const FString& Key)
+	{
+		FScopeLock ScopeLock(&UserIdsLock);
+		const TSharedRef<const FUniqueNetIdAccelByteUser>* FoundUserId = UserIds.Find(Key);
+		return (FoundUserId != nullptr) ? TSharedPtr<const FUniqueNetIdAccelByteUser>(*FoundUserId) : nullptr;
+	}
+
+	void Add(const FString& Key, const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId)
+	{
+		FScopeLock ScopeLock(&UserIdsLock);
+		if (UserIds.Num() >= ACCELBYTE_DECODED_USER_ID_CACHE_CAPACITY)
+		{
+			UserIds.Reset();
+		}
+		UserIds.Add(Key, UserId);
+	}
+
+private:
+	FCriticalSection UserIdsLock;
+	TMap<FString, TSharedRef<const FUniqueNetIdAccelByteUser>> UserIds;
+};
+
+static FAccelByteDecodedUserIdCache BinaryUserIdCache;
+static FAccelByteDecodedUserIdCache EncodedUserIdCache;
+
+#pragma endregion // Binary ID Encoding
+
 #pragma region FAccelByteUniqueIdComposite
 
 FAccelByteUniqueIdComposite::FAccelByteUniqueIdComposite
@@ -122,6 +386,26 @@ bool FUniqueNetIdAccelByteResource::IsValid() const
 	return IsAccelByteIDValid(UniqueNetIdStr);
 }
 
+void FUniqueNetIdAccelByteResource::AppendBinary(TArray<uint8>& OutBytes) const
+{
+	AppendBinaryId(OutBytes, UniqueNetIdStr, TEXT(""), TEXT(""), false);
+}
+
+bool FUniqueNetIdAccelByteResource::ReadBinary(const uint8* Bytes, int32 Size, int32& OutBytesRead)
+{
+	FString Id;
+	FString PlatformType;
+	FString PlatformId;
+	bool bIsRawString = false;
+	if (!ReadBinaryId(Bytes, Size, OutBytesRead, Id, PlatformType, PlatformId, bIsRawString))
+	{
+		return false;
+	}
+
+	UniqueNetIdStr = MoveTemp(Id);
+	return true;
+}
+
 #pragma endregion  // FUniqueNetIdAccelByteResource
 
 #pragma region FUniquneNetIdAccelByteUser
@@ -157,26 +441,64 @@ TSharedPtr<const FUniqueNetIdAccelByteUser> FUniqueNetIdAccelByteUser::Create(co
 		return nullptr;
 	}
 
-	FString CompositeString;
-	if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
+	FString EncodedString;
+	if (!EncodeCompositeId(CompositeId, EncodedString))
 	{
-		UE_LOG_AB(Warning, TEXT("Failed to convert composite structure for an FUniqueNetIdAccelByte to a JSON string!"));
 		return nullptr;
 	}
 
-	FString EncodedString = FBase64::Encode(CompositeString);
-	if (EncodedString.IsEmpty())
+	return MakeShared<const FUniqueNetIdAccelByteUser>(CompositeId, EncodedString);
+}
+
+TSharedPtr<const FUniqueNetIdAccelByteUser> FUniqueNetIdAccelByteUser::Create(const FUniqueNetId& Src)
+{
+	return MakeShared<const FUniqueNetIdAccelByteUser>(FUniqueNetIdAccelByteUser(Src.ToString(), Src.GetType()));
+}
+
+TSharedPtr<const FUniqueNetIdAccelByteUser> FUniqueNetIdAccelByteUser::CreateFromBinary(const uint8* Bytes, int32 Size, int32& OutBytesRead)
+{
+	// Parsing the encoding without building the ID is cheap, and gives us the exact bytes of this ID to use as a key
+	FAccelByteUniqueIdComposite Composite;
+	bool bIsRawString = false;
+	if (!ReadBinaryId(Bytes, Size, OutBytesRead, Composite.Id, Composite.PlatformType, Composite.PlatformId, bIsRawString))
 	{
-		UE_LOG_AB(Warning, TEXT("Failed to encode composite structure for an FUniqueNetIdAccelByte to a Base64 string!"));
 		return nullptr;
 	}
 
-	return MakeShared<const FUniqueNetIdAccelByteUser>(CompositeId, EncodedString);
+	const FString CacheKey = BytesToHex(Bytes, OutBytesRead);
+	TSharedPtr<const FUniqueNetIdAccelByteUser> UserId = BinaryUserIdCache.Find(CacheKey);
+	if (UserId.IsValid())
+	{
+		return UserId;
+	}
+
+	const TSharedRef<FUniqueNetIdAccelByteUser> NewUserId = MakeShared<FUniqueNetIdAccelByteUser>();
+	int32 BytesRead = 0;
+	if (!NewUserId->ReadBinary(Bytes, Size, BytesRead))
+	{
+		return nullptr;
+	}
+
+	BinaryUserIdCache.Add(CacheKey, NewUserId);
+	return NewUserId;
 }
 
-TSharedPtr<const FUniqueNetIdAccelByteUser> FUniqueNetIdAccelByteUser::Create(const FUniqueNetId& Src)
+TSharedPtr<const FUniqueNetIdAccelByteUser> FUniqueNetIdAccelByteUser::CreateFromEncodedString(const FString& EncodedComposite)
 {
-	return MakeShared<const FUniqueNetIdAccelByteUser>(FUniqueNetIdAccelByteUser(Src.ToString(), Src.GetType()));
+	TSharedPtr<const FUniqueNetIdAccelByteUser> UserId = EncodedUserIdCache.Find(EncodedComposite);
+	if (UserId.IsValid())
+	{
+		return UserId;
+	}
+
+	const TSharedRef<const FUniqueNetIdAccelByteUser> NewUserId = MakeShared<const FUniqueNetIdAccelByteUser>(EncodedComposite);
+
+	// Only share IDs that decoded correctly, so that a bad string never gets stuck in the cache
+	if (NewUserId->IsValid())
+	{
+		EncodedUserIdCache.Add(EncodedComposite, NewUserId);
+	}
+	return NewUserId;
 }
 
 TSharedRef<const FUniqueNetIdAccelByteUser> FUniqueNetIdAccelByteUser::Cast(const FUniqueNetId& NetId)
@@ -250,7 +572,7 @@ FString FUniqueNetIdAccelByteUser::ToDebugString() const
 	return OutString;
 }
 
-FString FUniqueNetIdAccelByteUser::GetAccelByteId() const
+const FString& FUniqueNetIdAccelByteUser::GetAccelByteId() const
 {
 	return CompositeStructure.Id;
 }
@@ -373,8 +695,175 @@ void FUniqueNetIdAccelByteUser::DecodeIDElements()
 	}
 }
 
+bool FUniqueNetIdAccelByteUser::EncodeCompositeId(const FAccelByteUniqueIdComposite& CompositeId, FString& OutEncodedComposite)
+{
+	FString CompositeString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to convert composite structure for an FUniqueNetIdAccelByte to a JSON string!"));
+		return false;
+	}
+
+	OutEncodedComposite = FBase64::Encode(CompositeString);
+	if (OutEncodedComposite.IsEmpty())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to encode composite structure for an FUniqueNetIdAccelByte to a Base64 string!"));
+		return false;
+	}
+
+	return true;
+}
+
+void FUniqueNetIdAccelByteUser::AppendBinary(TArray<uint8>& OutBytes) const
+{
+	// An ID whose string could not be decoded has no composite to write, so send the string itself and let the reader
+	// go through the usual decode path
+	if (CompositeStructure.Id.IsEmpty() || CompositeStructure.Id == ACCELBYTE_INVALID_ID_VALUE)
+	{
+		AppendBinaryId(OutBytes, UniqueNetIdStr, TEXT(""), TEXT(""), true);
+		return;
+	}
+
+	AppendBinaryId(OutBytes, CompositeStructure.Id, CompositeStructure.PlatformType, CompositeStructure.PlatformId, false);
+}
+
+bool FUniqueNetIdAccelByteUser::ReadBinary(const uint8* Bytes, int32 Size, int32& OutBytesRead)
+{
+	FAccelByteUniqueIdComposite Composite;
+	bool bIsRawString = false;
+	if (!ReadBinaryId(Bytes, Size, OutBytesRead, Composite.Id, Composite.PlatformType, Composite.PlatformId, bIsRawString))
+	{
+		return false;
+	}
+
+	if (bIsRawString)
+	{
+		UniqueNetIdStr = MoveTemp(Composite.Id);
+		bIsEncodedStringPending = false;
+		CompositeStructure = FAccelByteUniqueIdComposite();
+		bHasCachedValidState = false;
+		DecodeIDElements();
+		return true;
+	}
+
+	// The composite came straight off the wire rather than out of the string, so validity only depends on the ID format.
+	// Most IDs read from a packet are only compared, so the Base64 JSON string is left to be built on first use.
+	UniqueNetIdStr.Reset();
+	bIsEncodedStringPending = true;
+	bCachedValidState = IsAccelByteIDValid(Composite.Id);
+	bHasCachedValidState = true;
+	CompositeStructure = MoveTemp(Composite);
+	return true;
+}
+
+FString FUniqueNetIdAccelByteUser::ToString() const
+{
+	return GetEncodedString();
+}
+
+const uint8* FUniqueNetIdAccelByteUser::GetBytes() const
+{
+	return reinterpret_cast<const uint8*>(GetEncodedString().GetCharArray().GetData());
+}
+
+int32 FUniqueNetIdAccelByteUser::GetSize() const
+{
+	const FString& EncodedString = GetEncodedString();
+	return EncodedString.GetCharArray().GetTypeSize() * EncodedString.GetCharArray().Num();
+}
+
+uint32 FUniqueNetIdAccelByteUser::GetTypeHash() const
+{
+	return ::GetTypeHash(GetEncodedString());
+}
+
+const FString& FUniqueNetIdAccelByteUser::GetEncodedString() const
+{
+	if (bIsEncodedStringPending)
+	{
+		// IDs are shared between threads, so only one of them gets to build the string
+		static FCriticalSection EncodedStringLock;
+		FScopeLock ScopeLock(&EncodedStringLock);
+		if (bIsEncodedStringPending)
+		{
+			FString EncodedComposite;
+			EncodeCompositeId(CompositeStructure, EncodedComposite);
+			const_cast<FUniqueNetIdAccelByteUser*>(this)->UniqueNetIdStr = MoveTemp(EncodedComposite);
+			bIsEncodedStringPending = false;
+		}
+	}
+	return UniqueNetIdStr;
+}
+
 #pragma endregion // FUniquneNetIdAccelByteUser
 
+#pragma region FAccelByteUniqueNetIdRepl
+
+bool FAccelByteUniqueNetIdRepl::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	if (Ar.IsSaving())
+	{
+		TArray<uint8> IdBytes;
+		if (UniqueNetId.IsValid())
+		{
+			UniqueNetId->AppendBinary(IdBytes);
+		}
+
+		uint32 IdLength = IdBytes.Num();
+		Ar.SerializeIntPacked(IdLength);
+		Ar.Serialize(IdBytes.GetData(), IdLength);
+	}
+	else if (Ar.IsLoading())
+	{
+		uint32 IdLength = 0;
+		Ar.SerializeIntPacked(IdLength);
+		if (IdLength == 0)
+		{
+			UniqueNetId.Reset();
+			return true;
+		}
+
+		if (IdLength > ACCELBYTE_MAX_REPLICATED_BINARY_ID_LENGTH)
+		{
+			UE_LOG_AB(Warning, TEXT("Replicated AccelByte user ID was %u bytes long, which is more than the maximum of %d! Dropping it."), IdLength, ACCELBYTE_MAX_REPLICATED_BINARY_ID_LENGTH);
+			Ar.SetError();
+			UniqueNetId.Reset();
+			bOutSuccess = false;
+			return true;
+		}
+
+		TArray<uint8> IdBytes;
+		IdBytes.SetNumUninitialized(IdLength);
+		Ar.Serialize(IdBytes.GetData(), IdLength);
+		if (Ar.IsError())
+		{
+			UniqueNetId.Reset();
+			bOutSuccess = false;
+			return true;
+		}
+
+		int32 BytesRead = 0;
+		UniqueNetId = FUniqueNetIdAccelByteUser::CreateFromBinary(IdBytes.GetData(), IdBytes.Num(), BytesRead);
+		bOutSuccess = UniqueNetId.IsValid() && BytesRead == IdBytes.Num();
+	}
+
+	return true;
+}
+
+bool FAccelByteUniqueNetIdRepl::operator==(const FAccelByteUniqueNetIdRepl& Other) const
+{
+	if (UniqueNetId.IsValid() != Other.UniqueNetId.IsValid())
+	{
+		return false;
+	}
+
+	return !UniqueNetId.IsValid() || UniqueNetId == Other.UniqueNetId || *UniqueNetId == *Other.UniqueNetId;
+}
+
+#pragma endregion // FAccelByteUniqueNetIdRepl
+
 #pragma region FOnlineSessionInfoAccelByte
 
 FOnlineSessionInfoAccelByte::FOnlineSessionInfoAccelByte()
@@ -243,3 +243,97 @@ FString FOnlineSubsystemAccelByteUtils::GetUserDisconnectedTime(const FString& U
 	return FString();
 }
 
+TSharedPtr<FJsonValue> FOnlineSubsystemAccelByteUtils::VariantDataToJsonValue(const FVariantData& Data)
+{
+	switch (Data.GetType())
+	{
+	case EOnlineKeyValuePairDataType::Int32:
+	{
+		int32 Value = 0;
+		Data.GetValue(Value);
+		return MakeShared<FJsonValueNumber>(Value);
+	}
+	case EOnlineKeyValuePairDataType::UInt32:
+	{
+		uint32 Value = 0;
+		Data.GetValue(Value);
+		return MakeShared<FJsonValueNumber>(Value);
+	}
+	case EOnlineKeyValuePairDataType::Float:
+	{
+		float Value = 0.0f;
+		Data.GetValue(Value);
+		return MakeShared<FJsonValueNumber>(Value);
+	}
+	case EOnlineKeyValuePairDataType::Double:
+	{
+		double Value = 0.0;
+		Data.GetValue(Value);
+		return MakeShared<FJsonValueNumber>(Value);
+	}
+	case EOnlineKeyValuePairDataType::Bool:
+	{
+		bool bValue = false;
+		Data.GetValue(bValue);
+		return MakeShared<FJsonValueBoolean>(bValue);
+	}
+	case EOnlineKeyValuePairDataType::String:
+	{
+		FString Value;
+		Data.GetValue(Value);
+		return MakeShared<FJsonValueString>(MoveTemp(Value));
+	}
+	case EOnlineKeyValuePairDataType::Empty:
+		return MakeShared<FJsonValueNull>();
+	default:
+		// 64-bit integers and anything else that JSON has no exact representation for
+		return MakeShared<FJsonValueString>(Data.ToString());
+	}
+}
+
+bool FOnlineSubsystemAccelByteUtils::JsonValueToVariantData(const TSharedPtr<FJsonValue>& JsonValue, FVariantData& OutData)
+{
+	if (!JsonValue.IsValid())
+	{
+		return false;
+	}
+
+	switch (JsonValue->Type)
+	{
+	case EJson::String:
+		OutData.SetValue(JsonValue->AsString());
+		return true;
+	case EJson::Boolean:
+		OutData.SetValue(JsonValue->AsBool());
+		return true;
+	case EJson::Number:
+		OutData.SetValue(JsonValue->AsNumber());
+		return true;
+	default:
+		return false;
+	}
+}
+
+TSharedRef<FJsonObject> FOnlineSubsystemAccelByteUtils::SessionSettingsToJsonObject(const FSessionSettings& Settings)
+{
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->Values.Reserve(Settings.Num());
+	for (const TPair<FName, FOnlineSessionSetting>& Setting : Settings)
+	{
+		JsonObject->Values.Add(Setting.Key.ToString(), VariantDataToJsonValue(Setting.Value.Data));
+	}
+	return JsonObject;
+}
+
+void FOnlineSubsystemAccelByteUtils::JsonObjectToSessionSettings(const FJsonObject& JsonObject, FSessionSettings& OutSettings)
+{
+	OutSettings.Reserve(OutSettings.Num() + JsonObject.Values.Num());
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Value : JsonObject.Values)
+	{
+		FVariantData Data;
+		if (JsonValueToVariantData(Value.Value, Data))
+		{
+			OutSettings.FindOrAdd(FName(*Value.Key)).Data = MoveTemp(Data);
+		}
+	}
+}
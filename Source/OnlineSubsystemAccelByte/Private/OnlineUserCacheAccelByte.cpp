@@ -25,6 +25,7 @@ int32 FOnlineUserCacheAccelByte::Purge()
 	// Filter all of the users in the map that have gone past their elapsed time and aren't marked as important so we can
 	// purge them from the user cache maps
 	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	const double UserCachePurgeTimeoutSeconds = Subsystem->GetSettings().UserCachePurgeTimeoutSeconds;
 
 	TMap<FString, TSharedRef<FAccelByteUserInfo>> FilteredUserMap;
 	FilteredUserMap.Reserve(AccelByteIdToUserInfoMap.Num());
@@ -170,6 +171,84 @@ bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(const FUniqueNetId& User
 	return true;
 }
 
+bool FOnlineUserCacheAccelByte::QueueQueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant /*= false*/)
+{
+	// Remove all IDs that are not valid AccelByte IDs, as well as any duplicates
+	TArray<FString> FilteredIds;
+	FilteredIds.Reserve(AccelByteIds.Num());
+	for (const FString& AccelByteId : AccelByteIds)
+	{
+		if (!IsInvalidAccelByteId(AccelByteId))
+		{
+			FilteredIds.AddUnique(AccelByteId);
+		}
+	}
+
+	if (FilteredIds.Num() <= 0)
+	{
+		UE_LOG_AB(Warning, TEXT("FOnlineUserStoreAccelByte::QueueQueryUsersByAccelByteIds called with an empty array of IDs, skipping this call!"));
+		Delegate.ExecuteIfBound(true, TArray<TSharedRef<FAccelByteUserInfo>>());
+		return false;
+	}
+
+	const TSharedRef<FQueuedUserQuery> Query = MakeShared<FQueuedUserQuery>();
+	Query->AccelByteIds = FilteredIds;
+	Query->Delegate = Delegate;
+	Query->bIsImportant = bIsImportant;
+
+	TArray<FString> UsersToQuery;
+	TArray<TSharedRef<FAccelByteUserInfo>> UsersInCache;
+	{
+		FScopeLock ScopeLock(&CacheLock);
+		GetQueryAndCacheArrays(FilteredIds, UsersToQuery, UsersInCache);
+	}
+
+	// Everyone is cached already, so there is no reason to make the caller wait on a query
+	if (UsersToQuery.Num() <= 0)
+	{
+		Delegate.ExecuteIfBound(true, GetQueuedQueryUsers(Query.Get()));
+		return true;
+	}
+
+	{
+		FScopeLock ScopeLock(&QueuedQueryLock);
+
+		TArray<TSharedRef<FQueuedUserQueryBatch>, TInlineAllocator<2>> WaitedBatches;
+		for (const FString& AccelByteId : UsersToQuery)
+		{
+			// Users already queued or in flight are waited on rather than added to another query
+			const TSharedRef<FQueuedUserQueryBatch>* FoundBatch = QueryBatchesByAccelByteId.Find(AccelByteId);
+			if (FoundBatch != nullptr)
+			{
+				WaitedBatches.AddUnique(*FoundBatch);
+				continue;
+			}
+
+			TSharedRef<FQueuedUserQueryBatch>* OpenBatch = OpenQueryBatches.Find(LocalUserNum);
+			if (OpenBatch == nullptr)
+			{
+				const TSharedRef<FQueuedUserQueryBatch> NewBatch = MakeShared<FQueuedUserQueryBatch>();
+				NewBatch->LocalUserNum = LocalUserNum;
+				NewBatch->QueuedTimeSeconds = FPlatformTime::Seconds();
+				OpenBatch = &OpenQueryBatches.Add(LocalUserNum, NewBatch);
+			}
+
+			(*OpenBatch)->AccelByteIds.Add(AccelByteId);
+			(*OpenBatch)->bIsImportant |= bIsImportant;
+			QueryBatchesByAccelByteId.Add(AccelByteId, *OpenBatch);
+			WaitedBatches.AddUnique(*OpenBatch);
+		}
+
+		Query->NumQueriesRemaining = WaitedBatches.Num();
+		for (const TSharedRef<FQueuedUserQueryBatch>& Batch : WaitedBatches)
+		{
+			Batch->Queries.Add(Query);
+		}
+	}
+
+	return true;
+}
+
 TSharedPtr<const FAccelByteUserInfo> FOnlineUserCacheAccelByte::GetUser(const FUniqueNetId& UserId)
 {
 	// Lock while we access the cache
@@ -238,6 +317,152 @@ void FOnlineUserCacheAccelByte::AddUsersToCache(const TArray<TSharedRef<FAccelBy
 	}
 }
 
+void FOnlineUserCacheAccelByte::FlushQueuedQueries(double CurrentTimeSeconds)
+{
+	const double BatchWindowSeconds = Subsystem->GetSettings().UserQueryBatchWindowMs / 1000.0;
+
+	TArray<TSharedRef<FQueuedUserQueryBatch>> BatchesToQuery;
+	{
+		FScopeLock ScopeLock(&QueuedQueryLock);
+		for (auto BatchIt = OpenQueryBatches.CreateIterator(); BatchIt; ++BatchIt)
+		{
+			if (CurrentTimeSeconds - BatchIt->Value->QueuedTimeSeconds >= BatchWindowSeconds)
+			{
+				BatchesToQuery.Add(BatchIt->Value);
+				BatchIt.RemoveCurrent();
+			}
+		}
+	}
+
+	// Dispatch outside of the lock, batches that are in flight are still found by ID so later lookups wait on them
+	for (const TSharedRef<FQueuedUserQueryBatch>& Batch : BatchesToQuery)
+	{
+		DispatchQueryBatch(Batch);
+	}
+}
+
+void FOnlineUserCacheAccelByte::DispatchQueryBatch(const TSharedRef<FQueuedUserQueryBatch>& Batch)
+{
+	UE_LOG_AB(Verbose, TEXT("Querying %d queued users for %d waiting callers in one bulk query"), Batch->AccelByteIds.Num(), Batch->Queries.Num());
+
+	// The query task can outlive the user cache, in which case there is no one left to hand the users to
+	const FOnQueryUsersComplete OnQueuedQueryBatchCompleteDelegate = FOnQueryUsersComplete::CreateThreadSafeSP(AsShared(), &FOnlineUserCacheAccelByte::OnQueuedQueryBatchComplete, Batch);
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, Batch->LocalUserNum, Batch->AccelByteIds, Batch->bIsImportant, OnQueuedQueryBatchCompleteDelegate);
+}
+
+void FOnlineUserCacheAccelByte::OnQueuedQueryBatchComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TSharedRef<FQueuedUserQueryBatch> Batch)
+{
+	// A merged query fails as a whole, so one bad ID from one caller would otherwise fail every caller sharing it
+	const bool bShouldRetryCallers = !bIsSuccessful && Batch->Queries.Num() > 1;
+
+	TArray<TSharedRef<FQueuedUserQuery>> CompletedQueries;
+	TArray<TSharedRef<FQueuedUserQuery>> RetriedQueries;
+	{
+		FScopeLock ScopeLock(&QueuedQueryLock);
+		for (const FString& AccelByteId : Batch->AccelByteIds)
+		{
+			const TSharedRef<FQueuedUserQueryBatch>* FoundBatch = QueryBatchesByAccelByteId.Find(AccelByteId);
+			if (FoundBatch != nullptr && *FoundBatch == Batch)
+			{
+				QueryBatchesByAccelByteId.Remove(AccelByteId);
+			}
+		}
+
+		for (const TSharedRef<FQueuedUserQuery>& Query : Batch->Queries)
+		{
+			// The caller keeps waiting, now on a query of its own in place of this one
+			if (bShouldRetryCallers && !Query->bHasRetried)
+			{
+				Query->bHasRetried = true;
+				RetriedQueries.Add(Query);
+				continue;
+			}
+
+			Query->bWasSuccessful &= bIsSuccessful;
+			Query->NumQueriesRemaining--;
+			if (Query->NumQueriesRemaining <= 0)
+			{
+				CompletedQueries.Add(Query);
+			}
+		}
+	}
+
+	// Retry batches are kept out of QueryBatchesByAccelByteId, so that later lookups never wait on a caller's retry. Only
+	// the caller's IDs from the failed batch are retried, as the rest are still in flight in other batches it waits on.
+	TSet<FString> FailedBatchIds;
+	if (RetriedQueries.Num() > 0)
+	{
+		FailedBatchIds.Append(Batch->AccelByteIds);
+	}
+
+	for (const TSharedRef<FQueuedUserQuery>& Query : RetriedQueries)
+	{
+		const TSharedRef<FQueuedUserQueryBatch> RetryBatch = MakeShared<FQueuedUserQueryBatch>();
+		RetryBatch->LocalUserNum = Batch->LocalUserNum;
+		RetryBatch->QueuedTimeSeconds = FPlatformTime::Seconds();
+		RetryBatch->bIsImportant = Query->bIsImportant;
+		RetryBatch->Queries.Add(Query);
+
+		TArray<FString> RetryIds;
+		for (const FString& AccelByteId : Query->AccelByteIds)
+		{
+			if (FailedBatchIds.Contains(AccelByteId))
+			{
+				RetryIds.Add(AccelByteId);
+			}
+		}
+
+		TArray<TSharedRef<FAccelByteUserInfo>> UsersInCache;
+		{
+			FScopeLock ScopeLock(&CacheLock);
+			GetQueryAndCacheArrays(RetryIds, RetryBatch->AccelByteIds, UsersInCache);
+		}
+
+		if (RetryBatch->AccelByteIds.Num() <= 0)
+		{
+			// Everything the caller asked for from the failed batch was cached by other queries in the meantime
+			OnQueuedQueryBatchComplete(true, TArray<TSharedRef<FAccelByteUserInfo>>(), RetryBatch);
+			continue;
+		}
+
+		UE_LOG_AB(Verbose, TEXT("Bulk query for %d callers failed, querying %d users again for one of them"), Batch->Queries.Num(), RetryBatch->AccelByteIds.Num());
+		DispatchQueryBatch(RetryBatch);
+	}
+
+	// Queried users were added to the cache by the task before this fires, so every caller can be served from the cache
+	for (const TSharedRef<FQueuedUserQuery>& Query : CompletedQueries)
+	{
+		if (Query->bWasSuccessful)
+		{
+			Query->Delegate.ExecuteIfBound(true, GetQueuedQueryUsers(Query.Get()));
+		}
+		else
+		{
+			Query->Delegate.ExecuteIfBound(false, TArray<TSharedRef<FAccelByteUserInfo>>());
+		}
+	}
+}
+
+TArray<TSharedRef<FAccelByteUserInfo>> FOnlineUserCacheAccelByte::GetQueuedQueryUsers(const FQueuedUserQuery& Query)
+{
+	FScopeLock ScopeLock(&CacheLock);
+
+	const double CurrentTimeSeconds = FPlatformTime::Seconds();
+	TArray<TSharedRef<FAccelByteUserInfo>> Users;
+	Users.Reserve(Query.AccelByteIds.Num());
+	for (const FString& AccelByteId : Query.AccelByteIds)
+	{
+		const TSharedRef<FAccelByteUserInfo>* FoundUserInfo = AccelByteIdToUserInfoMap.Find(AccelByteId);
+		if (FoundUserInfo != nullptr)
+		{
+			(*FoundUserInfo)->LastAccessedTimeInSeconds = CurrentTimeSeconds;
+			(*FoundUserInfo)->bIsImportant |= Query.bIsImportant;
+			Users.Add(*FoundUserInfo);
+		}
+	}
+	return Users;
+}
+
 FString FOnlineUserCacheAccelByte::ConvertPlatformTypeAndIdToCacheKey(const FString& Type, const FString& Id) const
 {
 	const FString PlatformId = FString::Printf(TEXT("%s;%s"), *Type, *Id);
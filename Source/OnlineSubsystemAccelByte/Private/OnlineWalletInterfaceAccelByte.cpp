@@ -8,8 +8,77 @@
 #include "OnlineSubsystemAccelByteInternalHelpers.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteGetCurrencyList.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteGetWalletInfo.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByteGetWalletInfos.h"
 #include "AsyncTasks/OnlineAsyncTaskAccelByteGetWalletTransactions.h"
 
+void FAccelByteWalletTransactionStream::Reset(int32 InPageSize, int32 InCapacity)
+{
+	PageSize = FMath::Max(InPageSize, 1);
+	NextOffset = 0;
+	Generation++;
+	bHasMorePages = true;
+	bIsRequestInFlight = false;
+	bIsReaderWaiting = false;
+
+	// Always leave room for the page being read and the one being prefetched
+	const int32 Capacity = FMath::Max(InCapacity, PageSize * 2);
+	Entries.Reset();
+	Entries.SetNum(Capacity);
+	Head = 0;
+	Count = 0;
+
+	RecentKeys.Reset();
+	RecentKeys.SetNum(Capacity);
+	RecentKeySet.Reset();
+	RecentKeySet.Reserve(Capacity);
+	RecentKeysHead = 0;
+}
+
+EAccelByteWalletTransactionPushResult FAccelByteWalletTransactionStream::Push(FAccelByteModelsWalletTransactionInfo&& Transaction)
+{
+	if (Count >= Entries.Num())
+	{
+		return EAccelByteWalletTransactionPushResult::Full;
+	}
+
+	FAccelByteWalletTransactionKey Key(Transaction);
+	if (RecentKeySet.Contains(Key))
+	{
+		return EAccelByteWalletTransactionPushResult::Duplicate;
+	}
+
+	// Once the key ring is full, forget the oldest key to make room for this one
+	if (RecentKeySet.Num() >= RecentKeys.Num())
+	{
+		RecentKeySet.Remove(RecentKeys[RecentKeysHead]);
+	}
+	RecentKeySet.Add(Key);
+	RecentKeys[RecentKeysHead] = MoveTemp(Key);
+	RecentKeysHead = (RecentKeysHead + 1) % RecentKeys.Num();
+
+	Entries[(Head + Count) % Entries.Num()] = MoveTemp(Transaction);
+	Count++;
+	return EAccelByteWalletTransactionPushResult::Added;
+}
+
+int32 FAccelByteWalletTransactionStream::Pop(TArray<FAccelByteModelsWalletTransactionInfo>& OutTransactions, int32 MaxCount)
+{
+	const int32 NumToPop = FMath::Min(Count, MaxCount);
+	OutTransactions.Reset(NumToPop);
+	for (int32 Index = 0; Index < NumToPop; Index++)
+	{
+		OutTransactions.Emplace(MoveTemp(Entries[Head]));
+		Head = (Head + 1) % Entries.Num();
+	}
+	Count -= NumToPop;
+	return NumToPop;
+}
+
+FOnlineWalletAccelByte::FOnlineWalletAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
+	: AccelByteSubsystem(InSubsystem)
+{
+}
+
 bool FOnlineWalletAccelByte::GetCurrencyList(int32 LocalUserNum, bool bAlwaysRequestToService)
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Get Currency List, LocalUserNum: %d"), LocalUserNum);
@@ -127,19 +196,116 @@ bool FOnlineWalletAccelByte::GetWalletInfoByCurrencyCode(int32 LocalUserNum, con
 	return false;
 }
 
+bool FOnlineWalletAccelByte::GetWalletInfoByCurrencyCodes(int32 LocalUserNum, const TArray<FString>& CurrencyCodes, bool bAlwaysRequestToService)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Get Wallet Infos, LocalUserNum: %d; Currency Count: %d"), LocalUserNum, CurrencyCodes.Num());
+
+	// Ask for each currency once, even if the caller listed it more than once
+	TArray<FString> UniqueCurrencyCodes;
+	UniqueCurrencyCodes.Reserve(CurrencyCodes.Num());
+	for (const FString& CurrencyCode : CurrencyCodes)
+	{
+		UniqueCurrencyCodes.AddUnique(CurrencyCode);
+	}
+
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (IdentityInterface.IsValid())
+	{
+		// Check whether user is connected or not yet
+		if (IdentityInterface->GetLoginStatus(LocalUserNum) == ELoginStatus::LoggedIn)
+		{
+			const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+			if (UserIdPtr.IsValid())
+			{
+				AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteGetWalletInfos>(AccelByteSubsystem, *UserIdPtr.Get(), UniqueCurrencyCodes, bAlwaysRequestToService);
+				AB_OSS_INTERFACE_TRACE_END(TEXT("Dispatching async task to attempt to get wallet infos!"));
+
+				return true;
+			}
+			else
+			{
+				const FString ErrorStr = TEXT("get-wallet-infos-failed-userid-invalid");
+				AB_OSS_INTERFACE_TRACE_END(TEXT("UserId is not valid at user index '%d'!"), LocalUserNum);
+				TriggerOnGetWalletInfosCompletedDelegates(LocalUserNum, false, TArray<FAccelByteModelsWalletInfo>{}, ErrorStr);
+
+				return false;
+			}
+		}
+	}
+
+	const FString ErrorStr = TEXT("get-wallet-infos-failed-not-logged-in");
+	AB_OSS_INTERFACE_TRACE_END(TEXT("User not logged in at user index '%d'!"), LocalUserNum);
+	TriggerOnGetWalletInfosCompletedDelegates(LocalUserNum, false, TArray<FAccelByteModelsWalletInfo>{}, ErrorStr);
+
+	return false;
+}
+
+bool FOnlineWalletAccelByte::RefreshStaleWalletInfo(int32 LocalUserNum)
+{
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (!IdentityInterface.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+	if (!UserIdPtr.IsValid())
+	{
+		return false;
+	}
+
+	TArray<FString> StaleCurrencyCodes;
+	{
+		FScopeLock ScopeLock(&WalletInfoListLock);
+		const TMap<FString, FAccelByteWalletCacheEntry>* CurrencyToWalletInfoMap = UserToWalletInfoMap.Find(UserIdPtr.ToSharedRef());
+		if (CurrencyToWalletInfoMap != nullptr)
+		{
+			const double CurrentTimeSeconds = FPlatformTime::Seconds();
+			const double WalletCacheTTLSeconds = AccelByteSubsystem->GetSettings().WalletCacheTTLSeconds;
+			for (const TPair<FString, FAccelByteWalletCacheEntry>& Entry : *CurrencyToWalletInfoMap)
+			{
+				if (Entry.Value.bIsStale || (CurrentTimeSeconds - Entry.Value.LastUpdatedSeconds) >= WalletCacheTTLSeconds)
+				{
+					StaleCurrencyCodes.Add(Entry.Key);
+				}
+			}
+		}
+	}
+
+	if (StaleCurrencyCodes.Num() <= 0)
+	{
+		return false;
+	}
+
+	return GetWalletInfoByCurrencyCodes(LocalUserNum, StaleCurrencyCodes, true);
+}
+
 bool FOnlineWalletAccelByte::GetWalletInfoFromCache(int32 LocalUserNum, const FString& CurrencyCode, FAccelByteModelsWalletInfo& OutWalletInfo)
+{
+	uint32 Version = 0;
+	return GetWalletInfoFromCache(LocalUserNum, CurrencyCode, OutWalletInfo, Version);
+}
+
+bool FOnlineWalletAccelByte::GetWalletInfoFromCache(int32 LocalUserNum, const FString& CurrencyCode, FAccelByteModelsWalletInfo& OutWalletInfo, uint32& OutVersion)
 {
 	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
 	if (IdentityInterface.IsValid())
 	{
+		const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+		if (!UserIdPtr.IsValid())
+		{
+			return false;
+		}
+
 		FScopeLock ScopeLock(&WalletInfoListLock);
-		TMap<FString, TSharedRef<FAccelByteModelsWalletInfo>> CurrencyToWalletInfoMap = UserToWalletInfoMap.FindRef(IdentityInterface->GetUniquePlayerId(LocalUserNum)->AsShared());
-		if (CurrencyToWalletInfoMap.Num() > 0)
+		const TMap<FString, FAccelByteWalletCacheEntry>* CurrencyToWalletInfoMap = UserToWalletInfoMap.Find(UserIdPtr.ToSharedRef());
+		if (CurrencyToWalletInfoMap != nullptr)
 		{
-			TSharedRef<FAccelByteModelsWalletInfo>* WalletInfo = CurrencyToWalletInfoMap.Find(CurrencyCode);
-			if (WalletInfo != nullptr)
+			const FAccelByteWalletCacheEntry* Entry = CurrencyToWalletInfoMap->Find(CurrencyCode);
+			if (Entry != nullptr)
 			{
-				OutWalletInfo = WalletInfo->Get();
+				OutWalletInfo = Entry->WalletInfo.Get();
+				OutVersion = Entry->Version;
 				return true;
 			}
 		}
@@ -148,6 +314,42 @@ bool FOnlineWalletAccelByte::GetWalletInfoFromCache(int32 LocalUserNum, const FS
 	return false;
 }
 
+bool FOnlineWalletAccelByte::GetFreshWalletInfoFromCache(int32 LocalUserNum, const FString& CurrencyCode, FAccelByteModelsWalletInfo& OutWalletInfo) const
+{
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (!IdentityInterface.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+	if (!UserIdPtr.IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&WalletInfoListLock);
+	const TMap<FString, FAccelByteWalletCacheEntry>* CurrencyToWalletInfoMap = UserToWalletInfoMap.Find(UserIdPtr.ToSharedRef());
+	if (CurrencyToWalletInfoMap == nullptr)
+	{
+		return false;
+	}
+
+	const FAccelByteWalletCacheEntry* Entry = CurrencyToWalletInfoMap->Find(CurrencyCode);
+	if (Entry == nullptr || Entry->bIsStale)
+	{
+		return false;
+	}
+
+	if ((FPlatformTime::Seconds() - Entry->LastUpdatedSeconds) >= AccelByteSubsystem->GetSettings().WalletCacheTTLSeconds)
+	{
+		return false;
+	}
+
+	OutWalletInfo = Entry->WalletInfo.Get();
+	return true;
+}
+
 void FOnlineWalletAccelByte::AddWalletInfoToList(int32 LocalUserNum, const FString& CurrencyCode, const TSharedRef<FAccelByteModelsWalletInfo>& InWalletInfo)
 {
 	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
@@ -160,12 +362,58 @@ void FOnlineWalletAccelByte::AddWalletInfoToList(int32 LocalUserNum, const FStri
 			if (UserIdPtr.IsValid())
 			{
 				FScopeLock ScopeLock(&WalletInfoListLock);
-				auto CurrencyCodeToWalletInfo = UserToWalletInfoMap.FindRef(UserIdPtr.ToSharedRef());
-				CurrencyCodeToWalletInfo.Emplace(CurrencyCode, InWalletInfo);
-				UserToWalletInfoMap.Emplace(UserIdPtr.ToSharedRef(), CurrencyCodeToWalletInfo);
+				TMap<FString, FAccelByteWalletCacheEntry>& CurrencyCodeToWalletInfo = UserToWalletInfoMap.FindOrAdd(UserIdPtr.ToSharedRef());
+				FAccelByteWalletCacheEntry* Entry = CurrencyCodeToWalletInfo.Find(CurrencyCode);
+				if (Entry == nullptr)
+				{
+					Entry = &CurrencyCodeToWalletInfo.Emplace(CurrencyCode, FAccelByteWalletCacheEntry(InWalletInfo));
+				}
+				else
+				{
+					Entry->WalletInfo = InWalletInfo;
+				}
+
+				Entry->LastUpdatedSeconds = FPlatformTime::Seconds();
+				Entry->bIsStale = false;
+				Entry->Version++;
+			}
+		}
+	}
+}
+
+void FOnlineWalletAccelByte::InvalidateWalletInfo(const FUniqueNetId& UserId, const TArray<FString>& CurrencyCodes)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; Currency Count: %d"), *UserId.ToDebugString(), CurrencyCodes.Num());
+
+	TArray<FString> InvalidatedCurrencyCodes;
+	{
+		FScopeLock ScopeLock(&WalletInfoListLock);
+		TMap<FString, FAccelByteWalletCacheEntry>* CurrencyToWalletInfoMap = UserToWalletInfoMap.Find(UserId.AsShared());
+		if (CurrencyToWalletInfoMap != nullptr)
+		{
+			for (TPair<FString, FAccelByteWalletCacheEntry>& Entry : *CurrencyToWalletInfoMap)
+			{
+				if ((CurrencyCodes.Num() <= 0 || CurrencyCodes.Contains(Entry.Key)) && !Entry.Value.bIsStale)
+				{
+					Entry.Value.bIsStale = true;
+					Entry.Value.Version++;
+					InvalidatedCurrencyCodes.Add(Entry.Key);
+				}
 			}
 		}
 	}
+
+	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
+	int32 LocalUserNum = INVALID_CONTROLLERID;
+	if (IdentityInterface.IsValid() && IdentityInterface->GetLocalUserNum(UserId, LocalUserNum))
+	{
+		for (const FString& CurrencyCode : InvalidatedCurrencyCodes)
+		{
+			TriggerOnWalletInfoInvalidatedDelegates(LocalUserNum, CurrencyCode);
+		}
+	}
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Marked %d cached wallet balances as stale"), InvalidatedCurrencyCodes.Num());
 }
 
 bool FOnlineWalletAccelByte::ListWalletTransactionsByCurrencyCode(int32 LocalUserNum, const FString& CurrencyCode, int32 Offset, int32 Limit)
@@ -204,3 +452,192 @@ bool FOnlineWalletAccelByte::ListWalletTransactionsByCurrencyCode(int32 LocalUse
 
 	return false;
 }
+
+bool FOnlineWalletAccelByte::OpenWalletTransactionStream(int32 LocalUserNum, const FString& CurrencyCode, int32 PageSize)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Open Wallet Transaction Stream, LocalUserNum: %d, CurrencyCode: %s"), LocalUserNum, *CurrencyCode);
+
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (IdentityInterface.IsValid() && IdentityInterface->GetLoginStatus(LocalUserNum) == ELoginStatus::LoggedIn)
+	{
+		const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+		if (UserIdPtr.IsValid())
+		{
+			FScopeLock ScopeLock(&WalletTransactionStreamLock);
+			FAccelByteWalletTransactionStream& Stream = UserToWalletTransactionStreamMap.FindOrAdd(UserIdPtr.ToSharedRef()).FindOrAdd(CurrencyCode);
+			Stream.Reset(PageSize, AccelByteSubsystem->GetSettings().WalletTransactionStreamCapacity);
+			Stream.bIsReaderWaiting = true;
+			RequestNextWalletTransactionPage(*UserIdPtr, CurrencyCode, Stream);
+
+			AB_OSS_INTERFACE_TRACE_END(TEXT("Dispatching async task to get the first page of wallet transactions!"));
+			return true;
+		}
+	}
+
+	const FString ErrorStr = TEXT("open-wallet-transaction-stream-failed-not-logged-in");
+	AB_OSS_INTERFACE_TRACE_END(TEXT("User not logged in at user index '%d'!"), LocalUserNum);
+	TriggerOnWalletTransactionStreamPageReadyDelegates(LocalUserNum, false, CurrencyCode, ErrorStr);
+
+	return false;
+}
+
+bool FOnlineWalletAccelByte::ReadWalletTransactionStream(int32 LocalUserNum, const FString& CurrencyCode, TArray<FAccelByteModelsWalletTransactionInfo>& OutTransactions)
+{
+	OutTransactions.Reset();
+
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (!IdentityInterface.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+	if (!UserIdPtr.IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&WalletTransactionStreamLock);
+	TMap<FString, FAccelByteWalletTransactionStream>* CurrencyToStreamMap = UserToWalletTransactionStreamMap.Find(UserIdPtr.ToSharedRef());
+	FAccelByteWalletTransactionStream* Stream = CurrencyToStreamMap != nullptr ? CurrencyToStreamMap->Find(CurrencyCode) : nullptr;
+	if (Stream == nullptr)
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to read wallet transactions! No stream is open for currency '%s'"), *CurrencyCode);
+		return false;
+	}
+
+	const bool bHasRead = Stream->Pop(OutTransactions, Stream->PageSize) > 0;
+	if (!bHasRead && (Stream->bIsRequestInFlight || Stream->bHasMorePages))
+	{
+		Stream->bIsReaderWaiting = true;
+	}
+
+	// Keep the next page on its way while the caller displays this one
+	if (Stream->CanPrefetch())
+	{
+		RequestNextWalletTransactionPage(*UserIdPtr, CurrencyCode, *Stream);
+	}
+
+	return bHasRead;
+}
+
+bool FOnlineWalletAccelByte::HasMoreWalletTransactions(int32 LocalUserNum, const FString& CurrencyCode) const
+{
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (!IdentityInterface.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+	if (!UserIdPtr.IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&WalletTransactionStreamLock);
+	const TMap<FString, FAccelByteWalletTransactionStream>* CurrencyToStreamMap = UserToWalletTransactionStreamMap.Find(UserIdPtr.ToSharedRef());
+	const FAccelByteWalletTransactionStream* Stream = CurrencyToStreamMap != nullptr ? CurrencyToStreamMap->Find(CurrencyCode) : nullptr;
+	return Stream != nullptr && (Stream->Count > 0 || Stream->bHasMorePages);
+}
+
+void FOnlineWalletAccelByte::CloseWalletTransactionStream(int32 LocalUserNum, const FString& CurrencyCode)
+{
+	const IOnlineIdentityPtr IdentityInterface = AccelByteSubsystem->GetIdentityInterface();
+	if (!IdentityInterface.IsValid())
+	{
+		return;
+	}
+
+	const TSharedPtr<const FUniqueNetId> UserIdPtr = IdentityInterface->GetUniquePlayerId(LocalUserNum);
+	if (!UserIdPtr.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&WalletTransactionStreamLock);
+	TMap<FString, FAccelByteWalletTransactionStream>* CurrencyToStreamMap = UserToWalletTransactionStreamMap.Find(UserIdPtr.ToSharedRef());
+	if (CurrencyToStreamMap != nullptr)
+	{
+		CurrencyToStreamMap->Remove(CurrencyCode);
+		if (CurrencyToStreamMap->Num() == 0)
+		{
+			UserToWalletTransactionStreamMap.Remove(UserIdPtr.ToSharedRef());
+		}
+	}
+}
+
+void FOnlineWalletAccelByte::RequestNextWalletTransactionPage(const FUniqueNetId& UserId, const FString& CurrencyCode, FAccelByteWalletTransactionStream& Stream)
+{
+	Stream.bIsRequestInFlight = true;
+	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteGetWalletTransactions>(AccelByteSubsystem, UserId, CurrencyCode, Stream.NextOffset, Stream.PageSize, true, Stream.Generation);
+}
+
+void FOnlineWalletAccelByte::OnWalletTransactionStreamPageReceived(int32 LocalUserNum, const FUniqueNetId& UserId, const FString& CurrencyCode, uint32 Generation, bool bWasSuccessful, TArray<FAccelByteModelsWalletTransactionInfo>& Transactions, bool bHasNextPage, const FString& Error)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("CurrencyCode: %s, bWasSuccessful: %s, Count: %d"), *CurrencyCode, LOG_BOOL_FORMAT(bWasSuccessful), Transactions.Num());
+
+	bool bShouldNotifyReader = false;
+	{
+		FScopeLock ScopeLock(&WalletTransactionStreamLock);
+		TMap<FString, FAccelByteWalletTransactionStream>* CurrencyToStreamMap = UserToWalletTransactionStreamMap.Find(UserId.AsShared());
+		FAccelByteWalletTransactionStream* Stream = CurrencyToStreamMap != nullptr ? CurrencyToStreamMap->Find(CurrencyCode) : nullptr;
+		if (Stream == nullptr || Stream->Generation != Generation)
+		{
+			AB_OSS_INTERFACE_TRACE_END(TEXT("Stream was closed or reopened while the page was in flight, dropping page"));
+			return;
+		}
+
+		Stream->bIsRequestInFlight = false;
+		if (bWasSuccessful)
+		{
+			int32 NumConsumed = 0;
+			int32 NumDuplicates = 0;
+			for (FAccelByteModelsWalletTransactionInfo& Transaction : Transactions)
+			{
+				const EAccelByteWalletTransactionPushResult Result = Stream->Push(MoveTemp(Transaction));
+				if (Result == EAccelByteWalletTransactionPushResult::Full)
+				{
+					break;
+				}
+
+				NumConsumed++;
+				if (Result == EAccelByteWalletTransactionPushResult::Duplicate)
+				{
+					NumDuplicates++;
+				}
+			}
+			if (NumDuplicates > 0)
+			{
+				UE_LOG_AB(Verbose, TEXT("Dropped %d wallet transactions already received in an earlier page"), NumDuplicates);
+			}
+			if (NumConsumed < Transactions.Num())
+			{
+				UE_LOG_AB(Verbose, TEXT("Transaction stream buffer is full, %d wallet transactions will be requested again with the next page"), Transactions.Num() - NumConsumed);
+			}
+
+			// Offsets are counted in backend entries, including the ones we dropped as duplicates but not the ones that
+			// did not fit in the buffer, so that those are part of the next page
+			Stream->NextOffset += NumConsumed;
+			Stream->bHasMorePages = (bHasNextPage && Transactions.Num() > 0) || NumConsumed < Transactions.Num();
+		}
+
+		bShouldNotifyReader = Stream->bIsReaderWaiting && (!bWasSuccessful || Stream->Count > 0 || !Stream->bHasMorePages);
+		if (bShouldNotifyReader)
+		{
+			Stream->bIsReaderWaiting = false;
+		}
+		else if (Stream->bIsReaderWaiting && Stream->CanPrefetch())
+		{
+			// Every entry of this page was a duplicate, carry on to the next one for the waiting reader
+			RequestNextWalletTransactionPage(UserId, CurrencyCode, *Stream);
+		}
+	}
+
+	if (bShouldNotifyReader)
+	{
+		TriggerOnWalletTransactionStreamPageReadyDelegates(LocalUserNum, bWasSuccessful, CurrencyCode, Error);
+	}
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
+}
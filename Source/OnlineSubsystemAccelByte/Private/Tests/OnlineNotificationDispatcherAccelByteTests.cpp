@@ -0,0 +1,38 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OnlineSubsystemAccelByteTestHelpers.h"
+#include "OnlineNotificationDispatcherAccelByte.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNotificationDispatcherResetTest, "AccelByte.OSS.NotificationDispatcher.Reset", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNotificationDispatcherResetTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe> Dispatcher = MakeShared<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe>();
+	TArray<FString> Handled;
+
+	// The second handler resets the queue and queues a notification of its own, which must survive the tick it was
+	// queued in and be handled on the next one
+	Dispatcher->Enqueue(TEXT("Test"), 0, FString(), [&Handled]() { Handled.Add(TEXT("First")); });
+	Dispatcher->Enqueue(TEXT("Test"), 0, FString(), [&Handled, Dispatcher]() {
+		Handled.Add(TEXT("Second"));
+		Dispatcher->Reset();
+		Dispatcher->Enqueue(TEXT("Test"), 0, FString(), [&Handled]() { Handled.Add(TEXT("AfterReset")); });
+	});
+	Dispatcher->Enqueue(TEXT("Test"), 0, FString(), [&Handled]() { Handled.Add(TEXT("Dropped")); });
+
+	Dispatcher->Tick(2, 1.0);
+	TestEqual(TEXT("Queue depth after the reset"), Dispatcher->GetQueueDepth(), 1);
+
+	Dispatcher->Tick(10, 1.0);
+	TestEqual(TEXT("Handled notifications"), FString::Join(Handled, TEXT(",")), FString(TEXT("First,Second,AfterReset")));
+	TestEqual(TEXT("Queue depth at the end"), Dispatcher->GetQueueDepth(), 0);
+	return true;
+}
+
+#endif
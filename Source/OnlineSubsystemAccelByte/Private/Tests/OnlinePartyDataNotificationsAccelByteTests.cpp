@@ -0,0 +1,369 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OnlineSubsystemAccelByteTestHelpers.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+#include "OnlinePartyStorageWriteCoalescerAccelByte.h"
+#include "JsonObjectWrapper.h"
+
+/**
+ * Hands party data change notifications straight to the party interface's game thread handler, reading party storage
+ * beforehand the same way the notification dispatcher's decoder does
+ */
+class FOnlinePartyDataNotificationsTestAccess
+{
+public:
+	static void HandleNotification(FOnlinePartySystemAccelByte& PartyInterface, const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const FAccelByteModelsPartyDataNotif& Notification)
+	{
+		TMap<FString, FVariantData> StorageAttrs;
+		const bool bHasStorage = FOnlinePartySystemAccelByte::DecodePartyStorage(Notification, StorageAttrs);
+		PartyInterface.OnPartyDataChangeNotification(Notification, LocalUserId, bHasStorage ? &StorageAttrs : nullptr);
+	}
+};
+
+namespace
+{
+
+/** Number of attributes in party storage */
+constexpr int32 NumPartyDataAttributes = 32;
+
+/** Number of notifications handled in each timed pass of the benchmark */
+constexpr int32 NumPartyDataIterations = 1000;
+
+/** Number of members put in the party, matching a typical party size */
+constexpr int32 MembersPerPartyDataParty = 4;
+
+/** Make a party data change notification carrying the given storage, written out the same way a storage write is */
+FAccelByteModelsPartyDataNotif MakeTestPartyDataNotification(const FString& PartyId, const FString& LeaderId, const TMap<FString, FVariantData>& StorageAttrs)
+{
+	FAccelBytePartyStorageDelta Delta;
+	Delta.UpdatedAttrs = StorageAttrs;
+	const TSharedRef<FJsonObject> StorageObject = MakeShared<FJsonObject>();
+	Delta.ApplyToJsonObject(StorageObject);
+
+	FAccelByteModelsPartyDataNotif Notification;
+	Notification.PartyId = PartyId;
+	Notification.Leader = LeaderId;
+	Notification.Custom_attribute.JsonObject = StorageObject;
+	return Notification;
+}
+
+/** Party storage with every attribute set to its starting value, alternating between integers and strings */
+TMap<FString, FVariantData> MakeTestStorageAttrs()
+{
+	TMap<FString, FVariantData> StorageAttrs;
+	for (int32 Index = 0; Index < NumPartyDataAttributes; Index++)
+	{
+		const FString AttrName = FString::Printf(TEXT("attr%d"), Index);
+		StorageAttrs.Add(AttrName, (Index % 2 == 0) ? FVariantData(Index) : FVariantData(FString::Printf(TEXT("value%d"), Index)));
+	}
+	return StorageAttrs;
+}
+
+/**
+ * Party data change handling as the party interface used to do it, looking the leader up through a new user ID, writing
+ * storage out to a string and wrapping it for FOnlinePartyData::FromJson, then replacing the whole party data with the
+ * result. Kept here so the benchmark has something to compare against.
+ */
+void LegacyHandlePartyDataChange(FOnlinePartyAccelByte& Party, const FAccelByteModelsPartyDataNotif& Notification)
+{
+	FAccelByteUniqueIdComposite LeaderCompositeId;
+	LeaderCompositeId.Id = Notification.Leader;
+	const TSharedPtr<const FOnlinePartyMemberAccelByte> LeaderMember = Party.GetMember(FUniqueNetIdAccelByteUser::Create(LeaderCompositeId).ToSharedRef());
+	if (LeaderMember.IsValid())
+	{
+		Party.LeaderId = LeaderMember->GetUserId();
+	}
+
+	FString JSONString;
+	if (!Notification.Custom_attribute.JsonObjectToString(JSONString) || JSONString.Len() == 2)
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> MainJsonObj = MakeShared<FJsonObject>();
+	MainJsonObj->SetField(TEXT("Attrs"), MakeShared<FJsonValueObject>(Notification.Custom_attribute.JsonObject));
+
+	FJsonObjectWrapper PartyStorageData;
+	PartyStorageData.JsonObject = MainJsonObj;
+	PartyStorageData.JsonObjectToString(JSONString);
+
+	TSharedRef<FOnlinePartyData> PartyData = MakeShared<FOnlinePartyData>();
+	PartyData->FromJson(JSONString);
+	Party.SetPartyData(PartyData);
+}
+
+/** Number of allocations made so far across the whole process, or zero if stats are not enabled */
+uint64 GetTotalMallocCalls()
+{
+#if STATS
+	return FMalloc::TotalMallocCalls;
+#else
+	return 0;
+#endif
+}
+
+bool HasSamePartyDataAttrs(const FOnlinePartyData& PartyData, const FOnlinePartyData& OtherPartyData)
+{
+	if (PartyData.GetKeyValAttrs().Num() != OtherPartyData.GetKeyValAttrs().Num())
+	{
+		return false;
+	}
+
+	FVariantData OtherValue;
+	for (const TPair<FString, FVariantData>& Attr : PartyData.GetKeyValAttrs())
+	{
+		if (!OtherPartyData.GetAttribute(Attr.Key, OtherValue) || OtherValue != Attr.Value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Party added to a party interface of the test's own for the first member, as the local user, along with a copy of it
+ * outside of the interface for the legacy handler. Records every change the party interface announces.
+ */
+struct FPartyDataNotificationsFixture
+{
+	const FString PartyId = TEXT("partydatatest");
+	TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> PartyInterface;
+	TArray<TSharedRef<const FUniqueNetIdAccelByteUser>> MemberIds;
+	TSharedPtr<FOnlinePartyAccelByte> Party;
+	TSharedPtr<FOnlinePartyAccelByte> LegacyParty;
+	FDelegateHandle OnPartyDataAttributesChangedHandle;
+
+	/** Number of times the party interface announced changed attributes */
+	int32 NumAnnouncedChanges = 0;
+
+	/** Number of attributes updated across every announced change */
+	int32 NumUpdatedAttrs = 0;
+
+	/** Most recent change announced by the party interface */
+	FAccelBytePartyStorageDelta LastChanges;
+
+	~FPartyDataNotificationsFixture()
+	{
+		// Parties hold on to their owning interface, so take them back out of it or neither is ever freed
+		if (PartyInterface.IsValid())
+		{
+			PartyInterface->ClearOnPartyDataAttributesChangedDelegate_Handle(OnPartyDataAttributesChangedHandle);
+			PartyInterface->RemovePartyFromInterface(GetLocalUserId());
+		}
+	}
+
+	bool Load()
+	{
+		PartyInterface = AccelByteTests::MakeTestPartyInterface();
+		if (!PartyInterface.IsValid())
+		{
+			return false;
+		}
+
+		// Give members platform information, so that an ID built from the plain AccelByte ID is not the same as theirs
+		for (int32 MemberIndex = 0; MemberIndex < MembersPerPartyDataParty; MemberIndex++)
+		{
+			MemberIds.Add(AccelByteTests::MakeTestUserId(MemberIndex, TEXT("STEAM")));
+		}
+
+		Party = MakeParty();
+		LegacyParty = MakeParty();
+		PartyInterface->AddPartyToInterface(GetLocalUserId(), Party.ToSharedRef());
+
+		OnPartyDataAttributesChangedHandle = PartyInterface->AddOnPartyDataAttributesChangedDelegate_Handle(FOnPartyDataAttributesChangedDelegate::CreateLambda(
+			[this](const FUniqueNetId& /*LocalUserId*/, const FOnlinePartyId& /*PartyId*/, const FName& /*Namespace*/, const FAccelBytePartyStorageDelta& Changes) {
+				NumAnnouncedChanges++;
+				NumUpdatedAttrs += Changes.UpdatedAttrs.Num();
+				LastChanges = Changes;
+			}));
+		return true;
+	}
+
+	const TSharedRef<const FUniqueNetIdAccelByteUser>& GetLocalUserId() const
+	{
+		return MemberIds[0];
+	}
+
+	/** Hand a notification to the party interface's handler, as the local user would receive it */
+	void Handle(const FAccelByteModelsPartyDataNotif& Notification)
+	{
+		FOnlinePartyDataNotificationsTestAccess::HandleNotification(*PartyInterface, GetLocalUserId(), Notification);
+	}
+
+private:
+
+	TSharedRef<FOnlinePartyAccelByte> MakeParty() const
+	{
+		const TSharedRef<FOnlinePartyAccelByte> NewParty = MakeShared<FOnlinePartyAccelByte>(PartyInterface.ToSharedRef(), PartyId, TEXT(""), FPartyConfiguration(), GetLocalUserId());
+		for (const TSharedRef<const FUniqueNetIdAccelByteUser>& MemberId : MemberIds)
+		{
+			NewParty->AddMember(GetLocalUserId(), MakeShared<FOnlinePartyMemberAccelByte>(MemberId, MemberId->GetAccelByteId()));
+		}
+		return NewParty;
+	}
+};
+
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyDataNotificationsBenchmarkTest, "AccelByte.OSS.Party.DataNotifications.Benchmark", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyDataNotificationsBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FPartyDataNotificationsFixture Fixture;
+	if (!Fixture.Load())
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	// Every notification carries the whole of party storage with one more attribute changed than the last, and promotes
+	// the next member along, which is what a leader tweaking lobby settings and handing over the party looks like
+	TMap<FString, FVariantData> StorageAttrs = MakeTestStorageAttrs();
+	const FAccelByteModelsPartyDataNotif InitialNotification = MakeTestPartyDataNotification(Fixture.PartyId, Fixture.GetLocalUserId()->GetAccelByteId(), StorageAttrs);
+
+	TArray<FAccelByteModelsPartyDataNotif> Notifications;
+	Notifications.Reserve(NumPartyDataIterations);
+	for (int32 Iteration = 0; Iteration < NumPartyDataIterations; Iteration++)
+	{
+		StorageAttrs.Add(FString::Printf(TEXT("attr%d"), Iteration % NumPartyDataAttributes), FVariantData(FString::Printf(TEXT("changed%d"), Iteration)));
+		Notifications.Add(MakeTestPartyDataNotification(Fixture.PartyId, Fixture.MemberIds[(Iteration + 1) % MembersPerPartyDataParty]->GetAccelByteId(), StorageAttrs));
+	}
+
+	// Fill both parties with the initial storage first, so that the timed passes only see one attribute change at a time
+	LegacyHandlePartyDataChange(*Fixture.LegacyParty, InitialNotification);
+	Fixture.Handle(InitialNotification);
+	Fixture.NumUpdatedAttrs = 0;
+
+	const uint64 LegacyStartMallocCalls = GetTotalMallocCalls();
+	const double LegacyStartTime = FPlatformTime::Seconds();
+	for (const FAccelByteModelsPartyDataNotif& Notification : Notifications)
+	{
+		LegacyHandlePartyDataChange(*Fixture.LegacyParty, Notification);
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - LegacyStartTime;
+	const uint64 LegacyMallocCalls = GetTotalMallocCalls() - LegacyStartMallocCalls;
+
+	// Party storage is read off the game thread by the notification dispatcher, here it is counted in with the handler
+	const uint64 DiffedStartMallocCalls = GetTotalMallocCalls();
+	const double DiffedStartTime = FPlatformTime::Seconds();
+	for (const FAccelByteModelsPartyDataNotif& Notification : Notifications)
+	{
+		Fixture.Handle(Notification);
+	}
+	const double DiffedSeconds = FPlatformTime::Seconds() - DiffedStartTime;
+	const uint64 DiffedMallocCalls = GetTotalMallocCalls() - DiffedStartMallocCalls;
+
+#if STATS
+	// Allocation counts are process wide, so other threads add some noise to both passes
+	AddInfo(FString::Printf(TEXT("Handled %d notifications with %d attributes: legacy %.3fms (%.1f allocations per notification), party interface %.3fms (%.1f allocations per notification)"),
+		NumPartyDataIterations, NumPartyDataAttributes,
+		LegacySeconds * 1000.0, static_cast<double>(LegacyMallocCalls) / NumPartyDataIterations,
+		DiffedSeconds * 1000.0, static_cast<double>(DiffedMallocCalls) / NumPartyDataIterations));
+#else
+	AddInfo(FString::Printf(TEXT("Handled %d notifications with %d attributes: legacy %.3fms, party interface %.3fms, allocations are only counted with stats enabled"),
+		NumPartyDataIterations, NumPartyDataAttributes, LegacySeconds * 1000.0, DiffedSeconds * 1000.0));
+#endif
+
+	TestEqual(TEXT("Attributes changed per notification"), Fixture.NumUpdatedAttrs, NumPartyDataIterations);
+	TestTrue(TEXT("Matching party data after both passes"), HasSamePartyDataAttrs(Fixture.LegacyParty->GetPartyData().Get(), Fixture.Party->GetPartyData().Get()));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyDataNotificationsLeaderTest, "AccelByte.OSS.Party.DataNotifications.Leader", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyDataNotificationsLeaderTest::RunTest(const FString& Parameters)
+{
+	FPartyDataNotificationsFixture Fixture;
+	if (!Fixture.Load())
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	// The new leader must be the member's own ID, with their platform information, not one built from the notification
+	const TSharedRef<const FUniqueNetIdAccelByteUser>& NewLeaderId = Fixture.MemberIds[2];
+	Fixture.Handle(MakeTestPartyDataNotification(Fixture.PartyId, NewLeaderId->GetAccelByteId(), MakeTestStorageAttrs()));
+
+	TestTrue(TEXT("Leader ID reused from the member"), Fixture.Party->LeaderId.Get() == &NewLeaderId.Get());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyDataNotificationsRepeatTest, "AccelByte.OSS.Party.DataNotifications.Repeat", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyDataNotificationsRepeatTest::RunTest(const FString& Parameters)
+{
+	FPartyDataNotificationsFixture Fixture;
+	if (!Fixture.Load())
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	const FAccelByteModelsPartyDataNotif Notification = MakeTestPartyDataNotification(Fixture.PartyId, Fixture.GetLocalUserId()->GetAccelByteId(), MakeTestStorageAttrs());
+	Fixture.Handle(Notification);
+	const int32 NumAnnouncedBeforeRepeat = Fixture.NumAnnouncedChanges;
+	const FOnlinePartyData* PartyDataBeforeRepeat = &Fixture.Party->GetPartyData().Get();
+
+	// The same storage again changes nothing, and leaves the party data instance alone
+	Fixture.Handle(Notification);
+
+	TestEqual(TEXT("Changes announced for the first notification"), NumAnnouncedBeforeRepeat, 1);
+	TestEqual(TEXT("Changes announced for a repeated notification"), Fixture.NumAnnouncedChanges, NumAnnouncedBeforeRepeat);
+	TestTrue(TEXT("Party data kept on a repeated notification"), &Fixture.Party->GetPartyData().Get() == PartyDataBeforeRepeat);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyDataNotificationsHeldDataTest, "AccelByte.OSS.Party.DataNotifications.HeldData", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyDataNotificationsHeldDataTest::RunTest(const FString& Parameters)
+{
+	FPartyDataNotificationsFixture Fixture;
+	if (!Fixture.Load())
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	TMap<FString, FVariantData> StorageAttrs = MakeTestStorageAttrs();
+	Fixture.Handle(MakeTestPartyDataNotification(Fixture.PartyId, Fixture.GetLocalUserId()->GetAccelByteId(), StorageAttrs));
+
+	// Anyone holding on to the party data keeps what they had when an attribute is changed and another removed
+	const TSharedRef<const FOnlinePartyData> HeldPartyData = Fixture.Party->GetPartyData();
+	StorageAttrs.Add(TEXT("attr0"), FVariantData(FString(TEXT("changedagain"))));
+	StorageAttrs.Remove(TEXT("attr1"));
+	Fixture.Handle(MakeTestPartyDataNotification(Fixture.PartyId, Fixture.GetLocalUserId()->GetAccelByteId(), StorageAttrs));
+
+	FVariantData HeldValue;
+	TestEqual(TEXT("Updated attributes"), Fixture.LastChanges.UpdatedAttrs.Num(), 1);
+	TestEqual(TEXT("Removed attributes"), Fixture.LastChanges.RemovedAttrs.Num(), 1);
+	TestTrue(TEXT("Removed attribute still in held party data"), HeldPartyData->GetAttribute(TEXT("attr1"), HeldValue));
+	TestTrue(TEXT("Party data replaced rather than changed in place"), &HeldPartyData.Get() != &Fixture.Party->GetPartyData().Get());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyDataNotificationsUnwrittenTest, "AccelByte.OSS.Party.DataNotifications.Unwritten", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyDataNotificationsUnwrittenTest::RunTest(const FString& Parameters)
+{
+	FOnlinePartyData CurrentPartyData;
+	CurrentPartyData.SetAttribute(TEXT("Local"), FVariantData(FString(TEXT("Ours"))));
+	CurrentPartyData.SetAttribute(TEXT("Remote"), FVariantData(FString(TEXT("Old"))));
+
+	// Storage written before our change to Local lands must not revert it, while changes from others still come through
+	TMap<FString, FVariantData> StorageAttrs;
+	StorageAttrs.Add(TEXT("Local"), FVariantData(FString(TEXT("Stale"))));
+	StorageAttrs.Add(TEXT("Remote"), FVariantData(FString(TEXT("New"))));
+
+	FAccelBytePartyStorageDelta UnwrittenDelta;
+	UnwrittenDelta.UpdatedAttrs.Add(TEXT("Local"), FVariantData(FString(TEXT("Ours"))));
+
+	const FAccelBytePartyStorageDelta Delta = FAccelBytePartyStorageDelta::FromPartyStorage(CurrentPartyData, StorageAttrs, UnwrittenDelta);
+	TestEqual(TEXT("Updated attributes"), Delta.UpdatedAttrs.Num(), 1);
+	TestTrue(TEXT("Change from others kept"), Delta.UpdatedAttrs.Contains(TEXT("Remote")));
+	TestEqual(TEXT("Removed attributes"), Delta.RemovedAttrs.Num(), 0);
+	return true;
+}
+
+#endif
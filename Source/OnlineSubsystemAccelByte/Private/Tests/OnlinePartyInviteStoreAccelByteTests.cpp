@@ -0,0 +1,140 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OnlineSubsystemAccelByteTestHelpers.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+#include "OnlinePartyInviteStoreAccelByte.h"
+
+namespace
+{
+
+/** Cap on invites per user used by every test, matching the default setting */
+constexpr int32 MaxTestInvitesPerUser = 50;
+
+/** Time to live of invites used by every test, matching the default setting */
+constexpr double TestInviteTTLSeconds = 600.0;
+
+/** Number of invites sent in the storm test, far more than the store holds */
+constexpr int32 NumStormInvites = 10000;
+
+TSharedRef<const FAccelBytePartyInvite> MakeTestInvite(const FString& PartyId, const TSharedRef<const FUniqueNetIdAccelByteUser>& InviterId)
+{
+	return MakeShared<const FAccelBytePartyInvite>(MakeShared<const FOnlinePartyIdAccelByte>(PartyId), InviterId, TEXT("Inviter"), TEXT("InviteToken"));
+}
+
+}
+
+// Time is passed in to the store by hand in each of these, so every test runs synchronously
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyInvitesStormTest, "AccelByte.OSS.Party.Invites.Storm", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyInvitesStormTest::RunTest(const FString& Parameters)
+{
+	FAccelBytePartyInviteStore Store;
+	const TSharedRef<const FUniqueNetIdAccelByteUser> LocalUserId = AccelByteTests::MakeTestUserId(0);
+
+	TArray<TSharedRef<const FUniqueNetIdAccelByteUser>> InviterIds;
+	InviterIds.Reserve(NumStormInvites);
+	for (int32 Index = 0; Index < NumStormInvites; Index++)
+	{
+		InviterIds.Add(AccelByteTests::MakeTestUserId(Index + 1));
+	}
+
+	int32 NumEvicted = 0;
+	int32 MaxHeld = 0;
+	TArray<TSharedRef<const FAccelBytePartyInvite>> EvictedInvites;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumStormInvites; Index++)
+	{
+		EvictedInvites.Reset();
+		Store.AddInvite(LocalUserId, MakeTestInvite(FString::Printf(TEXT("party%d"), Index), InviterIds[Index]), Index * 0.001, TestInviteTTLSeconds, MaxTestInvitesPerUser, EvictedInvites);
+		NumEvicted += EvictedInvites.Num();
+		MaxHeld = FMath::Max(MaxHeld, Store.GetNumInvites(LocalUserId.Get()));
+	}
+	const double StormSeconds = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("Added %d invites in %.3fms (%.1fns per invite)"), NumStormInvites, StormSeconds * 1000.0, StormSeconds * 1.0e9 / NumStormInvites));
+
+	// Only the newest invites survive, so the first one kept is the one sent just after the last one evicted
+	TArray<TSharedRef<const FAccelBytePartyInvite>> HeldInvites;
+	Store.GetInvites(LocalUserId.Get(), HeldInvites);
+	const FString FirstHeldPartyId = FString::Printf(TEXT("party%d"), NumStormInvites - MaxTestInvitesPerUser);
+
+	TestEqual(TEXT("Most invites held at once"), MaxHeld, MaxTestInvitesPerUser);
+	TestEqual(TEXT("Invites held"), HeldInvites.Num(), MaxTestInvitesPerUser);
+	TestEqual(TEXT("Evicted invites"), NumEvicted, NumStormInvites - MaxTestInvitesPerUser);
+	TestTrue(TEXT("Newest invites kept"), HeldInvites.Num() > 0 && HeldInvites[0]->PartyId->ToString() == FirstHeldPartyId);
+
+	// Evicted invites can no longer be found by either index, while held ones can be found by both
+	TestTrue(TEXT("Newest invite found by inviter"), Store.FindInviteFromInviter(LocalUserId.Get(), InviterIds.Last()->GetAccelByteId()).IsValid());
+	TestTrue(TEXT("Newest invite found by party"), Store.FindInviteForParty(LocalUserId.Get(), FString::Printf(TEXT("party%d"), NumStormInvites - 1)).IsValid());
+	TestFalse(TEXT("Oldest invite found by inviter"), Store.FindInviteFromInviter(LocalUserId.Get(), InviterIds[0]->GetAccelByteId()).IsValid());
+	TestFalse(TEXT("Oldest invite found by party"), Store.FindInviteForParty(LocalUserId.Get(), TEXT("party0")).IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyInvitesReplaceTest, "AccelByte.OSS.Party.Invites.Replace", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyInvitesReplaceTest::RunTest(const FString& Parameters)
+{
+	FAccelBytePartyInviteStore Store;
+	const TSharedRef<const FUniqueNetIdAccelByteUser> LocalUserId = AccelByteTests::MakeTestUserId(0);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> FirstInviterId = AccelByteTests::MakeTestUserId(1);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> SecondInviterId = AccelByteTests::MakeTestUserId(2);
+	TArray<TSharedRef<const FAccelBytePartyInvite>> EvictedInvites;
+
+	// The same inviter moving to another party replaces their earlier invite
+	Store.AddInvite(LocalUserId, MakeTestInvite(TEXT("partyA"), FirstInviterId), 0.0, TestInviteTTLSeconds, MaxTestInvitesPerUser, EvictedInvites);
+	Store.AddInvite(LocalUserId, MakeTestInvite(TEXT("partyB"), FirstInviterId), 1.0, TestInviteTTLSeconds, MaxTestInvitesPerUser, EvictedInvites);
+	TestEqual(TEXT("Invites after same inviter"), Store.GetNumInvites(LocalUserId.Get()), 1);
+	TestFalse(TEXT("Replaced party found"), Store.FindInviteForParty(LocalUserId.Get(), TEXT("partyA")).IsValid());
+
+	// Another inviter sending an invite to that same party replaces it again
+	Store.AddInvite(LocalUserId, MakeTestInvite(TEXT("partyB"), SecondInviterId), 2.0, TestInviteTTLSeconds, MaxTestInvitesPerUser, EvictedInvites);
+	TestEqual(TEXT("Invites after same party"), Store.GetNumInvites(LocalUserId.Get()), 1);
+	TestFalse(TEXT("Replaced inviter found"), Store.FindInviteFromInviter(LocalUserId.Get(), FirstInviterId->GetAccelByteId()).IsValid());
+
+	const TSharedPtr<const FAccelBytePartyInvite> RemovedInvite = Store.RemoveInviteFromInviter(LocalUserId.Get(), SecondInviterId->GetAccelByteId());
+	TestTrue(TEXT("Removed invite for newest party"), RemovedInvite.IsValid() && RemovedInvite->PartyId->ToString() == TEXT("partyB"));
+	TestEqual(TEXT("Invites after removal"), Store.GetTotalNumInvites(), 0);
+	TestEqual(TEXT("Evicted invites"), EvictedInvites.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyInvitesExpiryTest, "AccelByte.OSS.Party.Invites.Expiry", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyInvitesExpiryTest::RunTest(const FString& Parameters)
+{
+	int32 NumExpired = 0;
+	FAccelBytePartyInviteStore Store(FOnAccelBytePartyInviteExpired::CreateLambda([&NumExpired](const TSharedRef<const FUniqueNetIdAccelByteUser>& /*LocalUserId*/, const TSharedRef<const FAccelBytePartyInvite>& /*Invite*/) {
+		NumExpired++;
+	}));
+
+	// Invites spread over two local users, with one invite that never expires
+	TArray<TSharedRef<const FAccelBytePartyInvite>> EvictedInvites;
+	for (int32 Index = 0; Index < 10; Index++)
+	{
+		const TSharedRef<const FUniqueNetIdAccelByteUser> LocalUserId = AccelByteTests::MakeTestUserId(Index % 2);
+		Store.AddInvite(LocalUserId, MakeTestInvite(FString::Printf(TEXT("party%d"), Index), AccelByteTests::MakeTestUserId(Index + 2)), Index, 10.0, MaxTestInvitesPerUser, EvictedInvites);
+	}
+	Store.AddInvite(AccelByteTests::MakeTestUserId(0), MakeTestInvite(TEXT("partyForever"), AccelByteTests::MakeTestUserId(100)), 0.0, 0.0, MaxTestInvitesPerUser, EvictedInvites);
+
+	Store.Tick(9.5);
+	TestEqual(TEXT("Expired before time to live"), NumExpired, 0);
+
+	// Invites were received a second apart, so half of them are past their time to live five seconds later
+	Store.Tick(14.5);
+	TestEqual(TEXT("Expired halfway"), NumExpired, 5);
+	TestEqual(TEXT("Invites held halfway"), Store.GetTotalNumInvites(), 6);
+
+	Store.Tick(1000.0);
+	TestEqual(TEXT("Expired at the end"), NumExpired, 10);
+	TestEqual(TEXT("Invites held at the end"), Store.GetTotalNumInvites(), 1);
+	TestTrue(TEXT("Invite without time to live found"), Store.FindInviteForParty(AccelByteTests::MakeTestUserId(0).Get(), TEXT("partyForever")).IsValid());
+	return true;
+}
+
+#endif
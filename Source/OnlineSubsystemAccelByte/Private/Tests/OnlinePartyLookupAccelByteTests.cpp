@@ -0,0 +1,240 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OnlineSubsystemAccelByteTestHelpers.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+
+namespace
+{
+
+/** Number of parties loaded into the party interface, the way a dedicated server tracking many parties would */
+constexpr int32 NumLookupParties = 500;
+
+/** Number of members put in each party, matching a typical party size */
+constexpr int32 MembersPerLookupParty = 4;
+
+/** Number of times every member is looked up in each timed pass of the benchmark */
+constexpr int32 NumLookupIterations = 100;
+
+/** Map of user IDs to their parties, keyed by composite user ID as the party interface used to keep it */
+using FLegacyUserIdToPartiesMap = TMap<TSharedRef<const FUniqueNetIdAccelByteUser>, FPartyIDToPartyMap, FDefaultSetAllocator, TUserUniqueIdConstSharedRefMapKeyFuncs<FPartyIDToPartyMap>>;
+
+/**
+ * Membership check as the party interface used to do it, walking the user's parties and comparing each party ID as a
+ * string. Kept here so the benchmark has something to compare against.
+ */
+bool LegacyIsPlayerInParty(const FLegacyUserIdToPartiesMap& UserIdToPartiesMap, const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FOnlinePartyIdAccelByte>& PartyId)
+{
+	if (!UserId->IsValid())
+	{
+		return false;
+	}
+
+	const FPartyIDToPartyMap* FoundPartyMap = UserIdToPartiesMap.Find(UserId);
+	if (FoundPartyMap != nullptr)
+	{
+		if (!PartyId->IsValid())
+		{
+			return false;
+		}
+
+		for (auto FoundPartyPair : *FoundPartyMap)
+		{
+			if (FoundPartyPair.Key->ToString() == PartyId->ToString())
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/** Parties loaded into a party interface of the test's own, with every member next to the ID of their party */
+struct FPartyLookupFixture
+{
+	TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> PartyInterface;
+	FLegacyUserIdToPartiesMap LegacyUserIdToPartiesMap;
+	TArray<TSharedRef<const FUniqueNetIdAccelByteUser>> MemberIds;
+	TArray<TSharedRef<const FOnlinePartyIdAccelByte>> MemberPartyIds;
+
+	~FPartyLookupFixture()
+	{
+		// Parties hold on to their owning interface, so take them back out of it or neither is ever freed
+		if (PartyInterface.IsValid())
+		{
+			for (int32 Index = 0; Index < MemberIds.Num(); Index++)
+			{
+				PartyInterface->RemovePartyFromInterface(MemberIds[Index], MemberPartyIds[Index]);
+			}
+		}
+	}
+
+	bool Load(int32 NumParties)
+	{
+		PartyInterface = AccelByteTests::MakeTestPartyInterface();
+		if (!PartyInterface.IsValid())
+		{
+			return false;
+		}
+
+		MemberIds.Reserve(NumParties * MembersPerLookupParty);
+		MemberPartyIds.Reserve(NumParties * MembersPerLookupParty);
+		for (int32 PartyIndex = 0; PartyIndex < NumParties; PartyIndex++)
+		{
+			// Give members platform information, as players joining through a platform would have
+			TArray<TSharedRef<const FUniqueNetIdAccelByteUser>> PartyMemberIds;
+			for (int32 MemberIndex = 0; MemberIndex < MembersPerLookupParty; MemberIndex++)
+			{
+				PartyMemberIds.Add(AccelByteTests::MakeTestUserId(PartyIndex * MembersPerLookupParty + MemberIndex, TEXT("STEAM")));
+			}
+
+			const FString PartyIdString = FString::Printf(TEXT("%032x"), PartyIndex);
+			const TSharedRef<FOnlinePartyAccelByte> Party = MakeShared<FOnlinePartyAccelByte>(PartyInterface.ToSharedRef(), PartyIdString, TEXT(""), FPartyConfiguration(), PartyMemberIds[0]);
+			const TSharedRef<const FOnlinePartyIdAccelByte> PartyId = StaticCastSharedRef<const FOnlinePartyIdAccelByte>(Party->PartyId);
+			for (const TSharedRef<const FUniqueNetIdAccelByteUser>& MemberId : PartyMemberIds)
+			{
+				PartyInterface->AddPartyToInterface(MemberId, Party);
+				LegacyUserIdToPartiesMap.FindOrAdd(MemberId).Add(PartyId, Party);
+				MemberIds.Add(MemberId);
+				MemberPartyIds.Add(PartyId);
+			}
+		}
+		return true;
+	}
+
+	/** ID of the party of the member a party along from the member at the given index, which they are not in */
+	const TSharedRef<const FOnlinePartyIdAccelByte>& GetOtherPartyId(int32 Index) const
+	{
+		return MemberPartyIds[(Index + MembersPerLookupParty) % MemberIds.Num()];
+	}
+};
+
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyLookupMembershipTest, "AccelByte.OSS.Party.Lookup.Membership", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyLookupMembershipTest::RunTest(const FString& Parameters)
+{
+	FPartyLookupFixture Fixture;
+	if (!Fixture.Load(NumLookupParties))
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	int32 NumOwnPartyHits = 0;
+	int32 NumOtherPartyHits = 0;
+	for (int32 Index = 0; Index < Fixture.MemberIds.Num(); Index++)
+	{
+		NumOwnPartyHits += Fixture.PartyInterface->IsPlayerInParty(Fixture.MemberIds[Index].Get(), Fixture.MemberPartyIds[Index].Get()) ? 1 : 0;
+		NumOtherPartyHits += Fixture.PartyInterface->IsPlayerInParty(Fixture.MemberIds[Index].Get(), Fixture.GetOtherPartyId(Index).Get()) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Members found in their own party"), NumOwnPartyHits, Fixture.MemberIds.Num());
+	TestEqual(TEXT("Members found in another party"), NumOtherPartyHits, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyLookupPlainIdTest, "AccelByte.OSS.Party.Lookup.PlainId", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyLookupPlainIdTest::RunTest(const FString& Parameters)
+{
+	FPartyLookupFixture Fixture;
+	if (!Fixture.Load(NumLookupParties))
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	// An ID for the same member without platform information, as it would arrive from a Lobby notification, must still
+	// resolve to their party
+	int32 NumPlainIdHits = 0;
+	for (int32 Index = 0; Index < Fixture.MemberIds.Num(); Index++)
+	{
+		const TSharedRef<const FUniqueNetIdAccelByteUser> PlainId = AccelByteTests::MakeTestUserId(Index);
+		NumPlainIdHits += Fixture.PartyInterface->IsPlayerInParty(PlainId.Get(), Fixture.MemberPartyIds[Index].Get()) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Members found by IDs without platform information"), NumPlainIdHits, Fixture.MemberIds.Num());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyLookupRemovalTest, "AccelByte.OSS.Party.Lookup.Removal", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyLookupRemovalTest::RunTest(const FString& Parameters)
+{
+	FPartyLookupFixture Fixture;
+	if (!Fixture.Load(NumLookupParties))
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Fixture.MemberIds.Num(); Index++)
+	{
+		Fixture.PartyInterface->RemovePartyFromInterface(Fixture.MemberIds[Index], Fixture.MemberPartyIds[Index]);
+	}
+
+	int32 NumMembersLeftInParties = 0;
+	for (const TSharedRef<const FUniqueNetIdAccelByteUser>& MemberId : Fixture.MemberIds)
+	{
+		NumMembersLeftInParties += Fixture.PartyInterface->IsPlayerInAnyParty(MemberId.Get()) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Members left in parties after removal"), NumMembersLeftInParties, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyLookupBenchmarkTest, "AccelByte.OSS.Party.Lookup.Benchmark", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyLookupBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FPartyLookupFixture Fixture;
+	if (!Fixture.Load(NumLookupParties))
+	{
+		AddError(TEXT("The AccelByte subsystem is not loaded"));
+		return false;
+	}
+
+	const int32 NumMembers = Fixture.MemberIds.Num();
+	const int32 NumLookups = NumMembers * NumLookupIterations * 2;
+
+	// Each pass looks every member up in their own party and in the next party along, so half of the lookups miss
+	int32 NumLegacyHits = 0;
+	const double LegacyStartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumLookupIterations; Iteration++)
+	{
+		for (int32 Index = 0; Index < NumMembers; Index++)
+		{
+			NumLegacyHits += LegacyIsPlayerInParty(Fixture.LegacyUserIdToPartiesMap, Fixture.MemberIds[Index], Fixture.MemberPartyIds[Index]) ? 1 : 0;
+			NumLegacyHits += LegacyIsPlayerInParty(Fixture.LegacyUserIdToPartiesMap, Fixture.MemberIds[Index], Fixture.GetOtherPartyId(Index)) ? 1 : 0;
+		}
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - LegacyStartTime;
+
+	int32 NumIndexedHits = 0;
+	const double IndexedStartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumLookupIterations; Iteration++)
+	{
+		for (int32 Index = 0; Index < NumMembers; Index++)
+		{
+			NumIndexedHits += Fixture.PartyInterface->IsPlayerInParty(Fixture.MemberIds[Index].Get(), Fixture.MemberPartyIds[Index].Get()) ? 1 : 0;
+			NumIndexedHits += Fixture.PartyInterface->IsPlayerInParty(Fixture.MemberIds[Index].Get(), Fixture.GetOtherPartyId(Index).Get()) ? 1 : 0;
+		}
+	}
+	const double IndexedSeconds = FPlatformTime::Seconds() - IndexedStartTime;
+
+	AddInfo(FString::Printf(TEXT("Ran %d lookups over %d parties: legacy %.3fms (%.1fns per lookup), indexed %.3fms (%.1fns per lookup), %.1fx faster"),
+		NumLookups, NumLookupParties,
+		LegacySeconds * 1000.0, LegacySeconds * 1.0e9 / NumLookups,
+		IndexedSeconds * 1000.0, IndexedSeconds * 1.0e9 / NumLookups,
+		IndexedSeconds > 0.0 ? LegacySeconds / IndexedSeconds : 0.0));
+
+	TestEqual(TEXT("Legacy lookup hits"), NumLegacyHits, NumMembers * NumLookupIterations);
+	TestEqual(TEXT("Indexed lookup hits"), NumIndexedHits, NumMembers * NumLookupIterations);
+	return true;
+}
+
+#endif
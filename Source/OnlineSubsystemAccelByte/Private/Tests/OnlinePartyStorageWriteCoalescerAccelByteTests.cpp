@@ -0,0 +1,259 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OnlineSubsystemAccelByteTestHelpers.h"
+#include "OnlinePartyStorageWriteCoalescerAccelByte.h"
+#include "Interfaces/OnlinePartyInterface.h"
+#include "JsonObjectWrapper.h"
+
+namespace
+{
+
+/**
+ * Stand in for party storage on Lobby. Counts every write sent to it, and can fail writes, hold on to their completion,
+ * or have another member's write land first so that the writer has to be run again on the newer storage, which is what
+ * Lobby does when a write loses a revision conflict.
+ */
+struct FFakePartyStorage
+{
+	/** Current contents of party storage */
+	TSharedRef<FJsonObject> Storage = MakeShared<FJsonObject>();
+
+	/** Number of writes that reached party storage */
+	int32 NumWrites = 0;
+
+	/** Number of upcoming writes that should fail */
+	int32 NumFailuresToInject = 0;
+
+	/** Whether the next write should race a write from another member */
+	bool bConflictOnNextWrite = false;
+
+	/** Whether writes are held in flight until CompleteDeferredWrite is called, rather than completing straight away */
+	bool bDeferCompletion = false;
+
+	/** Completion of the write being held in flight */
+	FOnPartyStorageWriteComplete DeferredComplete;
+
+	void Write(const FAccelBytePartyStorageDelta& Delta, const FOnPartyStorageWriteComplete& OnComplete)
+	{
+		NumWrites++;
+
+		if (NumFailuresToInject > 0)
+		{
+			NumFailuresToInject--;
+			OnComplete.ExecuteIfBound(false);
+			return;
+		}
+
+		if (bConflictOnNextWrite)
+		{
+			// The writer runs against the revision we read, another member's write lands first, and the writer is run again
+			// against the new revision
+			TSharedRef<FJsonObject> StaleStorage = MakeShared<FJsonObject>();
+			StaleStorage->Values = Storage->Values;
+			Delta.ApplyToJsonObject(StaleStorage);
+
+			FVariantData(FString(TEXT("OtherMemberValue"))).AddToJsonObject(Storage, TEXT("OtherMemberKey"), true);
+			bConflictOnNextWrite = false;
+		}
+
+		Delta.ApplyToJsonObject(Storage);
+
+		if (bDeferCompletion)
+		{
+			DeferredComplete = OnComplete;
+		}
+		else
+		{
+			OnComplete.ExecuteIfBound(true);
+		}
+	}
+
+	void CompleteDeferredWrite(bool bWasSuccessful)
+	{
+		FOnPartyStorageWriteComplete Complete = DeferredComplete;
+		DeferredComplete.Unbind();
+		Complete.ExecuteIfBound(bWasSuccessful);
+	}
+
+	/** Read an attribute back out of storage the same way party storage notifications are read */
+	FString GetStringAttribute(const FString& Key) const
+	{
+		TSharedRef<FJsonObject> MainJsonObj = MakeShared<FJsonObject>();
+		MainJsonObj->SetObjectField(TEXT("Attrs"), Storage);
+
+		FJsonObjectWrapper Wrapper;
+		Wrapper.JsonObject = MainJsonObj;
+		FString JsonString;
+		Wrapper.JsonObjectToString(JsonString);
+
+		FOnlinePartyData PartyData;
+		PartyData.FromJson(JsonString);
+
+		FVariantData Value;
+		FString OutString;
+		if (PartyData.GetAttribute(Key, Value))
+		{
+			Value.GetValue(OutString);
+		}
+		return OutString;
+	}
+};
+
+TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe> MakeFakeStorageCoalescer(const TSharedRef<FFakePartyStorage>& FakeStorage, double CoalesceWindowSeconds, int32 MaxRetries)
+{
+	FAccelBytePartyStorageWriteFunction WriteFunction = [FakeStorage](const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const FAccelBytePartyStorageDelta& Delta, const FOnPartyStorageWriteComplete& OnComplete) {
+		FakeStorage->Write(Delta, OnComplete);
+	};
+	return MakeShared<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>(WriteFunction, CoalesceWindowSeconds, MaxRetries);
+}
+
+FAccelBytePartyStorageDelta MakeStringStorageDelta(const FString& Key, const FString& Value)
+{
+	FAccelBytePartyStorageDelta Delta;
+	Delta.UpdatedAttrs.Add(Key, FVariantData(Value));
+	return Delta;
+}
+
+}
+
+// Time is passed in to the coalescer by hand in each of these, so every test runs synchronously
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyStorageWritesBurstTest, "AccelByte.OSS.Party.StorageWrites.Burst", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyStorageWritesBurstTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFakePartyStorage> FakeStorage = MakeShared<FFakePartyStorage>();
+	const TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe> Coalescer = MakeFakeStorageCoalescer(FakeStorage, 0.1, 3);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> UserId = AccelByteTests::MakeTestUserId(0);
+
+	// Ten changes made inside the coalescing window go out as one write
+	for (int32 Index = 0; Index < 10; Index++)
+	{
+		Coalescer->AddWrite(UserId, MakeStringStorageDelta(FString::Printf(TEXT("Key%d"), Index), TEXT("Value")), Index * 0.005);
+		Coalescer->Tick(Index * 0.005);
+	}
+	TestEqual(TEXT("Writes inside the window"), FakeStorage->NumWrites, 0);
+
+	Coalescer->Tick(0.2);
+	TestEqual(TEXT("Writes to storage"), FakeStorage->NumWrites, 1);
+	TestEqual(TEXT("Merged writes"), Coalescer->GetStats().NumMergedWrites, 9);
+	TestEqual(TEXT("Fields in storage"), FakeStorage->Storage->Values.Num(), 10);
+	TestTrue(TEXT("Idle after the write"), Coalescer->IsIdle());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyStorageWritesInFlightTest, "AccelByte.OSS.Party.StorageWrites.InFlight", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyStorageWritesInFlightTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFakePartyStorage> FakeStorage = MakeShared<FFakePartyStorage>();
+	FakeStorage->bDeferCompletion = true;
+	const TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe> Coalescer = MakeFakeStorageCoalescer(FakeStorage, 0.1, 3);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> UserId = AccelByteTests::MakeTestUserId(0);
+
+	Coalescer->AddWrite(UserId, MakeStringStorageDelta(TEXT("Key"), TEXT("First")), 0.0);
+	Coalescer->Tick(0.2);
+
+	// Every one of these lands while the first write is still in flight, so they wait for it and then go out together
+	for (int32 Index = 0; Index < 5; Index++)
+	{
+		Coalescer->AddWrite(UserId, MakeStringStorageDelta(TEXT("Key"), FString::Printf(TEXT("Second%d"), Index)), 0.3);
+		Coalescer->Tick(0.5);
+	}
+	TestEqual(TEXT("Writes while one is in flight"), FakeStorage->NumWrites, 1);
+
+	FakeStorage->CompleteDeferredWrite(true);
+	Coalescer->Tick(0.6);
+	FakeStorage->CompleteDeferredWrite(true);
+
+	TestEqual(TEXT("Writes to storage"), FakeStorage->NumWrites, 2);
+	TestEqual(TEXT("Merged writes"), Coalescer->GetStats().NumMergedWrites, 4);
+	TestEqual(TEXT("Latest value in storage"), FakeStorage->GetStringAttribute(TEXT("Key")), FString(TEXT("Second4")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyStorageWritesRetryTest, "AccelByte.OSS.Party.StorageWrites.Retry", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyStorageWritesRetryTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFakePartyStorage> FakeStorage = MakeShared<FFakePartyStorage>();
+	const TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe> Coalescer = MakeFakeStorageCoalescer(FakeStorage, 0.1, 3);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> UserId = AccelByteTests::MakeTestUserId(0);
+
+	// First write fails outright, and the retry then races another member's write
+	FakeStorage->NumFailuresToInject = 1;
+	FakeStorage->bConflictOnNextWrite = true;
+	Coalescer->AddWrite(UserId, MakeStringStorageDelta(TEXT("Key"), TEXT("Old")), 0.0);
+	Coalescer->AddWrite(UserId, MakeStringStorageDelta(TEXT("Untouched"), TEXT("Value")), 0.0);
+	Coalescer->Tick(0.2);
+
+	// A newer value for the same key made before the retry goes out has to win over the failed one
+	Coalescer->AddWrite(UserId, MakeStringStorageDelta(TEXT("Key"), TEXT("New")), 0.25);
+	Coalescer->Tick(0.4);
+
+	TestEqual(TEXT("Writes to storage"), FakeStorage->NumWrites, 2);
+	TestEqual(TEXT("Retried writes"), Coalescer->GetStats().NumRetriedWrites, 1);
+	TestEqual(TEXT("Newer value in storage"), FakeStorage->GetStringAttribute(TEXT("Key")), FString(TEXT("New")));
+	TestEqual(TEXT("Failed change kept"), FakeStorage->GetStringAttribute(TEXT("Untouched")), FString(TEXT("Value")));
+	TestEqual(TEXT("Other member's change kept"), FakeStorage->GetStringAttribute(TEXT("OtherMemberKey")), FString(TEXT("OtherMemberValue")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyStorageWritesDropTest, "AccelByte.OSS.Party.StorageWrites.Drop", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyStorageWritesDropTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFakePartyStorage> FakeStorage = MakeShared<FFakePartyStorage>();
+	const TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe> Coalescer = MakeFakeStorageCoalescer(FakeStorage, 0.1, 1);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> UserId = AccelByteTests::MakeTestUserId(0);
+
+	// A write that keeps failing is dropped once it runs out of retries
+	FakeStorage->NumFailuresToInject = 10;
+	Coalescer->AddWrite(UserId, MakeStringStorageDelta(TEXT("Key"), TEXT("Value")), 0.0);
+	for (int32 Index = 1; Index <= 5; Index++)
+	{
+		Coalescer->Tick(Index * 0.2);
+	}
+
+	TestEqual(TEXT("Writes to storage"), FakeStorage->NumWrites, 2);
+	TestEqual(TEXT("Failed writes"), Coalescer->GetStats().NumFailedWrites, 1);
+	TestTrue(TEXT("Idle after dropping the write"), Coalescer->IsIdle());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPartyStorageWritesSkipTest, "AccelByte.OSS.Party.StorageWrites.Skip", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FPartyStorageWritesSkipTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFakePartyStorage> FakeStorage = MakeShared<FFakePartyStorage>();
+	const TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe> Coalescer = MakeFakeStorageCoalescer(FakeStorage, 0.1, 3);
+	const TSharedRef<const FUniqueNetIdAccelByteUser> UserId = AccelByteTests::MakeTestUserId(0);
+
+	FOnlinePartyData CurrentPartyData;
+	CurrentPartyData.SetAttribute(TEXT("Same"), FVariantData(FString(TEXT("Value"))));
+	CurrentPartyData.SetAttribute(TEXT("Changed"), FVariantData(FString(TEXT("Old"))));
+
+	// Setting an attribute to the value it has and removing one that is not there both change nothing
+	FAccelBytePartyStorageDelta UnchangedDelta = MakeStringStorageDelta(TEXT("Same"), TEXT("Value"));
+	UnchangedDelta.RemovedAttrs.Add(TEXT("Missing"));
+	UnchangedDelta.RemoveUnchangedAttrs(CurrentPartyData);
+	Coalescer->AddWrite(UserId, UnchangedDelta, 0.0);
+	Coalescer->Tick(0.2);
+	TestEqual(TEXT("Writes for unchanged data"), FakeStorage->NumWrites, 0);
+
+	// Only the attribute that actually changed is written
+	FAccelBytePartyStorageDelta ChangedDelta = MakeStringStorageDelta(TEXT("Same"), TEXT("Value"));
+	ChangedDelta.Merge(MakeStringStorageDelta(TEXT("Changed"), TEXT("New")));
+	ChangedDelta.RemoveUnchangedAttrs(CurrentPartyData);
+	Coalescer->AddWrite(UserId, ChangedDelta, 0.3);
+	Coalescer->Tick(0.5);
+
+	TestEqual(TEXT("Skipped writes"), Coalescer->GetStats().NumSkippedWrites, 1);
+	TestEqual(TEXT("Writes to storage"), FakeStorage->NumWrites, 1);
+	TestEqual(TEXT("Fields in storage"), FakeStorage->Storage->Values.Num(), 1);
+	return true;
+}
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OnlineSubsystemAccelByteTestHelpers.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+namespace
+{
+
+const FString NetIdTestAccelByteId = TEXT("8e6a1b3f0c2d4e5fa6b7c8d9e0f1a2b3");
+
+/** Check that a round tripped ID matches the original */
+void TestNetIdMatches(FAutomationTestBase& Test, const FString& What, const FUniqueNetIdAccelByteUser& Expected, const TSharedPtr<const FUniqueNetIdAccelByteUser>& Actual)
+{
+	if (!Test.TestTrue(FString::Printf(TEXT("%s produced an ID"), *What), Actual.IsValid()))
+	{
+		return;
+	}
+
+	Test.TestEqual(FString::Printf(TEXT("%s string"), *What), Actual->ToString(), Expected.ToString());
+	Test.TestTrue(FString::Printf(TEXT("%s composite structure"), *What), Actual->GetCompositeStructure() == Expected.GetCompositeStructure());
+	Test.TestEqual(FString::Printf(TEXT("%s validity"), *What), Actual->IsValid(), Expected.IsValid());
+}
+
+/**
+ * Round trip an ID through FUniqueNetIdAccelByteUser::AppendBinary and FAccelByteUniqueNetIdRepl::NetSerialize, checking
+ * that both hand back an identical ID
+ */
+void TestNetIdRoundTrips(FAutomationTestBase& Test, const TSharedPtr<const FUniqueNetIdAccelByteUser>& UserIdPtr)
+{
+	if (!Test.TestTrue(TEXT("ID to round trip created"), UserIdPtr.IsValid()))
+	{
+		return;
+	}
+	const TSharedRef<const FUniqueNetIdAccelByteUser> UserId = UserIdPtr.ToSharedRef();
+
+	// Raw binary encoding, decoded twice to also check that the second decode hands back the cached instance
+	TArray<uint8> IdBytes;
+	UserId->AppendBinary(IdBytes);
+
+	int32 BytesRead = 0;
+	const TSharedPtr<const FUniqueNetIdAccelByteUser> BinaryUserId = FUniqueNetIdAccelByteUser::CreateFromBinary(IdBytes.GetData(), IdBytes.Num(), BytesRead);
+	TestNetIdMatches(Test, TEXT("Binary round trip"), UserId.Get(), BinaryUserId);
+	Test.TestEqual(TEXT("Bytes read back"), BytesRead, IdBytes.Num());
+
+	const TSharedPtr<const FUniqueNetIdAccelByteUser> CachedUserId = FUniqueNetIdAccelByteUser::CreateFromBinary(IdBytes.GetData(), IdBytes.Num(), BytesRead);
+	Test.TestTrue(TEXT("ID decoded from the same bytes reused"), CachedUserId == BinaryUserId);
+
+	// Replication through the net serializer, including the packed length prefix
+	FBitWriter Writer(0, true);
+	bool bWriteSuccess = false;
+	FAccelByteUniqueNetIdRepl(UserId).NetSerialize(Writer, nullptr, bWriteSuccess);
+
+	FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+	FAccelByteUniqueNetIdRepl ReadRepl;
+	bool bReadSuccess = false;
+	ReadRepl.NetSerialize(Reader, nullptr, bReadSuccess);
+	Test.TestTrue(TEXT("Net serialize write succeeded"), bWriteSuccess);
+	Test.TestTrue(TEXT("Net serialize read succeeded"), bReadSuccess && !Reader.IsError());
+	TestNetIdMatches(Test, TEXT("NetSerialize round trip"), UserId.Get(), ReadRepl.GetUniqueNetId());
+
+	Test.AddInfo(FString::Printf(TEXT("%d bytes as binary, %d bytes as string"), IdBytes.Num(), UserId->ToString().Len()));
+}
+
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdUUIDTest, "AccelByte.OSS.NetId.UUID", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdUUIDTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(NetIdTestAccelByteId)));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdHyphenatedUUIDTest, "AccelByte.OSS.NetId.HyphenatedUUID", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdHyphenatedUUIDTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(TEXT("8e6a1b3f-0c2d-4e5f-a6b7-c8d9e0f1a2b3"))));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdKnownPlatformTest, "AccelByte.OSS.NetId.KnownPlatform", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdKnownPlatformTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(NetIdTestAccelByteId, TEXT("STEAM"), TEXT("76561197960287930"))));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdUnknownPlatformTest, "AccelByte.OSS.NetId.UnknownPlatform", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdUnknownPlatformTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(NetIdTestAccelByteId, TEXT("SomeNewPlatform"), TEXT("platform-user-1"))));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdNonUUIDTest, "AccelByte.OSS.NetId.NonUUID", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdNonUUIDTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(TEXT("not-a-uuid"))));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdRawStringTest, "AccelByte.OSS.NetId.RawString", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdRawStringTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, MakeShared<const FUniqueNetIdAccelByteUser>(TEXT("NotBase64!")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetIdInvalidTest, "AccelByte.OSS.NetId.Invalid", ACCELBYTE_AUTOMATION_TEST_FLAGS)
+bool FNetIdInvalidTest::RunTest(const FString& Parameters)
+{
+	TestNetIdRoundTrips(*this, FUniqueNetIdAccelByteUser::Invalid());
+	return true;
+}
+
+#endif
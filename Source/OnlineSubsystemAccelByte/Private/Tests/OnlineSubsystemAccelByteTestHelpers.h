@@ -0,0 +1,49 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Flags shared by every automation test in this module, they need no world and run as part of the product tests */
+#define ACCELBYTE_AUTOMATION_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+namespace AccelByteTests
+{
+
+/**
+ * Make a user ID for a test from an index, so that the same index always gives the same ID
+ *
+ * @param Index Index of the user in the test
+ * @param PlatformType Platform type to give the ID, along with the index as its platform ID, or empty for no platform
+ * information
+ */
+inline TSharedRef<const FUniqueNetIdAccelByteUser> MakeTestUserId(int32 Index, const FString& PlatformType = TEXT(""))
+{
+	const FString PlatformId = PlatformType.IsEmpty() ? TEXT("") : FString::FromInt(Index);
+	return FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(FString::Printf(TEXT("%032x"), Index), PlatformType, PlatformId)).ToSharedRef();
+}
+
+/**
+ * Make a party interface of the test's own, so that none of the parties a test loads into it ever show up for a local
+ * player. Returns nullptr if the AccelByte subsystem is not loaded.
+ */
+inline TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> MakeTestPartyInterface()
+{
+	FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(IOnlineSubsystem::Get(ACCELBYTE_SUBSYSTEM));
+	if (Subsystem == nullptr)
+	{
+		return nullptr;
+	}
+	return MakeShared<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe>(Subsystem);
+}
+
+}
+
+#endif
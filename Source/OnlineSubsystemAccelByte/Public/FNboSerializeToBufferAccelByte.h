@@ -19,23 +19,165 @@ public:
 	{
 	}
 
-	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FOnlineSessionInfoAccelByte& SessionInfo)
+	/** Write an unsigned integer as a base 128 varint, values under 128 take a single byte */
+	void WriteVarUInt(uint64 Value)
 	{
-		check(SessionInfo.GetHostAddr().IsValid());
-		Ar << *SessionInfo.GetSessionId().ToString();
-		Ar << *SessionInfo.GetHostAddr();
-		return Ar;
+		do
+		{
+			uint8 Byte = static_cast<uint8>(Value & 0x7F);
+			Value >>= 7;
+			if (Value != 0)
+			{
+				Byte |= 0x80;
+			}
+			*this << Byte;
+		} while (Value != 0);
+	}
+
+	/** Write a signed integer as a zigzag encoded varint, so that small negative values are as compact as small positive ones */
+	void WriteVarInt(int64 Value)
+	{
+		WriteVarUInt((static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	/** Write a varint length followed by the raw bytes */
+	void WriteCompactBytes(const uint8* Bytes, int32 Length)
+	{
+		WriteVarUInt(Length);
+		for (int32 Index = 0; Index < Length; Index++)
+		{
+			*this << Bytes[Index];
+		}
+	}
+
+	/** Write a string as a varint length followed by its UTF-8 bytes, without a terminator */
+	void WriteCompactString(const FString& Value)
+	{
+		const FTCHARToUTF8 Utf8Value(*Value);
+		WriteCompactBytes(reinterpret_cast<const uint8*>(Utf8Value.Get()), Utf8Value.Length());
 	}
 
-	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FUniqueNetIdAccelByteUser& UniqueId)
+	/** Whether WriteCompactVariantData can write a variant of this type, and ReadCompactVariantData read it back */
+	static bool IsCompactVariantTypeSupported(EOnlineKeyValuePairDataType::Type Type)
 	{
-		Ar << UniqueId.UniqueNetIdStr;
+		switch (Type)
+		{
+		case EOnlineKeyValuePairDataType::Empty:
+		case EOnlineKeyValuePairDataType::Int32:
+		case EOnlineKeyValuePairDataType::UInt32:
+		case EOnlineKeyValuePairDataType::Int64:
+		case EOnlineKeyValuePairDataType::UInt64:
+		case EOnlineKeyValuePairDataType::Float:
+		case EOnlineKeyValuePairDataType::Double:
+		case EOnlineKeyValuePairDataType::Bool:
+		case EOnlineKeyValuePairDataType::String:
+		case EOnlineKeyValuePairDataType::Blob:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * Write a variant as its type followed by the value, with integers as varints and strings and blobs length prefixed.
+	 * Writes nothing and returns false for a type that IsCompactVariantTypeSupported rejects.
+	 */
+	bool WriteCompactVariantData(const FVariantData& Value)
+	{
+		if (!IsCompactVariantTypeSupported(Value.GetType()))
+		{
+			return false;
+		}
+
+		*this << static_cast<uint8>(Value.GetType());
+		switch (Value.GetType())
+		{
+		case EOnlineKeyValuePairDataType::Int32:
+		{
+			int32 IntValue = 0;
+			Value.GetValue(IntValue);
+			WriteVarInt(IntValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::UInt32:
+		{
+			uint32 UIntValue = 0;
+			Value.GetValue(UIntValue);
+			WriteVarUInt(UIntValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Int64:
+		{
+			int64 IntValue = 0;
+			Value.GetValue(IntValue);
+			WriteVarInt(IntValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::UInt64:
+		{
+			uint64 UIntValue = 0;
+			Value.GetValue(UIntValue);
+			WriteVarUInt(UIntValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Float:
+		{
+			float FloatValue = 0.0f;
+			Value.GetValue(FloatValue);
+			*this << FloatValue;
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Double:
+		{
+			double DoubleValue = 0.0;
+			Value.GetValue(DoubleValue);
+			*this << DoubleValue;
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Bool:
+		{
+			bool bBoolValue = false;
+			Value.GetValue(bBoolValue);
+			*this << static_cast<uint8>(bBoolValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::String:
+		{
+			FString StringValue;
+			Value.GetValue(StringValue);
+			WriteCompactString(StringValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Blob:
+		{
+			TArray<uint8> BlobValue;
+			Value.GetValue(BlobValue);
+			WriteCompactBytes(BlobValue.GetData(), BlobValue.Num());
+			break;
+		}
+		default:
+			break;
+		}
+		return true;
+	}
+
+	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FOnlineSessionInfoAccelByte& SessionInfo)
+	{
+		check(SessionInfo.GetHostAddr().IsValid());
+		Ar << *SessionInfo.GetSessionIdRef();
+		Ar << *SessionInfo.GetHostAddr();
 		return Ar;
 	}
 
+	/** Write a net ID in its binary encoding, see FUniqueNetIdAccelByteResource::AppendBinary */
 	friend inline FNboSerializeToBufferAccelByte& operator<<(FNboSerializeToBufferAccelByte& Ar, const FUniqueNetIdAccelByteResource& UniqueId)
 	{
-		Ar << UniqueId.UniqueNetIdStr;
+		TArray<uint8> IdBytes;
+		UniqueId.AppendBinary(IdBytes);
+		for (const uint8 Byte : IdBytes)
+		{
+			Ar << Byte;
+		}
 		return Ar;
 	}
 };
@@ -43,8 +185,150 @@ public:
 class FNboSerializeFromBufferAccelByte : public FNboSerializeFromBuffer
 {
 public:
-	FNboSerializeFromBufferAccelByte(uint8* Packet,int32 Length) : FNboSerializeFromBuffer(Packet,Length) 
+	FNboSerializeFromBufferAccelByte(const uint8* Packet,int32 Length) : FNboSerializeFromBuffer(Packet,Length) 
+	{
+	}
+
+	/** Number of bytes read from the start of the packet so far */
+	int32 GetReadOffset() const
 	{
+		return CurrentOffset;
+	}
+
+	/** Number of bytes left to read before the end of the packet */
+	int32 GetBytesRemaining() const
+	{
+		return NumBytes - CurrentOffset;
+	}
+
+	/**
+	 * Take the next Length bytes as a reader of their own and advance past them, so that a malformed block cannot be read
+	 * past its end into the fields that follow it. Flags overflow, and returns an empty reader, if there are not enough
+	 * bytes left.
+	 */
+	FNboSerializeFromBufferAccelByte ReadSubBuffer(uint64 Length)
+	{
+		if (HasOverflow() || Length > static_cast<uint64>(NumBytes - CurrentOffset))
+		{
+			bHasOverflowed = true;
+			return FNboSerializeFromBufferAccelByte(Data, 0);
+		}
+		FNboSerializeFromBufferAccelByte SubBuffer(Data + CurrentOffset, static_cast<int32>(Length));
+		CurrentOffset += static_cast<int32>(Length);
+		return SubBuffer;
+	}
+
+	/** Read a varint written by FNboSerializeToBufferAccelByte::WriteVarUInt, flagging overflow if it is malformed */
+	uint64 ReadVarUInt()
+	{
+		uint64 Value = 0;
+		for (int32 Shift = 0; Shift < 64 && !HasOverflow(); Shift += 7)
+		{
+			uint8 Byte = 0;
+			*this >> Byte;
+			Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				return Value;
+			}
+		}
+
+		bHasOverflowed = true;
+		return 0;
+	}
+
+	/** Read a zigzag encoded varint written by FNboSerializeToBufferAccelByte::WriteVarInt */
+	int64 ReadVarInt()
+	{
+		const uint64 Value = ReadVarUInt();
+		return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+	}
+
+	/** Read bytes written by FNboSerializeToBufferAccelByte::WriteCompactBytes */
+	void ReadCompactBytes(TArray<uint8>& OutBytes)
+	{
+		const uint64 Length = ReadVarUInt();
+		if (HasOverflow() || Length > static_cast<uint64>(NumBytes - CurrentOffset))
+		{
+			bHasOverflowed = true;
+			return;
+		}
+		OutBytes.Reset(static_cast<int32>(Length));
+		OutBytes.Append(Data + CurrentOffset, static_cast<int32>(Length));
+		CurrentOffset += static_cast<int32>(Length);
+	}
+
+	/** Read a string written by FNboSerializeToBufferAccelByte::WriteCompactString */
+	FString ReadCompactString()
+	{
+		const uint64 Length = ReadVarUInt();
+		if (HasOverflow() || Length > static_cast<uint64>(NumBytes - CurrentOffset))
+		{
+			bHasOverflowed = true;
+			return FString();
+		}
+		const FUTF8ToTCHAR Utf8Value(reinterpret_cast<const ANSICHAR*>(Data + CurrentOffset), static_cast<int32>(Length));
+		CurrentOffset += static_cast<int32>(Length);
+		return FString(Utf8Value.Length(), Utf8Value.Get());
+	}
+
+	/** Read a variant written by FNboSerializeToBufferAccelByte::WriteCompactVariantData, flagging overflow on an unknown type */
+	void ReadCompactVariantData(FVariantData& OutValue)
+	{
+		uint8 Type = 0;
+		*this >> Type;
+		switch (static_cast<EOnlineKeyValuePairDataType::Type>(Type))
+		{
+		case EOnlineKeyValuePairDataType::Empty:
+			OutValue.Empty();
+			break;
+		case EOnlineKeyValuePairDataType::Int32:
+			OutValue.SetValue(static_cast<int32>(ReadVarInt()));
+			break;
+		case EOnlineKeyValuePairDataType::UInt32:
+			OutValue.SetValue(static_cast<uint32>(ReadVarUInt()));
+			break;
+		case EOnlineKeyValuePairDataType::Int64:
+			OutValue.SetValue(ReadVarInt());
+			break;
+		case EOnlineKeyValuePairDataType::UInt64:
+			OutValue.SetValue(ReadVarUInt());
+			break;
+		case EOnlineKeyValuePairDataType::Float:
+		{
+			float FloatValue = 0.0f;
+			*this >> FloatValue;
+			OutValue.SetValue(FloatValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Double:
+		{
+			double DoubleValue = 0.0;
+			*this >> DoubleValue;
+			OutValue.SetValue(DoubleValue);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::Bool:
+		{
+			uint8 BoolValue = 0;
+			*this >> BoolValue;
+			OutValue.SetValue(BoolValue != 0);
+			break;
+		}
+		case EOnlineKeyValuePairDataType::String:
+			OutValue.SetValue(ReadCompactString());
+			break;
+		case EOnlineKeyValuePairDataType::Blob:
+		{
+			TArray<uint8> BlobValue;
+			ReadCompactBytes(BlobValue);
+			OutValue.SetValue(BlobValue);
+			break;
+		}
+		default:
+			bHasOverflowed = true;
+			break;
+		}
 	}
 	
 	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FOnlineSessionInfoAccelByte& SessionInfo)
@@ -55,15 +339,16 @@ public:
 		return Ar;
 	}
 	
-	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteUser& UniqueId)
-	{
-		Ar >> UniqueId.UniqueNetIdStr;
-		return Ar;
-	}
-
+	/** Read a net ID from its binary encoding, flagging overflow if it is truncated or malformed */
 	friend inline FNboSerializeFromBufferAccelByte& operator>>(FNboSerializeFromBufferAccelByte& Ar, FUniqueNetIdAccelByteResource& UniqueId)
 	{
-		Ar >> UniqueId.UniqueNetIdStr;
+		int32 BytesRead = 0;
+		if (Ar.HasOverflow() || !UniqueId.ReadBinary(Ar.Data + Ar.CurrentOffset, Ar.NumBytes - Ar.CurrentOffset, BytesRead))
+		{
+			Ar.bHasOverflowed = true;
+			return Ar;
+		}
+		Ar.CurrentOffset += BytesRead;
 		return Ar;
 	}
 };
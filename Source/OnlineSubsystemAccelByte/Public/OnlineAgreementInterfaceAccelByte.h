@@ -26,6 +26,12 @@ struct ONLINESUBSYSTEMACCELBYTE_API FABLocalizedPolicyContent
 {
 	FString Content{};
 	FString LocaleCode{};
+
+	/**
+	 * Attachment location of the localized policy version this content was downloaded from. Every published version
+	 * gets its own attachment, so this is used to tell whether cached content is still the version in effect.
+	 */
+	FString VersionKey{};
 };
 
 struct ONLINESUBSYSTEMACCELBYTE_API FABAcceptAgreementPoliciesRequest
@@ -42,14 +48,44 @@ class ONLINESUBSYSTEMACCELBYTE_API FOnlineAgreementAccelByte : public TSharedFro
 PACKAGE_SCOPE:
 
 	/** Constructor that is invoked by the Subsystem instance to create a user cloud instance */
-	FOnlineAgreementAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
-		: AccelByteSubsystem(InSubsystem)
-	{};
+	FOnlineAgreementAccelByte(FOnlineSubsystemAccelByte* InSubsystem);
 
 	/*Map of Eligibilities of each user*/
 	TUniqueNetIdMap<TArray<TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>>> EligibilitiesMap;
 
 	TMap<FString, TArray<FABLocalizedPolicyContent>> LocalizedContentMap;
+	/** Critical sections for thread safe operation of LocalizedContentMap and PendingRevalidationContents */
+	mutable FCriticalSection LocalizedContentLock;
+
+	/**
+	 * Policy and locale pairs that were served from the disk cache before their version could be checked against the
+	 * user's eligibilities. These are revalidated once the eligibilities have been queried.
+	 */
+	TSet<TPair<FString, FString>> PendingRevalidationContents;
+
+	/** Directory that localized policy content is persisted to between sessions */
+	FString GetPolicyContentCacheDir() const;
+
+	/** Load every localized policy content persisted by previous sessions into LocalizedContentMap */
+	void LoadPolicyContentCacheFromDisk();
+
+	/** Add or replace a localized policy content in the cache, persisting it to disk if enabled */
+	void AddLocalizedPolicyContentToCache(const FString& BasePolicyId, const FString& LocaleCode, const FString& VersionKey, const FString& Content);
+
+	/** Mark cached content as served without a version check, so that it is revalidated after the next eligibility query */
+	void MarkLocalizedPolicyContentForRevalidation(const FString& BasePolicyId, const FString& LocaleCode);
+
+	/**
+	 * Compare content served from the disk cache against the versions in effect for the user, and re-download any
+	 * content that has been superseded. Fires OnGetLocalizedPolicyContentCompleted again for content that changed.
+	 */
+	void RevalidateLocalizedPolicyContent(int32 LocalUserNum);
+
+	/**
+	 * Find the location of the localized document in effect for a policy in a set of eligibilities, falling back to the
+	 * default locale of the policy if the requested locale is not available.
+	 */
+	static bool FindLocalizedPolicyAttachment(const TArray<TSharedRef<FAccelByteModelsRetrieveUserEligibilitiesResponse>>& Eligibilities, const FString& BasePolicyId, const FString& LocaleCode, FString& OutBaseUrl, FString& OutAttachmentLocation);
 
 public:
 	virtual ~FOnlineAgreementAccelByte() {};
@@ -82,6 +118,7 @@ public:
 
 	/*Get the stored localized policy content*/
 	bool GetLocalizedPolicyContentFromCache(const FString& BasePolicyId, const FString& LocaleCode, FString& OutLocalizedPolicyContent);
+	bool GetLocalizedPolicyContentFromCache(const FString& BasePolicyId, const FString& LocaleCode, FString& OutLocalizedPolicyContent, FString& OutVersionKey);
 
 	bool AcceptAgreementPolicies(int32 LocalUserNum, const TArray<FABAcceptAgreementPoliciesRequest>& DocumentsToAccept);
 
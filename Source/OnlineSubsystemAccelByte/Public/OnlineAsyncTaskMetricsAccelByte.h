@@ -0,0 +1,103 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+DECLARE_STATS_GROUP(TEXT("AccelByteOSS"), STATGROUP_AccelByteOSS, STATCAT_Advanced);
+
+/** Insights channel for the begin and end events of every async task, enable with -trace=AccelByteAsyncTaskChannel */
+UE_TRACE_CHANNEL_EXTERN(AccelByteAsyncTaskChannel, ONLINESUBSYSTEMACCELBYTE_API);
+
+/**
+ * Latency histogram with logarithmically spaced buckets, two buckets per power of two milliseconds. Percentiles are
+ * reported as the upper bound of the bucket that they fall in, which is accurate to within ~41%, plenty to tell which
+ * backend calls dominate a flow without having to keep every sample around.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteLatencyHistogram
+{
+	/** Buckets cover 1ms up to ~46s, anything slower lands in the last bucket */
+	static constexpr int32 NumBuckets = 32;
+
+	void AddSample(double Seconds);
+
+	/** Get the approximate latency in seconds that the given fraction of samples (0-1) completed within */
+	double GetPercentile(double Percentile) const;
+
+	/** Upper bound in seconds of a bucket */
+	static double GetBucketUpperBoundSeconds(int32 BucketIndex);
+
+	uint32 Buckets[NumBuckets] = {};
+	uint32 SampleCount = 0;
+};
+
+/**
+ * Aggregated metrics for every task of a single type
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteAsyncTaskMetrics
+{
+	uint32 CompletedCount = 0;
+	uint32 SuccessCount = 0;
+	uint32 TimedOutCount = 0;
+	uint32 FailedCount = 0;
+
+	/** Sum of time spent between a task being created and it being initialized by the task manager */
+	double TotalQueueWaitSeconds = 0.0;
+
+	/** Sum of time spent between a task starting work and it completing */
+	double TotalWorkingSeconds = 0.0;
+
+	/** Time from a task being created to it completing */
+	FAccelByteLatencyHistogram LatencyHistogram;
+};
+
+/**
+ * Registry of metrics for every type of async task run by the OSS. Tasks report into this when they complete, and the
+ * totals are surfaced through the AccelByteOSS stat group, Insights counters and the TASKMETRICS exec command.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineAsyncTaskMetricsAccelByte
+{
+public:
+
+	/**
+	 * Called when a task has been picked up by the task manager. Returns the ID the task is given in trace events, which
+	 * is never zero.
+	 */
+	uint32 RecordTaskStarted(const FString& TaskName);
+
+	/**
+	 * Called when a task completes, with its complete state as one of EAccelByteAsyncTaskCompleteState. Safe to call
+	 * from any thread.
+	 */
+	void RecordTaskCompleted(const FString& TaskName, uint32 TaskTraceId, uint8 CompleteState, double QueueWaitSeconds, double WorkingSeconds, double TotalSeconds);
+
+	/**
+	 * Called when a task that was reported as started is destroyed, whether or not it completed. Releases the task from
+	 * the in flight count, and ends its trace event if it never completed.
+	 */
+	void RecordTaskReleased(uint32 TaskTraceId, bool bWasCompleted);
+
+	/** Get a copy of the metrics collected for every task type */
+	TMap<FString, FAccelByteAsyncTaskMetrics> GetMetricsSnapshot() const;
+
+	/** Write a table of the metrics for every task type, slowest p95 first */
+	void DumpMetrics(FOutputDevice& Ar) const;
+
+	/** Clear all metrics collected so far */
+	void ResetMetrics();
+
+private:
+
+	/** Metrics for each task type, keyed by task name */
+	TMap<FString, FAccelByteAsyncTaskMetrics> TaskNameToMetricsMap;
+
+	/** Source of the IDs handed to tasks for their trace events */
+	FThreadSafeCounter LastTaskTraceId;
+
+	/** Critical section for thread safe operation of TaskNameToMetricsMap */
+	mutable FCriticalSection MetricsLock;
+
+};
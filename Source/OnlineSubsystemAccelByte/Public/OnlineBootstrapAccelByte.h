@@ -0,0 +1,202 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemTypes.h"
+#include "OnlineDelegateMacros.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "OnlineError.h"
+#include "Models/AccelByteAgreementModels.h"
+#include "Models/AccelByteEcommerceModels.h"
+
+/**
+ * Individual pieces of work that make up the post login bootstrap. Stages that do not depend on each other are run
+ * concurrently, see FOnlineBootstrapAccelByte for the dependencies between them.
+ */
+enum class EAccelByteBootstrapStage : uint8
+{
+	ConnectLobby,
+	ReadFriendsList,
+	QueryBlockedPlayers,
+	QueryEntitlements,
+	QueryWallet,
+	QueryEligibilities,
+	RestoreParties,
+	QueryPresence,
+	Count
+};
+
+/** Convert a bootstrap stage to a string for logging */
+ONLINESUBSYSTEMACCELBYTE_API const TCHAR* LexToString(EAccelByteBootstrapStage Stage);
+
+/**
+ * Outcome of a single stage of the post login bootstrap
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteBootstrapStageResult
+{
+	EAccelByteBootstrapStage Stage = EAccelByteBootstrapStage::Count;
+
+	bool bWasSuccessful = false;
+
+	/** Set if the stage never started because one of the stages it depends on failed */
+	bool bWasSkipped = false;
+
+	/** Time in seconds from the stage being started to it completing, zero if the stage was skipped */
+	double DurationSeconds = 0.0;
+
+	/** Time in seconds from the bootstrap starting to this stage being started */
+	double StartOffsetSeconds = 0.0;
+
+	FString ErrorStr;
+};
+
+/**
+ * Outcome of the whole post login bootstrap for a user
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteBootstrapResult
+{
+	TArray<FAccelByteBootstrapStageResult> StageResults;
+
+	/** Wall clock time in seconds from the bootstrap starting to its last stage completing */
+	double TotalSeconds = 0.0;
+};
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnPostLoginBootstrapComplete, int32 /*LocalUserNum*/, bool /*bWasSuccessful*/, const FAccelByteBootstrapResult& /*Result*/);
+typedef FOnPostLoginBootstrapComplete::FDelegate FOnPostLoginBootstrapCompleteDelegate;
+
+/**
+ * Delegate fired once for the single bootstrap run it was passed in with, unlike the per player delegate which fires
+ * for every run of that player.
+ */
+DECLARE_DELEGATE_TwoParams(FOnPostLoginBootstrapRunComplete, bool /*bWasSuccessful*/, const FAccelByteBootstrapResult& /*Result*/);
+
+/**
+ * Runs the requests that a game usually makes right after a user logs in as a dependency graph, rather than as a chain
+ * of separate interface calls. Anything that does not need the lobby connection is started right away, and the lobby
+ * dependent stages are started as soon as the lobby is connected. A stage that gets no response within
+ * `BootstrapStageTimeoutSeconds` is failed, and a running bootstrap is cancelled when its user logs out.
+ *
+ * ConnectLobby
+ *  -> ReadFriendsList, QueryBlockedPlayers, RestoreParties, QueryPresence
+ * QueryEntitlements, QueryWallet, QueryEligibilities
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineBootstrapAccelByte : public TSharedFromThis<FOnlineBootstrapAccelByte, ESPMode::ThreadSafe>
+{
+PACKAGE_SCOPE:
+
+	/** Constructor that is invoked by the Subsystem instance to create a bootstrap instance */
+	FOnlineBootstrapAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
+		: AccelByteSubsystem(InSubsystem)
+	{};
+
+	/** Progress of a single stage within a running bootstrap */
+	struct FStageState
+	{
+		FAccelByteBootstrapStageResult Result;
+
+		bool bIsRequested = false;
+		bool bIsStarted = false;
+		bool bIsComplete = false;
+
+		/** Handle for the completion delegate this stage has registered on the interface it calls, if any */
+		FDelegateHandle CompleteDelegateHandle;
+	};
+
+	/** State of a bootstrap in progress for a single local user */
+	struct FBootstrapRun
+	{
+		/** Unique to this run, stage completions carry it so that a late completion for an earlier run is ignored */
+		uint32 RunId = 0;
+		int32 LocalUserNum = INVALID_CONTROLLERID;
+		TSharedPtr<const FUniqueNetIdAccelByteUser> UserId;
+		double StartTimeSeconds = 0.0;
+		FStageState Stages[static_cast<uint8>(EAccelByteBootstrapStage::Count)];
+
+		/** Completion delegate of the caller that started this run */
+		FOnPostLoginBootstrapRunComplete Delegate;
+	};
+
+	/** Bootstraps in progress, keyed by local user index */
+	TMap<int32, TSharedRef<FBootstrapRun>> RunningBootstraps;
+
+	/** ID handed to the next bootstrap run */
+	uint32 NextRunId = 1;
+
+	/** Fail every stage that has been waiting on its request for longer than the stage timeout */
+	void Tick(double CurrentTimeSeconds);
+
+	/** Stop the bootstrap running for a user, such as when they log out, failing it for the caller that started it */
+	void CancelPostLoginBootstrap(int32 LocalUserNum);
+
+	/** Remove the completion delegate a stage registered on the interface it calls, if any */
+	void ClearStageDelegate(int32 LocalUserNum, EAccelByteBootstrapStage Stage, FStageState& State);
+
+	/** Stages that must have completed successfully before a stage may start */
+	static const TArray<EAccelByteBootstrapStage>& GetStageDependencies(EAccelByteBootstrapStage Stage);
+
+	/** Start every requested stage whose dependencies are done, skipping those whose dependencies failed */
+	void StartReadyStages(int32 LocalUserNum);
+
+	/** Kick off the request for a single stage, completion is reported back through CompleteStage */
+	void StartStage(FBootstrapRun& Run, EAccelByteBootstrapStage Stage);
+
+	/** Record the outcome of a stage, then either start the stages waiting on it or finish the bootstrap */
+	void CompleteStage(int32 LocalUserNum, uint32 RunId, EAccelByteBootstrapStage Stage, bool bWasSuccessful, const FString& ErrorStr);
+
+	/** Fire the completion delegates once every requested stage is complete */
+	void FinishBootstrapIfComplete(int32 LocalUserNum);
+
+	/** Find the stage of a running bootstrap that is still waiting on completion, if that run is still the one running */
+	FStageState* FindPendingStage(int32 LocalUserNum, uint32 RunId, EAccelByteBootstrapStage Stage);
+
+	void OnConnectLobbyComplete(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error, uint32 RunId);
+	void OnReadFriendsListComplete(int32 LocalUserNum, bool bWasSuccessful, const FString& ListName, const FString& ErrorStr, uint32 RunId);
+	void OnQueryBlockedPlayersComplete(const FUniqueNetId& UserId, bool bWasSuccessful, const FString& Error, int32 LocalUserNum, uint32 RunId);
+	void OnQueryEntitlementsComplete(bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Namespace, const FString& Error, int32 LocalUserNum, uint32 RunId);
+	void OnGetCurrencyListComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FAccelByteModelsCurrencyList>& Response, const FString& Error, uint32 RunId);
+	void OnGetWalletInfosComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FAccelByteModelsWalletInfo>& Response, const FString& Error, uint32 RunId);
+	void OnQueryEligibilitiesComplete(int32 LocalUserNum, bool bWasSuccessful, const TArray<FAccelByteModelsRetrieveUserEligibilitiesResponse>& Response, const FString& Error, uint32 RunId);
+	void OnRestorePartiesComplete(const FUniqueNetId& LocalUserId, const FOnlineError& Result, int32 LocalUserNum, uint32 RunId);
+	void OnQueryPresenceComplete(const FUniqueNetId& UserId, const bool bWasSuccessful, int32 LocalUserNum, uint32 RunId);
+
+public:
+	virtual ~FOnlineBootstrapAccelByte() {};
+
+	/**
+	 * Delegate fired once every requested stage of a bootstrap has completed or been skipped. bWasSuccessful is only
+	 * true if every stage succeeded, the result holds the outcome and timing of each stage.
+	 */
+	DEFINE_ONLINE_PLAYER_DELEGATE_TWO_PARAM(MAX_LOCAL_PLAYERS, OnPostLoginBootstrapComplete, bool /*bWasSuccessful*/, const FAccelByteBootstrapResult& /*Result*/);
+
+	/**
+	 * Run every bootstrap stage for a logged in user.
+	 */
+	bool StartPostLoginBootstrap(int32 LocalUserNum);
+
+	/**
+	 * Run the given bootstrap stages for a logged in user. Stages that a requested stage depends on are run as well.
+	 */
+	bool StartPostLoginBootstrap(int32 LocalUserNum, const TArray<EAccelByteBootstrapStage>& Stages);
+
+	/**
+	 * Run the given bootstrap stages for a logged in user, firing the delegate given once this run completes. The
+	 * delegate is only fired for this run, and is fired with a failure if the run is cancelled by the user logging out.
+	 */
+	bool StartPostLoginBootstrap(int32 LocalUserNum, const TArray<EAccelByteBootstrapStage>& Stages, const FOnPostLoginBootstrapRunComplete& Delegate);
+
+	/** Whether a bootstrap is currently running for the user */
+	bool IsBootstrapInProgress(int32 LocalUserNum) const;
+
+protected:
+	/** Hidden default constructor, the constructor that takes in a subsystem instance should be used instead. */
+	FOnlineBootstrapAccelByte()
+		: AccelByteSubsystem(nullptr)
+	{}
+
+	/** Instance of the subsystem that created this interface */
+	FOnlineSubsystemAccelByte* AccelByteSubsystem = nullptr;
+
+};
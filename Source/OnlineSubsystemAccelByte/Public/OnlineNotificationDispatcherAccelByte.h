@@ -0,0 +1,214 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+
+/** Function run on the game thread to act on a single Lobby notification */
+typedef TFunction<void()> FAccelByteNotificationHandler;
+
+/** Function run on a background thread to decode a Lobby notification before its handler runs */
+typedef TFunction<void()> FAccelByteNotificationDecoder;
+
+/**
+ * Counters for a single category of Lobby notification, such as party joins or party data changes
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteNotificationCategoryStats
+{
+	/** Number of notifications added to the queue */
+	uint32 QueuedCount = 0;
+
+	/** Number of notifications that were dropped as a newer one for the same entity was queued behind them */
+	uint32 CoalescedCount = 0;
+
+	/** Number of notifications whose handler was run */
+	uint32 DispatchedCount = 0;
+
+	/** Total time spent running handlers */
+	double TotalHandlerSeconds = 0.0;
+
+	/** Longest time spent running a single handler */
+	double MaxHandlerSeconds = 0.0;
+};
+
+/**
+ * Counters for the notification queue as a whole, covering every frame it has been ticked for
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteNotificationDispatchStats
+{
+	/** Number of notifications waiting in the queue */
+	int32 QueueDepth = 0;
+
+	/** Most notifications that have been waiting in the queue at once */
+	int32 PeakQueueDepth = 0;
+
+	/** Number of notifications whose handler was run on the last frame */
+	int32 LastFrameDispatchedCount = 0;
+
+	/** Time spent running handlers on the last frame */
+	double LastFrameSeconds = 0.0;
+
+	/** Longest time spent running handlers on a single frame */
+	double MaxFrameSeconds = 0.0;
+
+	/** Number of frames that ran out of budget with notifications still ready to be handled */
+	uint32 FramesOverBudgetCount = 0;
+};
+
+/**
+ * Central queue that every Lobby notification handler of the OSS goes through. Notifications are queued as they come
+ * in, and their handlers are run from the subsystem tick on the game thread, a bounded number of them per frame, so that
+ * a burst of notifications is spread over several frames rather than landing on one.
+ *
+ * Notifications that carry the full state of an entity, such as party data changes, can be queued with a coalescing
+ * key. A newer notification with the same key replaces any that are still waiting, so only the latest state is
+ * handled. Notifications can also come with a decoder that is run on a background thread as soon as they are queued,
+ * for work that only touches the notification itself, such as parsing party storage.
+ *
+ * Handlers are always run in the order their notifications were queued, a notification waiting on its decoder holds
+ * back the ones behind it. Notifications are queued for a local user, and those still waiting when the user logs out are
+ * dropped through PurgeUser.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineNotificationDispatcherAccelByte : public TSharedFromThis<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe>
+{
+public:
+
+	/**
+	 * Queue a notification to have its handler run from Tick. Safe to call from any thread.
+	 *
+	 * @param Category Category of the notification, used to break down the stats
+	 * @param LocalUserNum Index of the local user the notification was received for
+	 * @param CoalesceKey Key of the entity the notification carries the full state of, or empty if it must never be dropped
+	 * @param Handler Function to run on the game thread to act on the notification
+	 * @param Decoder Optional function to run on a background thread before the handler. It must only touch data owned by
+	 * the decoder itself, never data shared with the SDK or the game thread.
+	 */
+	void Enqueue(const FName& Category, int32 LocalUserNum, const FString& CoalesceKey, FAccelByteNotificationHandler&& Handler, FAccelByteNotificationDecoder&& Decoder = FAccelByteNotificationDecoder());
+
+	/**
+	 * Wrap a Lobby notification delegate so that notifications are queued rather than handled straight away.
+	 *
+	 * @param Category Category of the notification, used to break down the stats
+	 * @param LocalUserNum Index of the local user the delegate is registered for
+	 * @param Handler Delegate to execute on the game thread for each notification
+	 * @param GetCoalesceKey Optional function to get the coalescing key for a notification
+	 */
+	template<typename TNotification>
+	TDelegate<void(const TNotification&)> Wrap(const FName& Category, int32 LocalUserNum, const TDelegate<void(const TNotification&)>& Handler, TFunction<FString(const TNotification&)> GetCoalesceKey = TFunction<FString(const TNotification&)>())
+	{
+		const TWeakPtr<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe> WeakDispatcher = AsShared();
+		return TDelegate<void(const TNotification&)>::CreateLambda([WeakDispatcher, Category, LocalUserNum, Handler, GetCoalesceKey](const TNotification& Notification) {
+			const TSharedPtr<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe> Dispatcher = WeakDispatcher.Pin();
+			if (!Dispatcher.IsValid())
+			{
+				return;
+			}
+
+			const FString CoalesceKey = GetCoalesceKey ? GetCoalesceKey(Notification) : FString();
+			Dispatcher->Enqueue(Category, LocalUserNum, CoalesceKey, [Handler, Notification]() {
+				Handler.ExecuteIfBound(Notification);
+			});
+		});
+	}
+
+	/**
+	 * Wrap a Lobby notification delegate to go through the given notification queue, or hand it back as it is if there is
+	 * no queue, so that notifications are handled straight away.
+	 *
+	 * @param Dispatcher Notification queue to go through, may be null
+	 * @param Category Category of the notification, used to break down the stats
+	 * @param LocalUserNum Index of the local user the delegate is registered for
+	 * @param Handler Delegate to execute on the game thread for each notification
+	 */
+	template<typename TNotification>
+	static TDelegate<void(const TNotification&)> WrapIfValid(const TSharedPtr<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe>& Dispatcher, const FName& Category, int32 LocalUserNum, const TDelegate<void(const TNotification&)>& Handler)
+	{
+		return Dispatcher.IsValid() ? Dispatcher->Wrap(Category, LocalUserNum, Handler) : Handler;
+	}
+
+	/**
+	 * Run queued handlers in order until the queue is empty, the next notification is still being decoded, or the frame
+	 * budget is spent. At least one handler is run per frame, however long it takes.
+	 *
+	 * @param MaxNotificationsPerFrame Most handlers to run this frame
+	 * @param MaxSecondsPerFrame Time in seconds after which no more handlers are started this frame
+	 */
+	void Tick(int32 MaxNotificationsPerFrame, double MaxSecondsPerFrame);
+
+	/** Drop every queued notification without running its handler */
+	void Reset();
+
+	/** Drop every queued notification of a local user without running its handler, called when the user logs out */
+	void PurgeUser(int32 LocalUserNum);
+
+	/** Get the number of notifications waiting in the queue */
+	int32 GetQueueDepth() const;
+
+	/** Get a copy of the counters for the queue as a whole */
+	FAccelByteNotificationDispatchStats GetStats() const;
+
+	/** Get a copy of the counters for every category of notification */
+	TMap<FName, FAccelByteNotificationCategoryStats> GetCategoryStats() const;
+
+	/** Write the queue counters and a table of the counters for each category, most time spent first */
+	void DumpStats(FOutputDevice& Ar) const;
+
+	/** Clear all counters collected so far, leaving the queue as it is */
+	void ResetStats();
+
+private:
+
+	/** A single notification waiting in the queue */
+	struct FQueuedNotification
+	{
+		/** Category of the notification */
+		FName Category;
+
+		/** Index of the local user the notification was received for */
+		int32 LocalUserNum = INDEX_NONE;
+
+		/** Key of the entity the notification carries the full state of, or empty */
+		FString CoalesceKey;
+
+		/** Function to run on the game thread to act on the notification */
+		FAccelByteNotificationHandler Handler;
+
+		/**
+		 * Whether the decoder has finished, or there was no decoder to run. Shared with the decoding task, so that the task
+		 * never holds on to the handler and ends up releasing what it captured off the game thread.
+		 */
+		TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> IsDecoded = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(true);
+
+		/** Whether a newer notification with the same key has been queued, so this one is dropped rather than handled */
+		FThreadSafeBool bIsCoalesced = false;
+
+		/** Whether the user the notification was received for logged out, so this one is dropped rather than handled */
+		FThreadSafeBool bIsPurged = false;
+	};
+
+	typedef TSharedRef<FQueuedNotification, ESPMode::ThreadSafe> FQueuedNotificationRef;
+
+	/** Notifications waiting to be handled, oldest first */
+	TArray<FQueuedNotificationRef> Queue;
+
+	/** Map of coalescing keys to the newest notification queued with that key */
+	TMap<FString, FQueuedNotificationRef> CoalescedNotifications;
+
+	/**
+	 * Number of times the queue has been reset, so that Tick can tell a handler emptied the queue under it rather than
+	 * removing notifications queued after the reset as if it had consumed them
+	 */
+	uint64 ResetGeneration = 0;
+
+	/** Counters for the queue as a whole */
+	FAccelByteNotificationDispatchStats Stats;
+
+	/** Counters for each category of notification */
+	TMap<FName, FAccelByteNotificationCategoryStats> CategoryStats;
+
+	/** Critical section guarding the queue, the coalescing map, the reset generation and every counter */
+	mutable FCriticalSection QueueLock;
+
+};
@@ -9,6 +9,9 @@
 #include "Interfaces/OnlinePartyInterface.h"
 #include "Models/AccelByteLobbyModels.h"
 #include "OnlineUserCacheAccelByte.h"
+#include "OnlinePartyStorageWriteCoalescerAccelByte.h"
+#include "OnlinePartySnapshotAccelByte.h"
+#include "OnlinePartyInviteStoreAccelByte.h"
 
 // #NOTE (Voltaire) Define flags/markers for party notifications so that party members can process payload accordingly 
 #define PARTYNOTIF_CUSTOMIZATION_CHANGED TEXT("Customization Changed")
@@ -41,11 +44,20 @@ public:
 	virtual FString ToDebugString() const override;
 	//~ End FOnlinePartyId overrides
 
+	/** Get the hash of this party ID, computed once when the ID is created */
+	uint32 GetIdHash() const;
+
+	/** Check whether this is the same party ID as another, without copying either ID string */
+	bool IsSameId(const FOnlinePartyIdAccelByte& Other) const;
+
 private:
 
 	/** Party ID as an FString, should be a valid UUID v4 without the hyphens */
 	FString IdStr;
 
+	/** Case sensitive hash of IdStr, cached as party IDs never change and are hashed on every party map lookup */
+	uint32 IdHash = 0;
+
 };
 
 /**
@@ -61,12 +73,12 @@ struct ONLINESUBSYSTEMACCELBYTE_API TPartyIdConstSharedRefMapKeyFuncs : public T
 
 	static uint32 GetKeyHash(const TSharedRef<const FOnlinePartyIdAccelByte>& Key)
 	{
-		return GetTypeHash(Key.Get());
+		return Key->GetIdHash();
 	}
 
 	static bool Matches(const TSharedRef<const FOnlinePartyIdAccelByte>& A, const TSharedRef<const FOnlinePartyIdAccelByte>& B)
 	{
-		return (A == B) || (A.Get() == B.Get());
+		return (A == B) || A->IsSameId(B.Get());
 	}
 };
 
@@ -101,6 +113,40 @@ private:
 /** TPair for an invited user, with the first element being the user that invited them, and the second element being the invited user */
 using FInvitedPlayerPair = TPair<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<const FUniqueNetIdAccelByteUser>>;
 
+/**
+ * Typed copy of a single member's entry in the crossplay platform map stored in party data
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartyMemberCrossplayPreference
+{
+	/** Simplified native platform name of the member, empty if their entry did not have one */
+	FString Platform;
+
+	/** Whether the member wants to play crossplay, false if their entry did not have a valid preference */
+	bool bCrossplayEnabled = false;
+
+	bool operator==(const FAccelBytePartyMemberCrossplayPreference& Other) const
+	{
+		return bCrossplayEnabled == Other.bCrossplayEnabled && Platform == Other.Platform;
+	}
+};
+
+/**
+ * Immutable snapshot of the members of a party and the players with pending invites to it. A party hands out the same
+ * snapshot until its members or invites change, so it can be fetched every frame without copying anything, and the
+ * version can be compared against an earlier snapshot to tell whether anything changed.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartyRoster
+{
+	/** Roster version of the party when this snapshot was taken */
+	uint32 Version = 0;
+
+	/** Members of the party */
+	TArray<FOnlinePartyMemberConstRef> Members;
+
+	/** IDs of players with a pending invite to the party */
+	TArray<TSharedRef<const FUniqueNetId>> PendingInvitedUsers;
+};
+
 /** Map of user IDs to party member instances */
 using FUserIdToPartyMemberMap = TMap<TSharedRef<const FUniqueNetIdAccelByteUser>, TSharedRef<FOnlinePartyMemberAccelByte>, FDefaultSetAllocator, TUserUniqueIdConstSharedRefMapKeyFuncs<TSharedRef<FOnlinePartyMemberAccelByte>>>;
 
@@ -129,6 +175,28 @@ public:
 	 */
 	const uint32 GetMemberCount() const;
 
+	/**
+	 * Get a snapshot of the members and pending invites of this party. The snapshot is built on the first call after
+	 * members or invites change, and every call until the next change returns that same snapshot.
+	 */
+	TSharedRef<const FAccelBytePartyRoster> GetRoster() const;
+
+	/**
+	 * Get the version of the members and pending invites of this party, which changes every time either of them changes.
+	 */
+	uint32 GetRosterVersion() const;
+
+	/**
+	 * Get the version of the party data of this party, which changes every time the party data is set or changed.
+	 */
+	uint32 GetPartyDataVersion() const;
+
+	/**
+	 * Call a function for each member of this party without copying or holding on to any of them. The function returns
+	 * false to stop early. It must not add or remove members of this party.
+	 */
+	void ForEachMember(TFunctionRef<bool(const FOnlinePartyMemberAccelByte&)> Visitor) const;
+
 	/**
 	 * #SG Adds the specified user's crossplay preference and platform to the party's storage.
 	 */
@@ -140,7 +208,8 @@ public:
 	void RemovePlayerCrossplayPreferenceAndPlatform(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& UserToRemove);
 
 	/**
-	 * #TICKETID Adds the specified Leader TicketID to the party's storage.
+	 * #TICKETID Adds the specified Leader TicketID to the party's storage. Ticket IDs are not kept as a party attribute
+	 * yet, so this is counted as a skipped write rather than writing unchanged party data.
 	 */
 	void AddPlayerAcceptedTicketId(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const FString& TicketId, const FString& MatchId);
 
@@ -172,16 +241,19 @@ PACKAGE_SCOPE:
 	/** Method internally for interface and other tasks to get a member of this party by their ID */
 	TSharedPtr<const FOnlinePartyMemberAccelByte> GetMember(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId) const;
 
+	/** Get a member of this party by their AccelByte ID, for notifications that only carry the plain ID */
+	TSharedPtr<const FOnlinePartyMemberAccelByte> GetMember(const FString& AccelByteId) const;
+
 	/** Internal method to remove a party member from a party, usually used in notifications or on kick */
 	bool RemoveMember(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& RemovedUserId, const EMemberExitedReason& ExitReason);
 
 	/** Internal method to remove a party invite by the invited user ID */
 	void RemoveInvite(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FUniqueNetIdAccelByteUser>& InvitedUserId, const EPartyInvitationRemovedReason& PartyInviteRemoveReason);
 
-	/** Internal method for getting an array of all current party members */
+	/** Internal method for getting an array of all current party members, prefer GetRoster to avoid the copy */
 	TArray<FOnlinePartyMemberConstRef> GetAllMembers() const;
 
-	/** Internal method for getting an array of user IDs for all players with currently pending invites */
+	/** Internal method for getting an array of user IDs for all players with currently pending invites, prefer GetRoster to avoid the copy */
 	TArray<TSharedRef<const FUniqueNetId>> GetAllPendingInvitedUsers() const;
 
 	/** Internal method for getting a reference to our party data */
@@ -190,6 +262,13 @@ PACKAGE_SCOPE:
 	/** Internal method to update party data */
 	void SetPartyData(TSharedRef<FOnlinePartyData> PartyData);
 
+	/**
+	 * Internal method to apply a set of attribute changes to our party data. The party data instance is changed in place
+	 * if nothing else holds on to it, otherwise it is copied first so that anyone holding it keeps an unchanged instance.
+	 * The crossplay preference table is only rebuilt if the crossplay platform map is one of the changed attributes.
+	 */
+	void ApplyPartyDataDelta(const FAccelBytePartyStorageDelta& Delta);
+
 	/** Internal method to set party code associated with this party instance */
 	void SetPartyCode(const FString& PartyCode);
 
@@ -197,17 +276,31 @@ PACKAGE_SCOPE:
 	 * Check whether this party is a crossplay enabled party or not. This will check the preferences of all members to see
 	 * if their crossplay flag is enabled.
 	 *
+	 * Answered from the typed crossplay preference table, so this does not parse party data.
+	 *
 	 * @return true if all members have crossplay enabled, false otherwise
 	 */
-	bool IsCrossplayParty();
+	bool IsCrossplayParty() const;
 
 	/**
 	 * Gets an array of the unique platforms that each party member is on
 	 */
-	TArray<FString> GetUniquePlatformsForParty();
+	TArray<FString> GetUniquePlatformsForParty() const;
 
 private:
 
+	/** Rebuild the typed crossplay preference table from the crossplay platform map in our current party data */
+	void RebuildCrossplayPreferences();
+
+	/** Add or replace a member's entry in the typed crossplay preference table, keeping the aggregate counts in step */
+	void SetMemberCrossplayPreference(const FString& AccelByteId, const FAccelBytePartyMemberCrossplayPreference& Preference);
+
+	/** Remove a member's entry from the typed crossplay preference table, keeping the aggregate counts in step */
+	void RemoveMemberCrossplayPreference(const FString& AccelByteId);
+
+	/** Bump the roster version and drop the cached roster, called whenever members or pending invites change */
+	void InvalidateRoster();
+
 	/** Interface that owns this party instance, used to fire delegates on member changes */
 	TSharedRef<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> OwningInterface;
 
@@ -223,9 +316,30 @@ private:
 	/** Array of user IDs representing players that we have invited to this party */
 	TArray<FInvitedPlayerPair> InvitedPlayers;
 
+	/** Version of UserIdToPartyMemberMap and InvitedPlayers, bumped every time either of them changes */
+	uint32 RosterVersion = 0;
+
+	/** Snapshot of UserIdToPartyMemberMap and InvitedPlayers at RosterVersion, built on demand by GetRoster */
+	mutable TSharedPtr<const FAccelBytePartyRoster> CachedRoster;
+
 	/** Instance of party data that is grabbed from the backend and modified locally */
 	TSharedRef<FOnlinePartyData> PartyData;
 
+	/** Version of PartyData, bumped every time it is set or changed */
+	uint32 PartyDataVersion = 0;
+
+	/** Map of member AccelByte IDs to their crossplay preference, mirroring the crossplay platform map in PartyData */
+	TMap<FString, FAccelBytePartyMemberCrossplayPreference> MemberCrossplayPreferences;
+
+	/** Map of platform names to the number of entries in MemberCrossplayPreferences on that platform */
+	TMap<FString, int32> PlatformMemberCounts;
+
+	/** Number of entries in MemberCrossplayPreferences that do not have crossplay enabled */
+	int32 NumMembersWithoutCrossplay = 0;
+
+	/** Whether PartyData has a valid crossplay platform map, a party without one is never considered crossplay */
+	bool bHasCrossplayPlatformMap = false;
+
 };
 
 class ONLINESUBSYSTEMACCELBYTE_API FOnlinePartyJoinInfoAccelByte : public IOnlinePartyJoinInfo
@@ -293,8 +407,8 @@ private:
 /** Typedef for a map of shared references to FOnlinePartyIdAccelByte objects to shared references to FOnlinePartyAccelByte objects */
 using FPartyIDToPartyMap = TMap<TSharedRef<const FOnlinePartyIdAccelByte>, TSharedRef<FOnlinePartyAccelByte>, FDefaultSetAllocator, TPartyIdConstSharedRefMapKeyFuncs<TSharedRef<FOnlinePartyAccelByte>>>;
 
-/** Typedef for a map of user IDs to maps of party IDs and party objects */
-using FUserIDToPartiesMap = TMap<TSharedRef<const FUniqueNetIdAccelByteUser>, FPartyIDToPartyMap, FDefaultSetAllocator, TUserUniqueIdConstSharedRefMapKeyFuncs<FPartyIDToPartyMap>>;
+/** Typedef for a map of AccelByte IDs of party members to maps of party IDs and party objects */
+using FMemberIdToPartiesMap = TMap<FString, FPartyIDToPartyMap>;
 
 /**
  * Structure representing information needed to act on an invite to an AccelByte party
@@ -332,6 +446,9 @@ using FPartyInviteArray = TArray<TSharedRef<const FAccelBytePartyInvite>>;
 /** Map of user IDs to an array of invite structures */
 using FUserIdToPartyInvitesMap = TMap<TSharedRef<const FUniqueNetIdAccelByteUser>, FPartyInviteArray, FDefaultSetAllocator, TUserUniqueIdConstSharedRefMapKeyFuncs<FPartyInviteArray>>;
 
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnPartyDataAttributesChanged, const FUniqueNetId& /*LocalUserId*/, const FOnlinePartyId& /*PartyId*/, const FName& /*Namespace*/, const FAccelBytePartyStorageDelta& /*Changes*/);
+typedef FOnPartyDataAttributesChanged::FDelegate FOnPartyDataAttributesChangedDelegate;
+
 class ONLINESUBSYSTEMACCELBYTE_API FOnlinePartySystemAccelByte : public IOnlinePartySystem, public TSharedFromThis<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe>
 {
 PACKAGE_SCOPE:
@@ -414,6 +531,46 @@ PACKAGE_SCOPE:
 	/** Internal method to get a non-const AccelByte party object for operating on */
 	TSharedPtr<FOnlinePartyAccelByte> GetPartyForUser(const TSharedRef<const FUniqueNetIdAccelByteUser>& UserId, const TSharedRef<const FOnlinePartyIdAccelByte>& PartyId);
 
+	/**
+	 * Read the attributes of the party storage carried by a party data change notification, safe to call off the game
+	 * thread.
+	 *
+	 * @return true if the notification carried party storage with at least one attribute, false otherwise
+	 */
+	static bool DecodePartyStorage(const FAccelByteModelsPartyDataNotif& Notification, TMap<FString, FVariantData>& OutStorageAttrs);
+
+	/**
+	 * Read the attributes of party storage written out as JSON, safe to call off the game thread as it only touches the
+	 * string it is given.
+	 *
+	 * @return true if the JSON held party storage with at least one attribute, false otherwise
+	 */
+	static bool DecodePartyStorage(const FString& StorageJson, TMap<FString, FVariantData>& OutStorageAttrs);
+
+	/** Called by the subsystem every tick to send coalesced party storage writes that are due and to expire stale invites */
+	void Tick(float DeltaTime);
+
+	/** Count a party data change that was dropped before being written as it would not have changed anything */
+	void RecordSkippedPartyDataWrite();
+
+	/**
+	 * Save a snapshot of a local user's party, persisting it to disk if enabled. The snapshot is saved again from Tick
+	 * whenever the party's members, invites, leader or party data change, until RemovePartySnapshot is called for the user.
+	 */
+	void SavePartySnapshot(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<FOnlinePartyAccelByte>& Party);
+
+	/**
+	 * Read the party snapshot a previous session persisted for a local user off the game thread, called on login if the
+	 * disk cache is enabled. Once read, it is returned by GetLastKnownPartySnapshot unless this session saved a newer one.
+	 */
+	void LoadPartySnapshot(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId);
+
+	/** Forget the party snapshot of a local user, called once they are known to no longer be in a party or log out */
+	void RemovePartySnapshot(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId);
+
+	/** Forget the party storage of a local user's queued party data changes, called once they are purged on logout */
+	void RemoveQueuedPartyStorages(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId);
+
 public:
 
 	virtual ~FOnlinePartySystemAccelByte() override = default;
@@ -492,6 +649,35 @@ public:
 	 * Convenience method to get first party for user.
 	 */
 	TSharedPtr<const FOnlinePartyId> GetFirstPartyIdForUser(const FUniqueNetId & UserId);
+
+	/**
+	 * Get counters for every party storage write asked for through UpdatePartyData since this interface was created,
+	 * including how many of them were merged into another write rather than being sent on their own.
+	 */
+	FAccelBytePartyStorageWriteStats GetPartyStorageWriteStats() const;
+
+	/**
+	 * Get a snapshot of the members and pending invites of a party that a local user is in, or nullptr if the user is not
+	 * in that party. The same snapshot is returned until the party's members or invites change, so unlike GetPartyMembers
+	 * and GetPendingInvitedUsers this can be called every frame without copying any members.
+	 */
+	TSharedPtr<const FAccelBytePartyRoster> GetPartyRoster(const FUniqueNetId& LocalUserId, const FOnlinePartyId& PartyId) const;
+
+	/**
+	 * Get the last known party of a local user, as saved by this session or persisted by a previous one. Meant to show
+	 * the party straight away while RestoreParties gets the actual party from the backend, so it may be out of date. A
+	 * persisted snapshot is read in the background after login, and is not returned until that read has finished.
+	 *
+	 * @return true if there is a snapshot for the user, false otherwise
+	 */
+	bool GetLastKnownPartySnapshot(const FUniqueNetId& LocalUserId, FAccelBytePartySnapshot& OutSnapshot);
+
+	/**
+	 * Fired when a party data change notification changes party storage, with only the attributes that were set to a new
+	 * value or removed. OnPartyDataReceived still fires after this with the full party data.
+	 */
+	DEFINE_ONLINE_DELEGATE_FOUR_PARAM(OnPartyDataAttributesChanged, const FUniqueNetId& /*LocalUserId*/, const FOnlinePartyId& /*PartyId*/, const FName& /*Namespace*/, const FAccelBytePartyStorageDelta& /*Changes*/);
+
 	/**
 	 * @return party type id for the primary party - the primary party is the party that will be addressable via the social panel
 	 */
@@ -506,11 +692,83 @@ protected:
 	/** Instance of the subsystem that created this interface */
 	FOnlineSubsystemAccelByte* AccelByteSubsystem = nullptr;
 
-	/** Map of user IDs to a map of party IDs and their associated party objects */
-	FUserIDToPartiesMap UserIdToPartiesMap;
+	/**
+	 * Map of AccelByte IDs of every party member we know of, local or remote, to a map of party IDs and their associated
+	 * party objects. Keyed by the plain AccelByte ID rather than the composite user ID, so that an ID with or without
+	 * platform information resolves to the same parties, and so that a lookup only hashes the short AccelByte ID.
+	 */
+	FMemberIdToPartiesMap MemberIdToPartiesMap;
+
+	/** Find the parties that a user is a member of, or nullptr if they are not in any */
+	FPartyIDToPartyMap* FindPartiesForUser(const FUniqueNetIdAccelByteUser& UserId);
+
+	/** Find the parties that a user is a member of, or nullptr if they are not in any */
+	const FPartyIDToPartyMap* FindPartiesForUser(const FUniqueNetIdAccelByteUser& UserId) const;
 
-	/** Map of user IDs associated with an array of party invites */
-	FUserIdToPartyInvitesMap UserIdToPartyInvitesMap;
+	/** Get the changes every local user has made to a party's storage that have not been written yet */
+	FAccelBytePartyStorageDelta GetUnwrittenPartyStorageDelta(const FOnlinePartyId& PartyId) const;
+
+	/** Pending party invites of every local user, indexed by party and by inviter */
+	FAccelBytePartyInviteStore PartyInviteStore;
+
+	/**
+	 * Map of "<local user AccelByte ID>:<party ID>" to the coalescer merging that user's writes to the party's storage,
+	 * only kept while it has writes to send
+	 */
+	TMap<FString, TSharedRef<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>> PartyStorageWriteCoalescers;
+
+	/** Write counters of coalescers that have been removed from PartyStorageWriteCoalescers */
+	FAccelBytePartyStorageWriteStats RemovedCoalescerWriteStats;
+
+	/** Number of party data changes dropped by party objects before reaching UpdatePartyData as they changed nothing */
+	int32 NumSkippedPartyDataWrites = 0;
+
+	/** Map of local user AccelByte IDs to the last known snapshot of their party */
+	TMap<FString, FAccelBytePartySnapshot> PartySnapshots;
+
+	/** Versions of a party's roster and party data as of when a snapshot of it was saved */
+	struct FPartySnapshotVersions
+	{
+		uint32 RosterVersion = 0;
+		uint32 PartyDataVersion = 0;
+	};
+
+	/** Map of local user AccelByte IDs to the versions of their party when its snapshot was last saved */
+	TMap<FString, FPartySnapshotVersions> PartySnapshotVersions;
+
+	/** AccelByte IDs of local users whose persisted snapshot is being read, removed once read or when they log out */
+	TSet<FString> PartySnapshotsBeingRead;
+
+	/** Reads, writes and deletes snapshot files off the game thread */
+	TSharedRef<FAccelBytePartySnapshotFileWriter, ESPMode::ThreadSafe> PartySnapshotFileWriter;
+
+	/** Party storage of a party data change notification waiting in the notification queue */
+	struct FQueuedPartyStorage
+	{
+		/** Party storage written out as JSON on the game thread, the only part of the notification the decoder reads */
+		FString StorageJson;
+
+		/** Attributes decoded from StorageJson on a background thread */
+		TMap<FString, FVariantData> StorageAttrs;
+
+		/** Whether StorageJson held at least one attribute */
+		bool bHasStorage = false;
+	};
+
+	/**
+	 * Map of "PartyData:<local user AccelByte ID>:<party ID>" coalescing keys to the party storage of the latest party data
+	 * change queued for that user and party, so that a newer change without storage can carry it over when replacing it
+	 */
+	TMap<FString, TSharedRef<FQueuedPartyStorage, ESPMode::ThreadSafe>> QueuedPartyStorages;
+
+	/** Path of the file that a local user's party snapshot is persisted to */
+	FString GetPartySnapshotFilePath(const FString& LocalAccelByteId) const;
+
+	/** Take a snapshot of a local user's party and store it, queuing it to be written to disk if enabled */
+	void WritePartySnapshot(const FString& LocalAccelByteId, const FOnlinePartyAccelByte& Party);
+
+	/** Delegate handler for when the persisted party snapshot of a local user has been read by LoadPartySnapshot */
+	void OnPartySnapshotRead(bool bWasRead, const FAccelBytePartySnapshot& Snapshot, FString LocalAccelByteId);
 
 	/** Store an array of delegates to execute when party join complete */
 	TArray<FOnPartyJoinedDelegate> OnPartyJoinedPendingTasks;
@@ -523,6 +781,9 @@ private:
 	/** Delegate handler for when we receive a party invite */
 	void OnReceivedPartyInviteNotification(const FAccelByteModelsPartyGetInvitedNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId);
 
+	/** Delegate handler for when a pending party invite expires before being acted on */
+	void OnPartyInviteExpired(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FAccelBytePartyInvite>& Invite);
+
 	/** Delegate handler for when a party invite is sent by a remote user to a remote user */
 	void OnPartyInviteSentNotification(const FAccelByteModelsInvitationNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId);
 
@@ -535,8 +796,22 @@ private:
 	/** Delegate handler for when a remote user is kicked from our party */
 	void OnPartyKickNotification(const FAccelByteModelsGotKickedFromPartyNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId);
 
-	/** Delegate handler for when party data changes */
-	void OnPartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId);
+	/** Delegate handler for when party data changes, queues the notification to parse party storage off the game thread */
+	void QueuePartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId, int32 LocalUserNum);
+
+	/**
+	 * Handle a queued party data change notification on the game thread
+	 *
+	 * @param StorageAttrs Attributes of party storage read from the notification, or null if the notification carried no storage
+	 */
+	void OnPartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId, const TMap<FString, FVariantData>* StorageAttrs);
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/**
+	 * Setting the party data notification tests as a friend class to hand notifications straight to the handler
+	 */
+	friend class FOnlinePartyDataNotificationsTestAccess;
+#endif
 	
 	/** Convenience function for executing code after party joined complete. Used for when local user is still joining a party */
 	void RunOnPartyJoinedComplete(const FOnPartyJoinedDelegate& Delegate);
@@ -0,0 +1,133 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+
+struct FAccelBytePartyInvite;
+
+/** Delegate fired by the invite store for each invite that expires before it is acted on */
+DECLARE_DELEGATE_TwoParams(FOnAccelBytePartyInviteExpired, const TSharedRef<const FUniqueNetIdAccelByteUser>& /*LocalUserId*/, const TSharedRef<const FAccelBytePartyInvite>& /*Invite*/);
+
+/**
+ * Pending party invites of every local user, indexed by both the party that each invite is for and the user that sent
+ * it, so that finding, replacing or removing an invite never has to scan a user's invites.
+ *
+ * A user only ever holds one invite per party and one invite per inviter, a newer invite replacing any older one that
+ * shares either. Invites expire after a time to live, and once a user holds the maximum number of invites the oldest
+ * one is evicted to make room for a new one, so a user that is spammed with invites never grows past that maximum.
+ *
+ * The store does not fire any of the party interface delegates itself, it reports expired invites through the delegate
+ * that it was created with and evicted invites through AddInvite, and it is driven by the party interface tick.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartyInviteStore
+{
+public:
+
+	FAccelBytePartyInviteStore() = default;
+
+	/**
+	 * @param InOnInviteExpired Delegate fired from Tick for each invite that has expired
+	 */
+	explicit FAccelBytePartyInviteStore(const FOnAccelBytePartyInviteExpired& InOnInviteExpired);
+
+	/**
+	 * Add an invite for a local user, replacing any invite that they hold for the same party or from the same inviter.
+	 *
+	 * @param LocalUserId ID of the user that received the invite
+	 * @param Invite Invite that was received
+	 * @param CurrentTimeSeconds Time in seconds that the invite was received
+	 * @param TTLSeconds Time in seconds before the invite expires, or zero for it to never expire
+	 * @param MaxInvitesPerUser Number of invites the user can hold before the oldest is evicted
+	 * @param OutEvictedInvites Invites that were evicted to make room for this one
+	 */
+	void AddInvite(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const TSharedRef<const FAccelBytePartyInvite>& Invite, double CurrentTimeSeconds, double TTLSeconds, int32 MaxInvitesPerUser, TArray<TSharedRef<const FAccelBytePartyInvite>>& OutEvictedInvites);
+
+	/** Find the invite that a local user holds for a party, or nullptr if they have none */
+	TSharedPtr<const FAccelBytePartyInvite> FindInviteForParty(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& PartyId) const;
+
+	/** Find the invite that a local user holds from an inviter, or nullptr if they have none */
+	TSharedPtr<const FAccelBytePartyInvite> FindInviteFromInviter(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& InviterAccelByteId) const;
+
+	/** Remove the invite that a local user holds for a party, returning the removed invite or nullptr if there was none */
+	TSharedPtr<const FAccelBytePartyInvite> RemoveInviteForParty(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& PartyId);
+
+	/** Remove the invite that a local user holds from an inviter, returning the removed invite or nullptr if there was none */
+	TSharedPtr<const FAccelBytePartyInvite> RemoveInviteFromInviter(const FUniqueNetIdAccelByteUser& LocalUserId, const FString& InviterAccelByteId);
+
+	/**
+	 * Remove every invite that a local user holds.
+	 *
+	 * @return true if the user held any invites, false otherwise
+	 */
+	bool RemoveAllInvites(const FUniqueNetIdAccelByteUser& LocalUserId);
+
+	/**
+	 * Get every invite that a local user holds, oldest first.
+	 *
+	 * @return true if the user holds any invites, false otherwise
+	 */
+	bool GetInvites(const FUniqueNetIdAccelByteUser& LocalUserId, TArray<TSharedRef<const FAccelBytePartyInvite>>& OutInvites) const;
+
+	/** Get the number of invites that a local user holds */
+	int32 GetNumInvites(const FUniqueNetIdAccelByteUser& LocalUserId) const;
+
+	/** Get the number of invites held across every local user */
+	int32 GetTotalNumInvites() const;
+
+	/** Remove every invite that has expired, firing the expiry delegate for each of them */
+	void Tick(double CurrentTimeSeconds);
+
+private:
+
+	/** An invite along with the bookkeeping needed to age it out */
+	struct FStoredInvite
+	{
+		FStoredInvite(const TSharedRef<const FAccelBytePartyInvite>& InInvite, uint64 InReceivedOrder, double InExpireTimeSeconds)
+			: Invite(InInvite)
+			, ReceivedOrder(InReceivedOrder)
+			, ExpireTimeSeconds(InExpireTimeSeconds)
+		{
+		}
+
+		/** The invite itself */
+		TSharedRef<const FAccelBytePartyInvite> Invite;
+
+		/** Order that the invite was received in across the whole store, used to find the oldest invite to evict */
+		uint64 ReceivedOrder = 0;
+
+		/** Time in seconds that the invite expires at */
+		double ExpireTimeSeconds = 0.0;
+	};
+
+	/** Invites held by a single local user */
+	struct FUserInvites
+	{
+		/** ID of the local user, kept so that the expiry delegate can be fired with it */
+		TSharedPtr<const FUniqueNetIdAccelByteUser> LocalUserId;
+
+		/** Map of party IDs to the invite for that party */
+		TMap<FString, FStoredInvite> InvitesByPartyId;
+
+		/** Map of inviter AccelByte IDs to the ID of the party that they invited the user to */
+		TMap<FString, FString> PartyIdsByInviterId;
+	};
+
+	/** Remove an invite by party ID from a user's invites, keeping the inviter index in step */
+	static TSharedPtr<const FAccelBytePartyInvite> RemoveStoredInvite(FUserInvites& UserInvites, const FString& PartyId);
+
+	/** Delegate fired from Tick for each invite that has expired */
+	FOnAccelBytePartyInviteExpired OnInviteExpired;
+
+	/** Map of local user AccelByte IDs to the invites that they hold */
+	TMap<FString, FUserInvites> InvitesByUserId;
+
+	/** Order that will be given to the next invite added */
+	uint64 NextReceivedOrder = 0;
+
+	/** Earliest time in seconds that any held invite expires at, so that Tick only looks at invites when one is due */
+	double NextExpireTimeSeconds = MAX_dbl;
+
+};
@@ -0,0 +1,109 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Optional.h"
+
+class FOnlinePartyAccelByte;
+
+/**
+ * Member entry of a party snapshot
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartySnapshotMember
+{
+	/** AccelByte ID of the member */
+	FString AccelByteId;
+
+	/** Display name of the member when the snapshot was taken */
+	FString DisplayName;
+};
+
+/**
+ * Last known state of a local user's party, persisted between sessions so that the party can be shown straight away
+ * after a crash or relog, while the party is restored from the backend. A snapshot may be stale, and is replaced by the
+ * restored party as soon as the restore completes.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartySnapshot
+{
+	/** ID of the party */
+	FString PartyId;
+
+	/** AccelByte ID of the party leader */
+	FString LeaderId;
+
+	/** Members of the party */
+	TArray<FAccelBytePartySnapshotMember> Members;
+
+	/** Party data as written by FOnlinePartyData::ToJsonFull, can be read back with FOnlinePartyData::FromJson */
+	FString PartyDataJson;
+
+	/** Time in UTC that the snapshot was taken */
+	FDateTime SavedAt;
+
+	/** Take a snapshot of a party as it is now */
+	static FAccelBytePartySnapshot FromParty(const FOnlinePartyAccelByte& Party);
+
+	/** Write this snapshot as a JSON string to persist to disk */
+	FString ToJsonString() const;
+
+	/**
+	 * Read a snapshot back from a JSON string written by ToJsonString.
+	 *
+	 * @return true if the string held a snapshot in the current format, false otherwise
+	 */
+	static bool FromJsonString(const FString& JsonString, FAccelBytePartySnapshot& OutSnapshot);
+};
+
+/** Delegate fired on the game thread once a party snapshot file has been read, bWasRead is false if there was none */
+DECLARE_DELEGATE_TwoParams(FOnAccelBytePartySnapshotRead, bool /*bWasRead*/, const FAccelBytePartySnapshot& /*Snapshot*/);
+
+/**
+ * Reads, writes and deletes party snapshot files on a background thread, so loading or saving a snapshot never blocks
+ * the game thread on disk. Only the latest write or delete queued for a file is carried out, so a write that runs late
+ * never replaces a newer snapshot or brings back one that has been deleted.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartySnapshotFileWriter : public TSharedFromThis<FAccelBytePartySnapshotFileWriter, ESPMode::ThreadSafe>
+{
+public:
+
+	/** Queue a snapshot to be written to a file, replacing any write or delete of that file that has not run yet */
+	void QueueWrite(const FString& FilePath, const FAccelBytePartySnapshot& Snapshot);
+
+	/** Queue a file to be deleted, replacing any write or delete of that file that has not run yet */
+	void QueueDelete(const FString& FilePath);
+
+	/** Whether a write or delete of a file has not finished yet, in which case the file on disk may be out of date */
+	bool HasPendingOperation(const FString& FilePath) const;
+
+	/**
+	 * Queue a snapshot to be read from a file and parsed. The file may be written or deleted before the delegate fires,
+	 * so check HasPendingOperation from it before trusting the snapshot.
+	 */
+	void QueueRead(const FString& FilePath, const FOnAccelBytePartySnapshotRead& OnRead);
+
+private:
+
+	/** Queue a write of the snapshot to a file, or a delete of the file if there is no snapshot */
+	void QueueOperation(const FString& FilePath, TOptional<FAccelBytePartySnapshot>&& Snapshot);
+
+	/** Carry out a queued write or delete on a background thread, unless a newer one has been queued for the same file */
+	void RunOperation(const FString& FilePath, uint64 Generation, const TOptional<FAccelBytePartySnapshot>& Snapshot);
+
+	/** Read a snapshot file on a background thread and hand the result back to the game thread */
+	void RunRead(const FString& FilePath, const FOnAccelBytePartySnapshotRead& OnRead);
+
+	/** Lock guarding LatestGenerations and NextGeneration */
+	mutable FCriticalSection GenerationLock;
+
+	/** Lock held while touching a file, so that reads and operations on the same file never overlap */
+	FCriticalSection FileLock;
+
+	/** Map of file paths to the generation of the latest operation queued for them, removed once it has run */
+	TMap<FString, uint64> LatestGenerations;
+
+	/** Generation given to the next queued operation */
+	uint64 NextGeneration = 1;
+};
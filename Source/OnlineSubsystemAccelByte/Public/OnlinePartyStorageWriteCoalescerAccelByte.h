@@ -0,0 +1,181 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineKeyValuePair.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+
+class FJsonObject;
+class FOnlinePartyData;
+
+/**
+ * Set of party attribute changes to apply to party storage in a single write
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartyStorageDelta
+{
+	/** Attributes that have been set, mapped to their new value */
+	TMap<FString, FVariantData> UpdatedAttrs;
+
+	/** Attributes that have been removed */
+	TSet<FString> RemovedAttrs;
+
+	/** Build a delta from the attributes that are marked dirty in the party data */
+	static FAccelBytePartyStorageDelta FromDirtyPartyData(const FOnlinePartyData& PartyData);
+
+	/**
+	 * Build the delta that takes the current party data to the full set of attributes read from party storage, holding
+	 * only the attributes whose value differs and the attributes that are no longer there.
+	 *
+	 * @param UnwrittenDelta Changes of ours that have not been written yet. Storage predates them, so the attributes they
+	 * touch are left out rather than being reverted to the stored value.
+	 */
+	static FAccelBytePartyStorageDelta FromPartyStorage(const FOnlinePartyData& CurrentPartyData, const TMap<FString, FVariantData>& StorageAttrs, const FAccelBytePartyStorageDelta& UnwrittenDelta = FAccelBytePartyStorageDelta());
+
+	/**
+	 * Read the attributes of party storage as written by ApplyToJsonObject straight from its JSON object, without going
+	 * through a string. Only touches the JSON object, so it is safe to call off the game thread.
+	 */
+	static void ReadPartyStorage(const FJsonObject& StorageObject, TMap<FString, FVariantData>& OutStorageAttrs);
+
+	/** Fold a newer delta into this one, with the newer delta winning for any attribute that both of them touch */
+	void Merge(const FAccelBytePartyStorageDelta& Newer);
+
+	/** Whether this delta has no changes to apply */
+	bool IsEmpty() const;
+
+	/** Whether this delta updates or removes an attribute */
+	bool TouchesAttr(const FString& Key) const;
+
+	/**
+	 * Drop every change that would leave the party data as it already is, that is updates to the value an attribute
+	 * already has and removals of attributes that are not there.
+	 */
+	void RemoveUnchangedAttrs(const FOnlinePartyData& CurrentPartyData);
+
+	/**
+	 * Apply this delta to the JSON object of party storage. Only reads from the delta, so it can safely be applied again
+	 * to a fresh copy of storage when a write has to be retried after a revision conflict.
+	 */
+	void ApplyToJsonObject(const TSharedRef<FJsonObject>& JsonObject) const;
+
+	/** Apply this delta to a local party data instance */
+	void ApplyToPartyData(FOnlinePartyData& PartyData) const;
+};
+
+/**
+ * Counters for how many party storage writes were asked for, compared with how many were actually sent
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartyStorageWriteStats
+{
+	/** Number of writes that were asked for through UpdatePartyData */
+	int32 NumRequestedWrites = 0;
+
+	/** Number of writes that were sent to party storage */
+	int32 NumSentWrites = 0;
+
+	/** Number of requested writes that were folded into another write rather than being sent on their own */
+	int32 NumMergedWrites = 0;
+
+	/** Number of writes that were never sent, or never asked for, as they would not have changed any attribute */
+	int32 NumSkippedWrites = 0;
+
+	/** Number of sent writes that failed and were queued to be sent again */
+	int32 NumRetriedWrites = 0;
+
+	/** Number of sent writes that failed and were dropped after running out of retries */
+	int32 NumFailedWrites = 0;
+
+	/** Add the counters of another set of stats to these */
+	void Accumulate(const FAccelBytePartyStorageWriteStats& Other);
+};
+
+/** Delegate fired by a write function once party storage has been written, or the write has failed */
+DECLARE_DELEGATE_OneParam(FOnPartyStorageWriteComplete, bool /*bWasSuccessful*/);
+
+/** Function that sends a single write of a delta to party storage on behalf of a local user */
+typedef TFunction<void(const TSharedRef<const FUniqueNetIdAccelByteUser>& /*LocalUserId*/, const FAccelBytePartyStorageDelta& /*Delta*/, const FOnPartyStorageWriteComplete& /*OnComplete*/)> FAccelBytePartyStorageWriteFunction;
+
+/**
+ * Merges the party data changes a single local user makes to a single party into as few party storage writes as
+ * possible. Every write is sent on behalf of that user, so changes from different users are never mixed together.
+ *
+ * Changes are collected for a short window after the first one before being sent as one write, and any changes made
+ * while a write is in flight are held until it completes, so there is never more than one write in flight per party.
+ * A write that fails is merged back under any newer changes and sent again, up to a maximum number of retries.
+ *
+ * The coalescer does not talk to the backend itself, it hands each write to the function that it was created with, and
+ * it is driven by the party interface tick on the game thread.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelBytePartyStorageWriteCoalescer : public TSharedFromThis<FAccelBytePartyStorageWriteCoalescer, ESPMode::ThreadSafe>
+{
+public:
+
+	/**
+	 * @param InWriteFunction Function used to send each write to party storage
+	 * @param InCoalesceWindowSeconds Time in seconds to wait after the first change before sending a write
+	 * @param InMaxRetries Number of times a failed write is sent again before its changes are dropped
+	 */
+	FAccelBytePartyStorageWriteCoalescer(const FAccelBytePartyStorageWriteFunction& InWriteFunction, double InCoalesceWindowSeconds, int32 InMaxRetries);
+
+	/** Queue a set of changes to be written to party storage with the next write */
+	void AddWrite(const TSharedRef<const FUniqueNetIdAccelByteUser>& LocalUserId, const FAccelBytePartyStorageDelta& Delta, double CurrentTimeSeconds);
+
+	/** Send the pending changes if the coalescing window has passed and no other write is in flight */
+	void Tick(double CurrentTimeSeconds);
+
+	/** Whether there are no pending changes and no write in flight */
+	bool IsIdle() const;
+
+	/** Get the changes that have not been written to party storage yet, those in flight with the pending ones on top */
+	FAccelBytePartyStorageDelta GetUnwrittenDelta() const;
+
+	/** Get the write counters for this coalescer */
+	const FAccelBytePartyStorageWriteStats& GetStats() const;
+
+private:
+
+	/** Handler for when the write in flight completes */
+	void OnWriteComplete(bool bWasSuccessful);
+
+	/** Function used to send each write to party storage */
+	FAccelBytePartyStorageWriteFunction WriteFunction;
+
+	/** Time in seconds to wait after the first change before sending a write */
+	double CoalesceWindowSeconds = 0.0;
+
+	/** Number of times a failed write is sent again before its changes are dropped */
+	int32 MaxRetries = 0;
+
+	/** Changes that have not been sent yet */
+	FAccelBytePartyStorageDelta PendingDelta;
+
+	/** ID of the local user whose changes this coalescer writes, set by the first change added */
+	TSharedPtr<const FUniqueNetIdAccelByteUser> WriterUserId;
+
+	/** Time in seconds that the first pending change was added */
+	double PendingSinceTimeSeconds = 0.0;
+
+	/** Number of requested writes that have been folded into the pending changes */
+	int32 NumPendingRequests = 0;
+
+	/** Number of times the pending changes have already failed to be written */
+	int32 PendingRetryCount = 0;
+
+	/** Changes in the write that is currently in flight */
+	FAccelBytePartyStorageDelta InFlightDelta;
+
+	/** Number of times the changes in flight had already failed to be written before this attempt */
+	int32 InFlightRetryCount = 0;
+
+	/** Time in seconds that the write in flight was sent */
+	double InFlightSentTimeSeconds = 0.0;
+
+	/** Whether a write is currently in flight */
+	bool bIsWriteInFlight = false;
+
+	/** Counters for the writes that have gone through this coalescer */
+	FAccelBytePartyStorageWriteStats Stats;
+
+};
@@ -0,0 +1,110 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemTypes.h"
+#include "OnlineDelegateMacros.h"
+#include "OnlineSubsystemAccelByte.h"
+
+/**
+ * Smoothed latency to a single QoS region
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteQosRegionLatency
+{
+	/** Exponentially weighted moving average of the latency to the region in milliseconds */
+	double LatencyMs = 0.0;
+
+	/** Exponentially weighted moving average of the difference between consecutive latency samples in milliseconds */
+	double JitterMs = 0.0;
+
+	/** Number of samples that have been folded into the averages */
+	int32 SampleCount = 0;
+
+	/** Time in seconds that the last sample for this region was received */
+	double LastUpdatedTimeSeconds = 0.0;
+};
+
+DECLARE_MULTICAST_DELEGATE(FOnQosLatenciesUpdated);
+typedef FOnQosLatenciesUpdated::FDelegate FOnQosLatenciesUpdatedDelegate;
+
+/**
+ * Keeps an up to date view of the latency to every QoS region, so that matchmaking requests never have to wait on a
+ * round of pings. Regions are pinged as soon as a user logs in and then periodically in the background, with each
+ * round folded into a per-region moving average of latency and jitter.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineQosManagerAccelByte : public TSharedFromThis<FOnlineQosManagerAccelByte, ESPMode::ThreadSafe>
+{
+PACKAGE_SCOPE:
+
+	/** Constructor that is invoked by the Subsystem instance to create a QoS manager instance */
+	FOnlineQosManagerAccelByte(FOnlineSubsystemAccelByte* InSubsystem);
+
+	/** Map of region name to the smoothed latency for that region */
+	TMap<FString, FAccelByteQosRegionLatency> RegionLatencies;
+
+	/** Critical section for thread safe operation of RegionLatencies, as matchmaking reads them from the task thread */
+	mutable FCriticalSection RegionLatenciesLock;
+
+	/** Index of the local user whose API client is used to ping regions, INVALID_CONTROLLERID if refresh is stopped */
+	int32 RefreshUserNum = INVALID_CONTROLLERID;
+
+	/** Time in seconds that the last round of pings was sent */
+	double LastRefreshTimeSeconds = 0.0;
+
+	/** Whether a round of pings has been sent and not returned yet */
+	bool bIsRefreshInFlight = false;
+
+	/** Send a round of pings to every region with the API client of the refresh user */
+	void RefreshLatencies();
+
+	void OnGetServerLatenciesSuccess(const TArray<TPair<FString, float>>& Result);
+	void OnGetServerLatenciesError(int32 ErrorCode, const FString& ErrorMessage);
+
+public:
+	virtual ~FOnlineQosManagerAccelByte() {};
+
+	/**
+	 * Delegate fired each time a round of pings completes and the smoothed latencies have been updated
+	 */
+	DEFINE_ONLINE_DELEGATE(OnQosLatenciesUpdated);
+
+	/**
+	 * Start pinging regions for a logged in user, immediately and then every QosLatencyRefreshIntervalSeconds. Only one user's
+	 * API client is used at a time as latencies are the same for every user on this machine.
+	 */
+	void StartLatencyRefresh(int32 LocalUserNum);
+
+	/** Stop refreshing latencies in the background, the last known latencies are kept */
+	void StopLatencyRefresh();
+
+	/**
+	 * Fold a round of latency samples into the moving averages. Called with the results of every background refresh, and
+	 * may be called with any other set of pings that were made to the regions.
+	 */
+	void AddLatencySamples(const TArray<TPair<FString, float>>& Samples);
+
+	/**
+	 * Get the smoothed latency to every region in the format expected by matchmaking.
+	 *
+	 * @return true if at least one region has a latency
+	 */
+	bool GetLatencies(TArray<TPair<FString, float>>& OutLatencies) const;
+
+	/** Get the smoothed latency and jitter for every region */
+	TMap<FString, FAccelByteQosRegionLatency> GetRegionLatencies() const;
+
+	/** Called by the subsystem every tick to start background refreshes when they are due */
+	void Tick(float DeltaTime);
+
+protected:
+	/** Hidden default constructor, the constructor that takes in a subsystem instance should be used instead. */
+	FOnlineQosManagerAccelByte()
+		: AccelByteSubsystem(nullptr)
+	{}
+
+	/** Instance of the subsystem that created this manager */
+	FOnlineSubsystemAccelByte* AccelByteSubsystem = nullptr;
+
+};
@@ -53,6 +53,7 @@ struct FAccelBytePendingMatchInfo
 	FString ServerName;
 	FString Ip;
 	FString GameMode;
+	FString Region;
 	int32 Port;
 	TArray<FString> MatchedPlayers;
 	double ReceivedTimeSeconds = 0.0;
@@ -72,6 +73,91 @@ struct FAccelBytePendingMatchInfo
 	}
 };
 
+/**
+ * Internal structure for tracking what we have advertised to the session browser for a hosted P2P session, so that
+ * UpdateSession can send only what has changed and coalesce rapid updates into a single request.
+ */
+struct FAccelByteSessionUpdateState
+{
+	/** Settings as they were last acknowledged by the session browser */
+	FOnlineSessionSettings AdvertisedSettings;
+
+	/** Number of registered players as last acknowledged by the session browser */
+	int32 AdvertisedPlayerCount = 0;
+
+	/** Whether the session browser has acknowledged AdvertisedSettings, false while the session is still being created */
+	bool bHasAdvertisedSettings = false;
+
+	/** Whether the local settings or registered players have changed since the last request was sent */
+	bool bIsUpdatePending = false;
+
+	/** Whether a request to update the session browser has been sent and not returned yet */
+	bool bIsRequestInFlight = false;
+
+	/** Time in seconds that the last update request was sent */
+	double LastRequestTimeSeconds = 0.0;
+};
+
+/**
+ * Sessions that appeared, disappeared or changed between two refreshes of a cached session search
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteSessionSearchDiff
+{
+	/** Sessions that are in the new results but were not in the previous results */
+	TArray<FOnlineSessionSearchResult> AddedSessions;
+
+	/** Sessions in both sets of results whose player counts, settings or host have changed */
+	TArray<FOnlineSessionSearchResult> ChangedSessions;
+
+	/** IDs of sessions that were in the previous results but are not in the new results */
+	TArray<FString> RemovedSessionIds;
+
+	bool HasChanges() const
+	{
+		return AddedSessions.Num() > 0 || ChangedSessions.Num() > 0 || RemovedSessionIds.Num() > 0;
+	}
+};
+
+/**
+ * Internal structure for the results of a session browser query, shared by every FindSessions call with the same query
+ * settings and refreshed in the background for as long as the game keeps asking for it.
+ */
+struct FAccelByteSessionSearchCacheEntry
+{
+	/** Query settings that the results were found with, repeated for every refresh */
+	FOnlineSearchSettings QuerySettings;
+
+	/** Maximum number of results to ask the session browser for */
+	int32 MaxSearchResults = 0;
+
+	/** User whose credentials are used to refresh the results */
+	TSharedPtr<const FUniqueNetId> SearchingPlayerId;
+
+	/** Results from the last successful refresh */
+	TArray<FOnlineSessionSearchResult> Results;
+
+	/** Whether Results has been filled by at least one successful refresh */
+	bool bHasResults = false;
+
+	/** Whether a request to the session browser has been sent and not returned yet */
+	bool bIsRefreshInFlight = false;
+
+	/** Time in seconds of the last successful refresh, results older than the TTL are not handed out */
+	double LastRefreshTimeSeconds = 0.0;
+
+	/** Time in seconds of the last refresh attempt, successful or not, used to schedule background refreshes */
+	double LastAttemptTimeSeconds = 0.0;
+
+	/** Time in seconds that FindSessions was last called with this query, entries idle for too long are dropped */
+	double LastRequestTimeSeconds = 0.0;
+
+	/** Latest search handed to FindSessions for this query, its results are updated in place by background refreshes */
+	TWeakPtr<FOnlineSessionSearch> LatestSearch;
+
+	/** Searches that are waiting on the refresh in flight to complete */
+	TArray<TSharedRef<FOnlineSessionSearch>> WaitingSearches;
+};
+
 /**
  * Delegate fired when deregistering a server from Armada finishes
  */
@@ -128,9 +214,21 @@ typedef FOnMatchmakingStarted::FDelegate FOnMatchmakingStartedDelegate;
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDedicatedServerNotification, FString /*Ip*/, int32 /*Port*/)
 typedef FOnDedicatedServerNotification::FDelegate FOnDedicatedServerNotificationDelegate;
 
+/**
+ * Delegate used to adjust the score of a pending match before the best one is picked. The returned value is added to the
+ * built in score, which is made up of server latency, ally overlap and notification age. Lower scores are preferred.
+ */
+DECLARE_DELEGATE_RetVal_OneParam(double, FOnScorePendingMatch, const FAccelBytePendingMatchInfo& /*PendingMatch*/)
+
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnMatchmakingFailed, const FErrorInfo& /*Error*/);
 typedef FOnMatchmakingFailed::FDelegate FOnMatchmakingFailedDelegate;
 
+/**
+ * Delegate fired when a background refresh of a cached session search changes the results of a completed search
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSessionSearchResultsChanged, const TSharedRef<FOnlineSessionSearch>& /*Search*/, const FAccelByteSessionSearchDiff& /*Diff*/);
+typedef FOnSessionSearchResultsChanged::FDelegate FOnSessionSearchResultsChangedDelegate;
+
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineSessionAccelByte : public IOnlineSession, public TSharedFromThis<FOnlineSessionAccelByte, ESPMode::ThreadSafe>
 {
 
@@ -141,6 +239,15 @@ private:
 	
 	/** Current search start time. */
 	double LANPingStartSeconds = 0.0;
+
+	/**
+	 * Settings last parsed from each LAN host keyed by session ID, along with the hash the host sent for them. Responses
+	 * that carry the same hash reuse these settings instead of parsing them again.
+	 */
+	TMap<FString, TPair<uint32, FOnlineSessionSettings>> LANHostSettingsCache;
+
+	/** Session IDs of the LAN hosts that answered the current search, anything else is pruned from the cache when it ends */
+	TSet<FString> LANHostsAnsweredSearch;
 	FAccelByteModelsSessionBrowserData SessionBrowserData;
 
 	/** Handles advertising sessions over LAN and client searches */
@@ -176,10 +283,8 @@ private:
 	 */
 	TArray<FAccelBytePendingMatchInfo> PendingMatchesToFilter;
 
-	/**
-	 * #SG Amount of time in seconds that we wish to increase the pending match wait time by between receiving sessions
-	 */
-	const double PendingMatchWaitTimeIncreaseSeconds = 1.0;
+	/** Optional game supplied adjustment to the score of each pending match */
+	FOnScorePendingMatch PendingMatchScoringDelegate;
 
 	/**
 	 * #SG Amount of time in seconds that we wish to wait between pending matches before filtering and creating a session
@@ -204,6 +309,16 @@ private:
 	 */
 	FString MatchmakingTicketId;
 
+	/**
+	 * Map of session name to the state that we have advertised to the session browser for hosted P2P sessions
+	 */
+	TMap<FName, FAccelByteSessionUpdateState> SessionNameToUpdateStateMap;
+
+	/**
+	 * Map of normalized query settings to the cached results of that session browser query
+	 */
+	TMap<FString, FAccelByteSessionSearchCacheEntry> SessionSearchCache;
+
 	/** Hidden on purpose */
 	FOnlineSessionAccelByte() :
 		AccelByteSubsystem(nullptr),
@@ -258,6 +373,51 @@ private:
 	void CreateP2PSession(FNamedOnlineSession* Session);
 	void OnRTCConnected(const FString& NetId, bool bWasSuccessful, FName SessionName);
 	void OnSessionCreateSuccess(const FAccelByteModelsSessionBrowserData& Data, FName SessionName);
+
+	/**
+	 * Add a match to the candidates that will be scored once the pending match wait window closes. Extends the window
+	 * for every new candidate received, up to PendingMatchMaxWaitTimeSeconds. A later server notification for a match
+	 * that is already a candidate only updates its server information.
+	 */
+	void AddPendingMatchCandidate(const FAccelBytePendingMatchInfo& PendingMatch);
+
+	/**
+	 * Score every valid pending match, construct a session result for the best one and clear the candidates
+	 */
+	void SelectBestPendingMatch();
+
+	/**
+	 * Send any pending session updates whose coalescing interval has elapsed
+	 */
+	void ProcessPendingSessionUpdates();
+
+	/**
+	 * Build the settings that have been added or changed between the advertised and current settings of a session.
+	 * Settings that have been removed are sent as null. Returns nullptr if no settings have changed.
+	 */
+	static TSharedPtr<FJsonObject> DiffSessionSettings(const FOnlineSessionSettings& AdvertisedSettings, const FOnlineSessionSettings& CurrentSettings);
+
+	/**
+	 * Build the key that a search is cached under. Each searching user gets their own entries, as the session browser
+	 * may answer differently depending on who asks. Query settings are sorted by name, so that the same query built in a
+	 * different order shares an entry.
+	 */
+	static FString GetSessionSearchCacheKey(const FUniqueNetId& SearchingPlayerId, const FOnlineSessionSearch& SearchSettings);
+
+	/**
+	 * Find the sessions that were added, removed or changed between two sets of search results
+	 */
+	static void DiffSessionSearchResults(const TArray<FOnlineSessionSearchResult>& OldResults, const TArray<FOnlineSessionSearchResult>& NewResults, FAccelByteSessionSearchDiff& OutDiff);
+
+	/**
+	 * Send a request to the session browser for the query of a cached search
+	 */
+	void StartSessionSearchRefresh(const FString& SearchKey, FAccelByteSessionSearchCacheEntry& Entry);
+
+	/**
+	 * Refresh cached searches whose results are older than the TTL and drop those that have not been asked for recently
+	 */
+	void ProcessSessionSearchCache();
 	
 PACKAGE_SCOPE:
 
@@ -310,21 +470,43 @@ PACKAGE_SCOPE:
 
 	bool NeedsAdvertising();
 	bool NeedsAdvertising( const FNamedOnlineSession& Session );
+
+	/** Whether any named session is hosted by one of our local users */
+	bool IsHostingSession();
+
 	bool IsSessionJoinable( const FNamedOnlineSession& Session) const;
 	uint32 UpdateLANStatus();
 	uint32 JoinLANSession(int32 PlayerNum, class FNamedOnlineSession* Session, const class FOnlineSession* SearchSession);
 	uint32 FindLANSession();
 	uint32 FinalizeLANSearch();	
-	void AppendSessionToPacket(class FNboSerializeToBufferAccelByte& Packet, class FOnlineSession* Session);
+	bool AppendSessionToPacket(class FNboSerializeToBufferAccelByte& Packet, class FOnlineSession* Session);
 	void AppendSessionSettingsToPacket(class FNboSerializeToBufferAccelByte& Packet, FOnlineSessionSettings* SessionSettings);	
-	void ReadSessionFromPacket(class FNboSerializeFromBufferAccelByte& Packet, class FOnlineSession* Session);
-	void ReadSettingsFromPacket(class FNboSerializeFromBufferAccelByte& Packet, FOnlineSessionSettings& SessionSettings);
+	bool ReadSessionFromPacket(class FNboSerializeFromBufferAccelByte& Packet, class FOnlineSession* Session);
+	bool ReadSettingsFromPacket(class FNboSerializeFromBufferAccelByte& Packet, FOnlineSessionSettings& SessionSettings);
 	void OnValidQueryPacketReceived(uint8* PacketData, int32 PacketLength, uint64 ClientNonce);
 	void OnValidResponsePacketReceived(uint8* PacketData, int32 PacketLength);
 	void OnLANSearchTimeout();
 	bool IsHost(const FNamedOnlineSession& Session) const;
 	static void SetPortFromNetDriver(const FOnlineSubsystemAccelByte& Subsystem, const TSharedPtr<FOnlineSessionInfo>& SessionInfo);
 
+	/**
+	 * Called by the update session task once a request to the session browser returns. On success the settings that were
+	 * sent become the new base for diffing subsequent updates.
+	 */
+	void OnSessionUpdateRequestComplete(FName SessionName, bool bWasSuccessful, const FOnlineSessionSettings& AdvertisedSettings, int32 AdvertisedPlayerCount);
+
+	/**
+	 * Called by the register and unregister players tasks once they have changed the registered players of a session, so
+	 * that the new player count is sent to the session browser with the next coalesced update.
+	 */
+	void OnSessionPlayersChanged(FName SessionName);
+
+	/**
+	 * Called by the find sessions task once a refresh of a cached search returns. Updates the cached results, completes
+	 * any searches waiting on them and notifies the game of sessions that changed in a search it already has.
+	 */
+	void OnSessionSearchRefreshComplete(const FString& SearchKey, bool bWasSuccessful, const TArray<FOnlineSessionSearchResult>& Results);
+
 public:
 
 	/**
@@ -391,6 +573,12 @@ public:
 	void CancelMatchmakingNotification();
 
 	DEFINE_ONLINE_DELEGATE_ONE_PARAM(OnMatchmakingFailed, const FErrorInfo& /* Error */);
+
+	/**
+	 * Delegate fired when a background refresh finds sessions that appeared, disappeared or changed for a search that
+	 * has already completed. The search's results have been updated in place by the time this fires.
+	 */
+	DEFINE_ONLINE_DELEGATE_TWO_PARAM(OnSessionSearchResultsChanged, const TSharedRef<FOnlineSessionSearch>&, const FAccelByteSessionSearchDiff&);
 	
 	/**
 	 * Method to deregister a local or remote server from Armada by its session.
@@ -451,10 +639,16 @@ public:
 	void ClearMatchmakingTicketId();
 
 	/**
-	 * Continue create pending match data
+	 * Continue create pending match data, adding the match as a candidate for the pending match selection
 	 */
 	void ContinueCreatePendingMatchFromDSNotif(const FString& MatchId);
 
+	/**
+	 * Set a delegate used to adjust the score of each pending match when picking which server to join. Unbind the
+	 * delegate to go back to the built in scoring only.
+	 */
+	void SetPendingMatchScoringDelegate(const FOnScorePendingMatch& Delegate);
+
 	virtual void SendBanUser(FName SessionName, const FUniqueNetId& PlayerId, int32 InActionID, const FString& InMessage);
 
 	void TriggerOnDedicatedServerNotificationReceived(const FAccelByteModelsDsNotice& Notification);
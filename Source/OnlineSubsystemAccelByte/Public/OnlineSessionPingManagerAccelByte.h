@@ -0,0 +1,202 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemTypes.h"
+#include "OnlineDelegateMacros.h"
+#include "OnlineSessionSettings.h"
+#include "OnlineSubsystemAccelByte.h"
+
+class FSocket;
+class FInternetAddr;
+
+/**
+ * Delegate fired when a ping to a single host completes, with MAX_QUERY_PING if the host did not reply in time
+ */
+DECLARE_DELEGATE_OneParam(FOnHostPingComplete, int32 /*PingInMs*/);
+
+/**
+ * Delegate fired each time a ping for a session search result completes
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSearchResultPingUpdated, const FString& /*SessionId*/, int32 /*PingInMs*/);
+typedef FOnSearchResultPingUpdated::FDelegate FOnSearchResultPingUpdatedDelegate;
+
+/**
+ * Internal structure for a host that has been asked to be pinged and has not replied yet
+ */
+struct FAccelByteHostPingRequest
+{
+	/** Address that the ping is sent to */
+	TSharedPtr<FInternetAddr> HostAddr;
+
+	/** Delegates of every caller that asked for this host while the ping was queued or in flight */
+	TArray<FOnHostPingComplete> CompleteDelegates;
+};
+
+/**
+ * Internal structure for a ping that has been sent and is waiting on a reply
+ */
+struct FAccelByteInFlightPing
+{
+	/** Socket from the pool that the ping was sent from, and that the reply will arrive on */
+	FSocket* Socket = nullptr;
+
+	/** Protocol of the socket, so that it goes back to the right pool once the ping completes */
+	FName ProtocolType;
+
+	/** Key of the host in the pending hosts map */
+	FString HostKey;
+
+	/** Value echoed back by the host, used to ignore stale replies to an earlier ping from the same socket */
+	uint64 Nonce = 0;
+
+	/** Time in seconds that the ping was sent */
+	double SentTimeSeconds = 0.0;
+};
+
+/**
+ * Measures the round trip time to the hosts of session search results, so that server lists can be sorted by latency.
+ *
+ * Pings are small UDP packets sent to SessionPingPort on the host, where the ping responder of the host's own subsystem
+ * echoes them back unchanged. Dedicated servers and session hosts run the responder whenever SessionPingPort is set.
+ * Every host of a search is pinged in parallel from a bounded pool of non-blocking sockets that is polled each tick, so
+ * the measured time includes up to a frame of polling delay. Measured pings are cached per host, so searching again does
+ * not ping the same servers again, while hosts that did not answer are tried again on the next search.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineSessionPingManagerAccelByte : public TSharedFromThis<FOnlineSessionPingManagerAccelByte, ESPMode::ThreadSafe>
+{
+PACKAGE_SCOPE:
+
+	/** Constructor that is invoked by the Subsystem instance to create a ping manager instance */
+	FOnlineSessionPingManagerAccelByte(FOnlineSubsystemAccelByte* InSubsystem);
+
+	/** Map of host key to hosts that are queued or in flight */
+	TMap<FString, FAccelByteHostPingRequest> PendingHosts;
+
+	/** Keys of hosts in PendingHosts that are waiting on a free socket, in the order they were asked for */
+	TArray<FString> QueuedHostKeys;
+
+	/** Pings that have been sent and are waiting on a reply */
+	TArray<FAccelByteInFlightPing> InFlightPings;
+
+	/** Sockets that have been created and are not being used by a ping, by the protocol they were created for */
+	TMap<FName, TArray<FSocket*>> IdleSockets;
+
+	/** Number of sockets created, both idle and in flight, which is capped at SessionPingMaxConcurrentPings */
+	int32 NumSocketsCreated = 0;
+
+	/** Value sent with the next ping */
+	uint64 NextPingNonce = 1;
+
+	/** Map of host key to the last measured round trip time in milliseconds and the time in seconds it was measured */
+	TMap<FString, TPair<int32, double>> HostPingCache;
+
+	/** Critical section for HostPingCache, as find sessions tasks read it from the task thread */
+	mutable FCriticalSection HostPingCacheLock;
+
+	/** Sockets that the ping responder echoes pings back from, one per protocol that could be bound */
+	TArray<FSocket*> ResponderSockets;
+
+	/** Port the ping responder is listening on, zero if it is not running */
+	int32 ResponderPort = 0;
+
+	/** Whether the ping responder was started by the tick for hosting, rather than explicitly with StartPingResponder */
+	bool bIsResponderAutoStarted = false;
+
+	/** Get the address to ping for a search result, or nullptr if the result has no reachable host */
+	TSharedPtr<FInternetAddr> GetSearchResultPingAddr(const FOnlineSessionSearchResult& SearchResult) const;
+
+	/** Get a socket for a protocol from the pool, creating one if the pool is not full yet, or nullptr if none is free */
+	FSocket* AcquireSocket(const FName& ProtocolType);
+
+	/** Get the last measured ping to a host if it is recent enough to be trusted, or INDEX_NONE if there is none */
+	int32 FindCachedPing(const FString& HostKey) const;
+
+	/** Start or stop the ping responder depending on whether this process is hosting and SessionPingPort is set */
+	void UpdatePingResponder();
+
+	/** Echo back every ping that has arrived at the responder since the last tick */
+	void EchoPings();
+
+	/** Send a ping to the next queued host, returning false if there is no socket free to send it from */
+	bool SendNextQueuedPing();
+
+	/**
+	 * Fire the delegates of everyone waiting on a host. Only pings that were answered are cached, a host that timed out
+	 * is reported as MAX_QUERY_PING and pinged again the next time it is asked for.
+	 */
+	void CompleteHostPing(const FString& HostKey, int32 PingInMs, bool bWasAnswered);
+
+public:
+	virtual ~FOnlineSessionPingManagerAccelByte();
+
+	/**
+	 * Delegate fired each time the ping of a search result completes, PingInMs on the result has already been updated for
+	 * searches pinged with PingSearchResults
+	 */
+	DEFINE_ONLINE_DELEGATE_TWO_PARAM(OnSearchResultPingUpdated, const FString&, int32);
+
+	/**
+	 * Ping the host of every result in a search in parallel. PingInMs of each result is filled in as its reply arrives,
+	 * straight away for hosts with a recent cached ping.
+	 *
+	 * @return true if at least one result had a host to ping
+	 */
+	bool PingSearchResults(const TSharedRef<FOnlineSessionSearch>& Search);
+
+	/**
+	 * Ping the host of a single search result, firing OnSearchResultPingUpdated with its session ID once it completes
+	 *
+	 * @return true if the result had a host to ping
+	 */
+	bool PingSearchResult(const FOnlineSessionSearchResult& SearchResult);
+
+	/**
+	 * Ping any host that echoes UDP packets back. Callers asking for the same host while a ping is pending share it, and
+	 * a recent cached ping completes the delegate immediately.
+	 */
+	void PingHost(const TSharedRef<FInternetAddr>& HostAddr, const FOnHostPingComplete& Delegate);
+
+	/**
+	 * Get the last ping measured to a host, if it is recent enough to be trusted
+	 *
+	 * @return true if there is a cached ping for the host
+	 */
+	bool GetCachedHostPing(const FInternetAddr& HostAddr, int32& OutPingInMs) const;
+
+	/**
+	 * Start echoing pings sent to a port on every protocol that can be bound, in place of the responder that is started
+	 * automatically while hosting. Used to answer pings on a port other than SessionPingPort.
+	 *
+	 * @return true if the responder is listening on at least one protocol
+	 */
+	bool StartPingResponder(int32 Port);
+
+	/** Stop echoing pings, until the responder is started again explicitly or by hosting */
+	void StopPingResponder();
+
+	/** Port the ping responder is listening on, zero if it is not running */
+	int32 GetPingResponderPort() const { return ResponderPort; }
+
+	/**
+	 * Get the last ping measured to the host of a search result, if it is recent enough to be trusted
+	 *
+	 * @return true if there is a cached ping for the host
+	 */
+	bool GetCachedPing(const FOnlineSessionSearchResult& SearchResult, int32& OutPingInMs) const;
+
+	/** Called by the subsystem every tick to answer pings, read replies, time out pings and send queued pings */
+	void Tick(float DeltaTime);
+
+protected:
+	/** Hidden default constructor, the constructor that takes in a subsystem instance should be used instead. */
+	FOnlineSessionPingManagerAccelByte()
+		: AccelByteSubsystem(nullptr)
+	{}
+
+	/** Instance of the subsystem that created this manager */
+	FOnlineSubsystemAccelByte* AccelByteSubsystem = nullptr;
+
+};
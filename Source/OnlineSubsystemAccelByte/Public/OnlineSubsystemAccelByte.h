@@ -11,6 +11,7 @@
 #include "OnlineEntitlementsInterfaceAccelByte.h"
 #include "OnlinePurchaseInterfaceAccelByte.h"
 #include "OnlineStoreInterfaceV2AccelByte.h"
+#include "OnlineSubsystemAccelByteSettings.h"
 #include "Core/AccelByteApiClient.h"
 #include "Models/AccelByteUserModels.h"
 
@@ -38,6 +39,11 @@ class FOnlineStoreV2AccelByte;
 class FOnlinePurchaseAccelByte;
 class FOnlineAgreementAccelByte;
 class FOnlineWalletAccelByte;
+class FOnlineBootstrapAccelByte;
+class FOnlineAsyncTaskMetricsAccelByte;
+class FOnlineQosManagerAccelByte;
+class FOnlineSessionPingManagerAccelByte;
+class FOnlineNotificationDispatcherAccelByte;
 class FExecTestBase;
 
 struct FAccelByteModelsNotificationMessage;
@@ -87,6 +93,21 @@ typedef TSharedPtr<FOnlineAgreementAccelByte, ESPMode::ThreadSafe> FOnlineAgreem
 /** Shared pointer to the AccelByte Wallet */
 typedef TSharedPtr<FOnlineWalletAccelByte, ESPMode::ThreadSafe> FOnlineWalletAccelBytePtr;
 
+/** Shared pointer to the AccelByte post login bootstrap */
+typedef TSharedPtr<FOnlineBootstrapAccelByte, ESPMode::ThreadSafe> FOnlineBootstrapAccelBytePtr;
+
+/** Shared pointer to the AccelByte async task metrics registry */
+typedef TSharedPtr<FOnlineAsyncTaskMetricsAccelByte, ESPMode::ThreadSafe> FOnlineAsyncTaskMetricsAccelBytePtr;
+
+/** Shared pointer to the AccelByte QoS latency manager */
+typedef TSharedPtr<FOnlineQosManagerAccelByte, ESPMode::ThreadSafe> FOnlineQosManagerAccelBytePtr;
+
+/** Shared pointer to the AccelByte session host ping manager */
+typedef TSharedPtr<FOnlineSessionPingManagerAccelByte, ESPMode::ThreadSafe> FOnlineSessionPingManagerAccelBytePtr;
+
+/** Shared pointer to the AccelByte Lobby notification dispatch queue */
+typedef TSharedPtr<FOnlineNotificationDispatcherAccelByte, ESPMode::ThreadSafe> FOnlineNotificationDispatcherAccelBytePtr;
+
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineSubsystemAccelByte final : public FOnlineSubsystemImpl
 {
 public:
@@ -111,6 +132,7 @@ public:
 	virtual IOnlineAchievementsPtr GetAchievementsInterface() const override;
 	virtual FOnlineAgreementAccelBytePtr GetAgreementInterface() const;
 	virtual FOnlineWalletAccelBytePtr GetWalletInterface() const;
+	virtual FOnlineBootstrapAccelBytePtr GetBootstrapInterface() const;
 	virtual bool Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar) override;
 	virtual bool IsEnabled() const override;
 	//~ End IOnlineSubsystem Interface
@@ -123,6 +145,38 @@ public:
 	 */
 	FOnlineUserCacheAccelBytePtr GetUserCache() const;
 
+	/**
+	 * Retrieves the registry that async tasks report their latency and outcome to
+	 */
+	FOnlineAsyncTaskMetricsAccelBytePtr GetAsyncTaskMetrics() const;
+
+	/**
+	 * Retrieves the manager that keeps the latency to each QoS region up to date
+	 */
+	FOnlineQosManagerAccelBytePtr GetQosManager() const;
+
+	/**
+	 * Retrieves the manager that measures the ping to the hosts of session search results
+	 */
+	FOnlineSessionPingManagerAccelBytePtr GetSessionPingManager() const;
+
+	/**
+	 * Retrieves the queue that every Lobby notification handler goes through before being run on the game thread
+	 */
+	FOnlineNotificationDispatcherAccelBytePtr GetNotificationDispatcher() const;
+
+	/**
+	 * Retrieves the typed settings parsed from the engine ini. Safe to call from any thread without locking, the
+	 * reference stays valid for the lifetime of the subsystem even if settings are reloaded.
+	 */
+	const FOnlineSubsystemAccelByteSettings& GetSettings() const;
+
+	/**
+	 * Re-read the engine ini from disk and parse a new copy of the settings, which readers will see from then on.
+	 * Systems that read settings as they use them pick up the new values straight away.
+	 */
+	void ReloadSettings();
+
 	//~ Begin FTickerObjectBase
 	virtual bool Tick(float DeltaTime) override;
 	//~ End FTickerObjectBase
@@ -282,12 +336,32 @@ PACKAGE_SCOPE:
 	FString GetSimplifiedNativePlatformName(const FString& PlatformName);
 
 	bool IsAutoConnectLobby() const;
+
+	bool IsAutoBootstrapAfterLogin() const;
 	
 	bool IsMultipleLocalUsersEnabled() const;
 
 private:
-	bool bIsAutoLobbyConnectAfterLoginSuccess = false;
-	bool bIsMultipleLocalUsersEnabled = false;
+	/**
+	 * Settings that readers currently see. Swapped atomically on reload so that hot paths never take a lock to read
+	 * settings, the previous copy is moved to RetiredSettings rather than freed as another thread may still be reading it.
+	 */
+	TAtomic<const FOnlineSubsystemAccelByteSettings*> CurrentSettings{ nullptr };
+
+	/** Owner of the settings that CurrentSettings points to */
+	TUniquePtr<FOnlineSubsystemAccelByteSettings> OwnedSettings;
+
+	/**
+	 * Copies replaced by a reload. Kept until the subsystem is destroyed, as GetSettings promises that its reference stays
+	 * valid for the lifetime of the subsystem. Reloads only come from the exec command, so only a few copies pile up.
+	 */
+	TArray<TUniquePtr<FOnlineSubsystemAccelByteSettings>> RetiredSettings;
+
+	/** Settings used if anything reads them before Init has parsed the ini */
+	FOnlineSubsystemAccelByteSettings DefaultSettings;
+
+	/** Lock for reloads, guarding OwnedSettings and RetiredSettings */
+	FCriticalSection SettingsReloadLock;
 	
 	/** Used to store the currently logged in account's LocalUserNum value */
 	int32 LocalUserNumCached;
@@ -322,6 +396,9 @@ private:
 	/** Async task manager used by interfaces in our OSS to handle async */
 	FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager;
 
+	/** Shared instance of the metrics registry for our async tasks */
+	FOnlineAsyncTaskMetricsAccelBytePtr AsyncTaskMetrics;
+
 	/** Shared instance of our agreement interface implementation */
 	FOnlineAgreementAccelBytePtr AgreementInterface;
 	
@@ -337,6 +414,18 @@ private:
 	/** Shared instance of our wallet interface implementation */
 	FOnlineWalletAccelBytePtr WalletInterface;
 
+	/** Shared instance of our post login bootstrap implementation */
+	FOnlineBootstrapAccelBytePtr BootstrapInterface;
+
+	/** Shared instance of our QoS latency manager */
+	FOnlineQosManagerAccelBytePtr QosManager;
+
+	/** Shared instance of our session host ping manager */
+	FOnlineSessionPingManagerAccelBytePtr SessionPingManager;
+
+	/** Shared instance of our Lobby notification dispatch queue */
+	FOnlineNotificationDispatcherAccelBytePtr NotificationDispatcher;
+
 	/** Thread spawned to run the FOnlineAsyncTaskManagerAccelBytePtr instance */
 	TUniquePtr<FRunnableThread> AsyncTaskManagerThread;
 
@@ -353,6 +442,11 @@ private:
 	 */
 	void OnLoginCallback(int LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error);
 
+	/**
+	 * Delegate handler fired when a local user logs out, drops any per user state that would otherwise outlive the login.
+	 */
+	void OnLogoutCallback(int LocalUserNum, bool bWasSuccessful);
+
 	void OnMessageNotif(const FAccelByteModelsNotificationMessage &InMessage, int32 LocalUserNum);
 };
 
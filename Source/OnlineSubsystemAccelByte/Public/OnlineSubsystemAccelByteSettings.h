@@ -0,0 +1,130 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Typed copy of every setting in the [OnlineSubsystemAccelByte] section of the engine ini.
+ *
+ * The subsystem parses one of these at Init and hands out a const reference to it, so interfaces never look up ini
+ * values by string while handling notifications or ticking. Settings can be reloaded at runtime with the
+ * `ABSETTINGS RELOAD` exec command, which parses a new instance and swaps it in for any later readers.
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FOnlineSubsystemAccelByteSettings
+{
+	/** Whether more than one local user may be logged in at a time */
+	bool bMultipleLocalUsersEnabled = false;
+
+	/** Whether to connect to the lobby websocket as soon as a user logs in */
+	bool bAutoLobbyConnectAfterLoginSuccess = false;
+
+	/** Whether to run the post login bootstrap as soon as a user logs in, takes priority over auto lobby connect */
+	bool bAutoBootstrapAfterLoginSuccess = false;
+
+	/** Whether to send ready consent for the first local user as soon as matchmaking finds a match */
+	bool bAutoSendReadyConsent = false;
+
+	/** Whether downloaded legal documents are persisted to disk and served on the next launch */
+	bool bEnablePolicyContentDiskCache = true;
+
+	/** Whether the last known party of each local user is persisted to disk, so it can be shown while the party is restored */
+	bool bEnablePartySnapshotDiskCache = false;
+
+	/** Time in seconds that a post login bootstrap stage may wait on its request before it is failed, zero to wait forever */
+	double BootstrapStageTimeoutSeconds = 60.0;
+
+	/** Time in seconds that a user stays in the user cache without being accessed before being purged */
+	double UserCachePurgeTimeoutSeconds = 600.0;
+
+	/** Time in milliseconds that queued user lookups wait for others to be merged with them into one bulk query */
+	double UserQueryBatchWindowMs = 50.0;
+
+	/** Time in seconds that a cached wallet balance is considered fresh */
+	double WalletCacheTTLSeconds = 60.0;
+
+	/** Maximum number of unread transactions buffered per wallet transaction stream */
+	int32 WalletTransactionStreamCapacity = 100;
+
+	/** Minimum time in seconds between two session browser updates for the same session */
+	double SessionUpdateIntervalSeconds = 1.0;
+
+	/** Time in seconds that cached session search results are handed out before being refreshed, zero disables the cache */
+	double SessionSearchCacheTTLSeconds = 0.0;
+
+	/** Time in seconds since a cached session search was last asked for before it stops refreshing and is dropped */
+	double SessionSearchCacheIdleTimeoutSeconds = 60.0;
+
+	/**
+	 * UDP port that session hosts answer pings on. Dedicated servers and session hosts echo pings on this port while it is
+	 * set, and clients send their pings to it. Zero disables session pings, as nothing answers them on the game port.
+	 */
+	int32 SessionPingPort = 0;
+
+	/** Maximum number of session host pings in flight at once, which is also the number of sockets used to send them */
+	int32 SessionPingMaxConcurrentPings = 16;
+
+	/** Time in seconds to wait for a session host to echo a ping before treating it as unreachable */
+	double SessionPingTimeoutSeconds = 2.0;
+
+	/** Time in seconds that a measured ping to a session host is reused before the host is pinged again */
+	double SessionPingCacheTTLSeconds = 30.0;
+
+	/** Time in seconds that party data changes are collected for before being sent as a single party storage write */
+	double PartyStorageWriteCoalesceWindowSeconds = 0.1;
+
+	/** Number of times a failed party storage write is sent again before its changes are dropped */
+	int32 PartyStorageWriteMaxRetries = 3;
+
+	/** Time in seconds that a received party invite is kept before it expires, zero to keep invites until acted on */
+	double PartyInviteTTLSeconds = 600.0;
+
+	/** Maximum number of party invites a local user holds at once, the oldest invite is dropped to make room for a new one */
+	int32 MaxPartyInvitesPerUser = 50;
+
+	/** Most Lobby notifications handled per frame, the rest wait in the notification queue for the next frame */
+	int32 LobbyNotificationsPerFrame = 16;
+
+	/** Time in milliseconds per frame after which no more Lobby notifications are handled until the next frame */
+	double LobbyNotificationFrameBudgetMs = 2.0;
+
+	/**
+	 * Time in seconds added to the pending match selection window for each dedicated server notification. Joining a
+	 * matchmade server always waits at least this long for other candidates, zero joins the first server straight away.
+	 */
+	double PendingMatchWaitTimeIncreaseSeconds = 1.0;
+
+	/** Maximum time in seconds to wait for more dedicated server notifications before joining the best match */
+	double PendingMatchMaxWaitTimeSeconds = 3.0;
+
+	/** Score added per millisecond of latency to the region of a pending match's server, lower scores are joined first */
+	double PendingMatchLatencyWeight = 1.0;
+
+	/** Score removed for a pending match that contains every member of our party, scaled by the fraction contained */
+	double PendingMatchAllyOverlapWeight = 100.0;
+
+	/** Score removed per second since the server notification for a pending match was received, so that older notifications are preferred */
+	double PendingMatchAgeWeight = 20.0;
+
+	/** Time in seconds between background rounds of QoS region pings */
+	double QosLatencyRefreshIntervalSeconds = 60.0;
+
+	/** Weight given to a new QoS ping in the region latency moving averages, between 0.01 and 1 */
+	double QosLatencySmoothingFactor = 0.3;
+
+	/**
+	 * Parse every setting from the engine ini, keeping the default for any key that is not present and clamping values
+	 * that would otherwise break the systems using them.
+	 */
+	void LoadFromConfig();
+
+	/**
+	 * Re-read only the [OnlineSubsystemAccelByte] section of the engine ini hierarchy from disk into GConfig, leaving
+	 * every other section of the engine ini as it is.
+	 */
+	static void ReloadConfigSection();
+
+	/** Write every setting and its current value to the output device */
+	void Dump(FOutputDevice& Ar) const;
+};
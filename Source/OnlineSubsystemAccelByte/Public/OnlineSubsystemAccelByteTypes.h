@@ -19,6 +19,9 @@ class FOnlineSubsystemAccelByte;
 // Value to represent an invalid NetID, mostly to ease debugging
 #define ACCELBYTE_INVALID_ID_VALUE TEXT("INVALID")
 
+// Version of the binary net ID encoding, written as the first byte so that readers can reject encodings they do not know
+#define ACCELBYTE_BINARY_ID_VERSION 1
+
 /**
  * Does a simple check to see if the actual AccelByte ID for the composite is valid.
  */
@@ -117,6 +120,20 @@ public:
 	virtual FName GetType() const override;
 
 	virtual bool IsValid() const override;
+
+	/**
+	 * @brief Append the compact binary encoding of this ID, used instead of the ID string wherever IDs are sent over the
+	 * network. IDs that are UUIDs are written as 16 raw bytes rather than as hex text.
+	 */
+	virtual void AppendBinary(TArray<uint8>& OutBytes) const;
+
+	/**
+	 * @brief Replace the value of this ID with one read from the binary encoding written by AppendBinary.
+	 *
+	 * @param OutBytesRead Number of bytes of the input that the encoded ID took up
+	 * @return false if the input is truncated, malformed or from an unknown encoding version
+	 */
+	virtual bool ReadBinary(const uint8* Bytes, int32 Size, int32& OutBytesRead);
 	
 protected:
 	FUniqueNetIdAccelByteResource(FString&& InUniqueNetId, const FName InType)
@@ -184,6 +201,24 @@ public:
 	 */
 	static TSharedPtr<const FUniqueNetIdAccelByteUser> Create(const FUniqueNetId& Src);
 
+	/**
+	 * @brief Create an ID from the binary encoding written by AppendBinary. IDs that have been read before are handed
+	 * back as the same shared instance, so an ID that keeps arriving over the network is only built once.
+	 *
+	 * @param Bytes Start of the binary encoding
+	 * @param Size Number of bytes available to read from
+	 * @param OutBytesRead Number of bytes that the encoded ID took up
+	 *
+	 * @return Shared pointer of UniqueNetId, or nullptr if the bytes are not a valid encoding
+	 */
+	static TSharedPtr<const FUniqueNetIdAccelByteUser> CreateFromBinary(const uint8* Bytes, int32 Size, int32& OutBytesRead);
+
+	/**
+	 * @brief Create an ID from the Base64 encoded composite string returned by ToString. Valid IDs that have been created
+	 * from the same string before are handed back as the same shared instance, skipping the Base64 and JSON decode.
+	 */
+	static TSharedPtr<const FUniqueNetIdAccelByteUser> CreateFromEncodedString(const FString& EncodedComposite);
+
 	/**
 	 * @brief Takes a const FUniqueNetId reference and converts it to a TSharedRef<FUniqueNetIdAccelByte> if the type matches.
 	 *
@@ -212,9 +247,10 @@ public:
 	virtual FString ToDebugString() const override;
 
 	/**
-	 * @brief Get the string representation of the AccelByte user ID from the composite ID
+	 * @brief Get the string representation of the AccelByte user ID from the composite ID. Returned by reference so that
+	 * ID comparisons and lookups keyed by the AccelByte ID do not copy the string.
 	 */
-	FString GetAccelByteId() const;
+	const FString& GetAccelByteId() const;
 
 	/**
 	 * @brief Get the string representation of the type of platform for platform ID from the composite ID
@@ -246,6 +282,30 @@ public:
 	 */
 	virtual bool Compare(const FUniqueNetId& Other) const override;
 
+	/**
+	 * @brief Append the compact binary encoding of this ID. The composite is written directly, with the AccelByte ID as
+	 * 16 raw UUID bytes and the platform type and ID only if present, rather than as the Base64 JSON string.
+	 */
+	virtual void AppendBinary(TArray<uint8>& OutBytes) const override;
+
+	/**
+	 * @brief Replace the value of this ID with one read from the binary encoding written by AppendBinary. The composite is
+	 * read directly, so unlike constructing from a string there is no Base64 or JSON decoding of the input.
+	 */
+	virtual bool ReadBinary(const uint8* Bytes, int32 Size, int32& OutBytesRead) override;
+
+	/**
+	 * @brief Returns the Base64 encoded composite string of this ID, building it first if this ID was read from its
+	 * binary encoding and the string has not been needed until now.
+	 */
+	virtual FString ToString() const override;
+
+	virtual const uint8* GetBytes() const override;
+
+	virtual int32 GetSize() const override;
+
+	virtual uint32 GetTypeHash() const override;
+
 PACKAGE_SCOPE:
 
 	/**
@@ -270,11 +330,26 @@ private:
 	 */
 	bool bCachedValidState = false;
 
+	/**
+	 * @brief Whether UniqueNetIdStr has yet to be built from the composite, set for IDs read from their binary encoding
+	 */
+	mutable FThreadSafeBool bIsEncodedStringPending = false;
+
+	/**
+	 * @brief Get the Base64 encoded composite string, encoding it from the composite on first use
+	 */
+	const FString& GetEncodedString() const;
+
 	/**
 	 * @brief Method that will decode a given string from Base64 into the correct ID format, as well as fill out necessary fields.
 	 */
 	void DecodeIDElements();
 
+	/**
+	 * @brief Encode a composite into the Base64 JSON string that is used as the underlying string of the ID.
+	 */
+	static bool EncodeCompositeId(const FAccelByteUniqueIdComposite& CompositeId, FString& OutEncodedComposite);
+
 protected:
 	FUniqueNetIdAccelByteUser(FString&& InUniqueNetId, const FName InType)
 		: FUniqueNetIdAccelByteResource(MoveTemp(InUniqueNetId), InType)
@@ -305,6 +380,65 @@ struct ONLINESUBSYSTEMACCELBYTE_API TUserUniqueIdConstSharedRefMapKeyFuncs : pub
 	}
 };
 
+/**
+ * Replicated AccelByte user ID that is much cheaper to send than FUniqueNetIdRepl. FUniqueNetIdRepl writes the full Base64
+ * JSON string of the ID and the receiver decodes it all again, while this writes the binary encoding from
+ * FUniqueNetIdAccelByteUser::AppendBinary and reuses IDs that the receiver has already decoded.
+ *
+ * Use in place of FUniqueNetIdRepl for replicated properties that only ever hold AccelByte user IDs.
+ */
+USTRUCT()
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteUniqueNetIdRepl
+{
+	GENERATED_BODY()
+
+	FAccelByteUniqueNetIdRepl() = default;
+
+	explicit FAccelByteUniqueNetIdRepl(const TSharedPtr<const FUniqueNetIdAccelByteUser>& InUniqueNetId)
+		: UniqueNetId(InUniqueNetId)
+	{
+	}
+
+	/** Whether this holds an ID and that ID is valid */
+	bool IsValid() const
+	{
+		return UniqueNetId.IsValid() && UniqueNetId->IsValid();
+	}
+
+	const TSharedPtr<const FUniqueNetIdAccelByteUser>& GetUniqueNetId() const
+	{
+		return UniqueNetId;
+	}
+
+	void SetUniqueNetId(const TSharedPtr<const FUniqueNetIdAccelByteUser>& InUniqueNetId)
+	{
+		UniqueNetId = InUniqueNetId;
+	}
+
+	/** Write or read the ID as a packed length followed by its binary encoding, a length of zero meaning no ID */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FAccelByteUniqueNetIdRepl& Other) const;
+
+	bool operator!=(const FAccelByteUniqueNetIdRepl& Other) const
+	{
+		return !(*this == Other);
+	}
+
+private:
+	TSharedPtr<const FUniqueNetIdAccelByteUser> UniqueNetId;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAccelByteUniqueNetIdRepl> : public TStructOpsTypeTraitsBase2<FAccelByteUniqueNetIdRepl>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 /**
  * Array of user IDs corresponding to players in a party in this session
  */
@@ -8,6 +8,9 @@
 #include "UObject/CoreOnline.h"
 #endif
 #include <Delegates/IDelegateInstance.h>
+#include "OnlineKeyValuePair.h"
+#include "OnlineSessionSettings.h"
+#include "Dom/JsonObject.h"
 
 #include "OnlineSubsystemAccelByteTypes.h"
 
@@ -67,6 +70,28 @@ public:
 	static FString GetUserJoinTime(const FString &UserId);
 	static void AddUserDisconnectedTime(const FString &UserId, const FString Value);
 	static FString GetUserDisconnectedTime(const FString &UserId);
+
+	/**
+	 * Write a single session setting value straight to a JSON value, without going through FVariantData::ToJson and the
+	 * temporary object it creates. 64-bit integers are written as strings so that they keep their precision.
+	 */
+	static TSharedPtr<FJsonValue> VariantDataToJsonValue(const FVariantData& Data);
+
+	/**
+	 * Read a single JSON value from the session browser into a session setting value. Returns false for JSON types that
+	 * session settings cannot hold (arrays, objects and null).
+	 */
+	static bool JsonValueToVariantData(const TSharedPtr<FJsonValue>& JsonValue, FVariantData& OutData);
+
+	/**
+	 * Serialize every setting of a session into the JSON object that is advertised to the session browser
+	 */
+	static TSharedRef<FJsonObject> SessionSettingsToJsonObject(const FSessionSettings& Settings);
+
+	/**
+	 * Add every value of a session browser settings JSON object to a set of session settings
+	 */
+	static void JsonObjectToSessionSettings(const FJsonObject& JsonObject, FSessionSettings& OutSettings);
 	
 private:
 
@@ -93,7 +93,7 @@ DECLARE_DELEGATE_TwoParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray
  * users will stay in cache with the `UserCachePurgeTimeoutSeconds` variable in the `OnlineSubsystemAccelByte` settings
  * in `DefaultEngine.ini`. Users will also not be purged if they were marked as important when queried.
  */
-class ONLINESUBSYSTEMACCELBYTE_API FOnlineUserCacheAccelByte
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineUserCacheAccelByte : public TSharedFromThis<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe>
 {
 public:
 
@@ -153,6 +153,21 @@ public:
 	 */
 	bool QueryUsersByPlatformIds(const FUniqueNetId& UserId, const FString& PlatformType, const TArray<FString>& PlatformIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false);
 
+	/**
+	 * Queues the IDs listed in the array to be queried through a bulk query shared with other callers. Lookups queued
+	 * for the same local user within `UserQueryBatchWindowMs` of each other are merged into one query, and IDs that are
+	 * already being queried are waited on rather than queried again.
+	 *
+	 * If every user is already in the cache, the delegate is fired straight away with the cached users, before this
+	 * method returns. Otherwise it is fired on the game thread once every query that the users are part of completes.
+	 *
+	 * @param LocalUserNum Index of the user that is attempting to query for other users
+	 * @param AccelByteIds Array of strings that represent an ID for a single user
+	 * @param Delegate Delegate fired when the query is complete
+	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
+	 */
+	bool QueueQueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant = false);
+
 	/**
 	 * Attempt to get a user from the cache by an AccelByte unique ID. This ID comes from either an FAccelByteUserInfo::Id
 	 * field, or from the result of a query users call.
@@ -199,18 +214,96 @@ PACKAGE_SCOPE:
 	 */
 	void GetQueryAndCacheArrays(const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<TSharedRef<FAccelByteUserInfo>>& UsersInCache);
 
+	/**
+	 * Dispatches a bulk query for each local user whose queued lookups have waited out the batch window.
+	 *
+	 * Do not call this method directly, it will be called from the owning OnlineSubsystem's tick!
+	 */
+	void FlushQueuedQueries(double CurrentTimeSeconds);
+
 private:
 
 	/**
-	 * Mutex used to lock maps while we add to or retrieve from cache
+	 * A single caller of QueueQueryUsersByAccelByteIds waiting on one or more bulk queries
 	 */
-	FCriticalSection CacheLock;
+	struct FQueuedUserQuery
+	{
+		/** IDs of every user the caller asked for, including those already cached */
+		TArray<FString> AccelByteIds;
+
+		/** Delegate fired once every query this caller waits on has completed */
+		FOnQueryUsersComplete Delegate;
+
+		/** Whether the users should be marked as important once queried */
+		bool bIsImportant = false;
+
+		/** Number of bulk queries this caller is still waiting on */
+		int32 NumQueriesRemaining = 0;
+
+		/** Whether every query this caller waited on succeeded */
+		bool bWasSuccessful = true;
+
+		/** Whether this caller's own IDs have already been queried again after a merged query failed */
+		bool bHasRetried = false;
+	};
 
 	/**
-	 * Length of time in seconds that a user will stay in the cache without being accessed before being purged.
-	 * Defaults to 600 seconds, or 10 minutes.
+	 * A bulk query of users on behalf of every caller waiting on it, either still open to more IDs or in flight
 	 */
-	double UserCachePurgeTimeoutSeconds = 600.0;
+	struct FQueuedUserQueryBatch
+	{
+		/** Index of the local user the query is sent for */
+		int32 LocalUserNum = 0;
+
+		/** IDs of the users to query, each only in one batch at a time */
+		TArray<FString> AccelByteIds;
+
+		/** Callers waiting on this query */
+		TArray<TSharedRef<FQueuedUserQuery>> Queries;
+
+		/** Time that the first lookup was queued in this batch */
+		double QueuedTimeSeconds = 0.0;
+
+		/** Whether this batch is marked as important, if any caller asked for it when the batch was still open */
+		bool bIsImportant = false;
+	};
+
+	/**
+	 * Send the bulk query for a batch that is no longer open to more IDs
+	 */
+	void DispatchQueryBatch(const TSharedRef<FQueuedUserQueryBatch>& Batch);
+
+	/**
+	 * Delegate handler for when the bulk query for a batch completes, fires the delegate of every caller no longer waiting.
+	 * If a batch merged from several callers fails, each caller has its own IDs from that batch queried once more before
+	 * it is failed.
+	 */
+	void OnQueuedQueryBatchComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TSharedRef<FQueuedUserQueryBatch> Batch);
+
+	/**
+	 * Gather the cached users for a caller, marking them as important if asked for
+	 */
+	TArray<TSharedRef<FAccelByteUserInfo>> GetQueuedQueryUsers(const FQueuedUserQuery& Query);
+
+	/**
+	 * Mutex used to lock the batches of queued lookups
+	 */
+	FCriticalSection QueuedQueryLock;
+
+	/**
+	 * Batches for each local user that are still open to more IDs
+	 */
+	TMap<int32, TSharedRef<FQueuedUserQueryBatch>> OpenQueryBatches;
+
+	/**
+	 * Map of AccelByte IDs to the open or in flight batch that will query them
+	 */
+	TMap<FString, TSharedRef<FQueuedUserQueryBatch>> QueryBatchesByAccelByteId;
+
+	/**
+	 * Mutex used to lock maps while we add to or retrieve from cache
+	 */
+	FCriticalSection CacheLock;
 
 	/**
 	 * User cache that maps AccelByte IDs to shared user instances
@@ -16,9 +16,150 @@ typedef FOnGetCurrencyListCompleted::FDelegate FOnGetCurrencyListCompletedDelega
 DECLARE_MULTICAST_DELEGATE_FourParams(FOnGetWalletInfoCompleted, int32 /*LocalUserNum*/, bool /*bWasSuccessful*/, const FAccelByteModelsWalletInfo& /*Response*/, const FString& /*Error*/);
 typedef FOnGetWalletInfoCompleted::FDelegate FOnGetWalletInfoCompletedDelegate;
 
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnGetWalletInfosCompleted, int32 /*LocalUserNum*/, bool /*bWasSuccessful*/, const TArray<FAccelByteModelsWalletInfo>& /*Response*/, const FString& /*Error*/);
+typedef FOnGetWalletInfosCompleted::FDelegate FOnGetWalletInfosCompletedDelegate;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnWalletInfoInvalidated, int32 /*LocalUserNum*/, const FString& /*CurrencyCode*/);
+typedef FOnWalletInfoInvalidated::FDelegate FOnWalletInfoInvalidatedDelegate;
+
 DECLARE_MULTICAST_DELEGATE_FourParams(FOnGetWalletTransactionsCompleted, int32 /*LocalUserNum*/, bool /*bWasSuccessful*/, const TArray<FAccelByteModelsWalletTransactionInfo>& /*Response*/, const FString& /*Error*/);
 typedef FOnGetWalletTransactionsCompleted::FDelegate FOnGetWalletTransactionsCompletedDelegate;
 
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnWalletTransactionStreamPageReady, int32 /*LocalUserNum*/, bool /*bWasSuccessful*/, const FString& /*CurrencyCode*/, const FString& /*Error*/);
+typedef FOnWalletTransactionStreamPageReady::FDelegate FOnWalletTransactionStreamPageReadyDelegate;
+
+/**
+ * Cached wallet balance for a single currency, along with the freshness metadata needed to decide whether it has to
+ * be fetched from the backend again.
+ */
+struct FAccelByteWalletCacheEntry
+{
+	FAccelByteWalletCacheEntry(const TSharedRef<FAccelByteModelsWalletInfo>& InWalletInfo)
+		: WalletInfo(InWalletInfo)
+	{
+	}
+
+	/** Last wallet info received from the backend for this currency */
+	TSharedRef<FAccelByteModelsWalletInfo> WalletInfo;
+
+	/** Time in seconds that this entry was last written from a backend response */
+	double LastUpdatedSeconds = 0.0;
+
+	/** Incremented every time this entry is written or invalidated, lets readers detect that a balance has changed */
+	uint32 Version = 0;
+
+	/** Set when an event may have changed this balance on the backend, cleared on the next successful fetch */
+	bool bIsStale = false;
+};
+
+/**
+ * Transactions do not carry an ID of their own, so they are identified by the fields that together are unique for a
+ * single wallet operation. The full fields are compared, so two transactions whose hashes collide are still told apart.
+ */
+struct FAccelByteWalletTransactionKey
+{
+	FAccelByteWalletTransactionKey() = default;
+
+	explicit FAccelByteWalletTransactionKey(const FAccelByteModelsWalletTransactionInfo& Transaction)
+		: WalletId(Transaction.WalletId)
+		, CreatedAt(Transaction.CreatedAt)
+		, Amount(Transaction.Amount)
+		, Reason(Transaction.Reason)
+		, WalletAction(Transaction.WalletAction)
+	{
+	}
+
+	bool operator==(const FAccelByteWalletTransactionKey& Other) const
+	{
+		return Amount == Other.Amount
+			&& WalletAction == Other.WalletAction
+			&& CreatedAt == Other.CreatedAt
+			&& WalletId == Other.WalletId
+			&& Reason == Other.Reason;
+	}
+
+	friend uint32 GetTypeHash(const FAccelByteWalletTransactionKey& Key)
+	{
+		uint32 Hash = GetTypeHash(Key.WalletId);
+		Hash = HashCombine(Hash, GetTypeHash(Key.CreatedAt));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Amount));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Reason));
+		Hash = HashCombine(Hash, static_cast<uint32>(Key.WalletAction));
+		return Hash;
+	}
+
+	FString WalletId;
+	decltype(FAccelByteModelsWalletTransactionInfo::CreatedAt) CreatedAt{};
+	decltype(FAccelByteModelsWalletTransactionInfo::Amount) Amount{};
+	FString Reason;
+	decltype(FAccelByteModelsWalletTransactionInfo::WalletAction) WalletAction{};
+};
+
+/**
+ * Outcome of buffering a single transaction received for a transaction stream
+ */
+enum class EAccelByteWalletTransactionPushResult : uint8
+{
+	Added,
+	/** Already received as part of an earlier page, the entry is dropped */
+	Duplicate,
+	/** No room left in the ring buffer, the entry has to be requested again once the reader has caught up */
+	Full
+};
+
+/**
+ * Cursor over a user's transaction history for a single currency. Pages are streamed from the backend into a bounded
+ * ring buffer of unread entries, so that the next page can be prefetched while the current one is being displayed.
+ */
+struct FAccelByteWalletTransactionStream
+{
+	/** Clear all buffered entries and rewind the cursor to the start of the history */
+	void Reset(int32 InPageSize, int32 InCapacity);
+
+	/**
+	 * Append a transaction to the end of the ring buffer. Nothing is buffered if the buffer is full, or if the
+	 * transaction was already received as part of an earlier page.
+	 */
+	EAccelByteWalletTransactionPushResult Push(FAccelByteModelsWalletTransactionInfo&& Transaction);
+
+	/** Move up to MaxCount unread entries from the front of the ring buffer into OutTransactions */
+	int32 Pop(TArray<FAccelByteModelsWalletTransactionInfo>& OutTransactions, int32 MaxCount);
+
+	/** Whether there is room to buffer another page without dropping unread entries */
+	bool CanPrefetch() const
+	{
+		return bHasMorePages && !bIsRequestInFlight && (Count + PageSize) <= Entries.Num();
+	}
+
+	/** Number of transactions requested from the backend per page */
+	int32 PageSize = 20;
+
+	/** Offset of the next page to request from the backend */
+	int32 NextOffset = 0;
+
+	/** Bumped every time the stream is reset, responses for an older generation are dropped */
+	uint32 Generation = 0;
+
+	bool bHasMorePages = true;
+	bool bIsRequestInFlight = false;
+
+	/** Set when a read found nothing buffered, the page ready delegate will fire once the in flight page arrives */
+	bool bIsReaderWaiting = false;
+
+	/** Ring buffer storage for unread transactions, sized to the stream capacity on reset */
+	TArray<FAccelByteModelsWalletTransactionInfo> Entries;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	/**
+	 * Keys of the most recently received transactions. New transactions shift the offsets of older ones, which means
+	 * that a page may repeat entries from the end of the previous page, these are dropped rather than shown twice.
+	 */
+	TArray<FAccelByteWalletTransactionKey> RecentKeys;
+	TSet<FAccelByteWalletTransactionKey> RecentKeySet;
+	int32 RecentKeysHead = 0;
+};
+
 /**
  * Implementation of Wallet service from AccelByte services
  */
@@ -27,19 +168,41 @@ class ONLINESUBSYSTEMACCELBYTE_API FOnlineWalletAccelByte : public TSharedFromTh
 PACKAGE_SCOPE:
 
 	/** Constructor that is invoked by the Subsystem instance to create a user cloud instance */
-	FOnlineWalletAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
-		: AccelByteSubsystem(InSubsystem)
-	{};
+	FOnlineWalletAccelByte(FOnlineSubsystemAccelByte* InSubsystem);
 
 	TMap<FString, TSharedRef<FAccelByteModelsCurrencyList>> CurrencyCodeToCurrencyListMap;
 	/** Critical sections for thread safe operation of CurrencyCodeToCurrencyListMap */
 	mutable FCriticalSection CurrencyListLock;
 
 	/*Map of WalletInfo of each user*/
-	TUniqueNetIdMap <TMap<FString, TSharedRef<FAccelByteModelsWalletInfo>>> UserToWalletInfoMap;
+	TUniqueNetIdMap<TMap<FString, FAccelByteWalletCacheEntry>> UserToWalletInfoMap;
 	/** Critical sections for thread safe operation of UserToWalletInfoMap */
 	mutable FCriticalSection WalletInfoListLock;
 
+	/**
+	 * Reads the cached balance for this currency if it has not been invalidated and has not outlived the cache TTL,
+	 * meaning that it can be used without asking the backend. The check and the read happen under the same lock, so an
+	 * invalidation cannot slip in between them.
+	 */
+	bool GetFreshWalletInfoFromCache(int32 LocalUserNum, const FString& CurrencyCode, FAccelByteModelsWalletInfo& OutWalletInfo) const;
+
+	/**
+	 * Marks the cached balances for the given currencies as stale. Passing an empty array marks every cached currency for
+	 * the user as stale. Used when a purchase, redeem or fulfillment may have changed the user's balance.
+	 */
+	void InvalidateWalletInfo(const FUniqueNetId& UserId, const TArray<FString>& CurrencyCodes);
+
+	/** Open transaction history streams for each user, keyed by currency code */
+	TUniqueNetIdMap<TMap<FString, FAccelByteWalletTransactionStream>> UserToWalletTransactionStreamMap;
+	/** Critical sections for thread safe operation of UserToWalletTransactionStreamMap */
+	mutable FCriticalSection WalletTransactionStreamLock;
+
+	/** Dispatch a request for the next page of a stream, must be called while holding WalletTransactionStreamLock */
+	void RequestNextWalletTransactionPage(const FUniqueNetId& UserId, const FString& CurrencyCode, FAccelByteWalletTransactionStream& Stream);
+
+	/** Called by the get wallet transactions task when a page requested for a stream has been received */
+	void OnWalletTransactionStreamPageReceived(int32 LocalUserNum, const FUniqueNetId& UserId, const FString& CurrencyCode, uint32 Generation, bool bWasSuccessful, TArray<FAccelByteModelsWalletTransactionInfo>& Transactions, bool bHasNextPage, const FString& Error);
+
 public:
 	virtual ~FOnlineWalletAccelByte() {};
 
@@ -47,8 +210,22 @@ public:
 
 	DEFINE_ONLINE_PLAYER_DELEGATE_THREE_PARAM(MAX_LOCAL_PLAYERS, OnGetWalletInfoCompleted, bool /*bWasSuccessful*/, const FAccelByteModelsWalletInfo& /*Response*/, const FString& /*Error*/);
 
+	DEFINE_ONLINE_PLAYER_DELEGATE_THREE_PARAM(MAX_LOCAL_PLAYERS, OnGetWalletInfosCompleted, bool /*bWasSuccessful*/, const TArray<FAccelByteModelsWalletInfo>& /*Response*/, const FString& /*Error*/);
+
+	/**
+	 * Delegate fired when a cached balance has been marked stale because an event may have changed it on the backend.
+	 * Listeners should call GetWalletInfoByCurrencyCodes or RefreshStaleWalletInfo to fetch only what changed.
+	 */
+	DEFINE_ONLINE_PLAYER_DELEGATE_ONE_PARAM(MAX_LOCAL_PLAYERS, OnWalletInfoInvalidated, const FString& /*CurrencyCode*/);
+
 	DEFINE_ONLINE_PLAYER_DELEGATE_THREE_PARAM(MAX_LOCAL_PLAYERS, OnGetWalletTransactionsCompleted, bool /*bWasSuccessful*/, const TArray<FAccelByteModelsWalletTransactionInfo>& /*Response*/, const FString& /*Error*/);
 
+	/**
+	 * Delegate fired when a page of a transaction stream that a read was waiting on has been buffered. Listeners should
+	 * call ReadWalletTransactionStream to take the entries.
+	 */
+	DEFINE_ONLINE_PLAYER_DELEGATE_THREE_PARAM(MAX_LOCAL_PLAYERS, OnWalletTransactionStreamPageReady, bool /*bWasSuccessful*/, const FString& /*CurrencyCode*/, const FString& /*Error*/);
+
 	bool GetCurrencyList(int32 LocalUserNum, bool bAlwaysRequestToService = false);
 
 	bool GetCurrencyFromCache(const FString& CurrencyCode, FAccelByteModelsCurrencyList& OutCurrency);
@@ -59,12 +236,48 @@ public:
 	
 	bool GetWalletInfoByCurrencyCode(int32 LocalUserNum, const FString& CurrencyCode, bool bAlwaysRequestToService = false);
 
+	/**
+	 * Fetch wallet info for several currencies in a single task. Currencies with a fresh cached balance are served from
+	 * the cache unless bAlwaysRequestToService is set, the rest are requested from the backend concurrently.
+	 */
+	bool GetWalletInfoByCurrencyCodes(int32 LocalUserNum, const TArray<FString>& CurrencyCodes, bool bAlwaysRequestToService = false);
+
+	/**
+	 * Re-fetch every cached currency for the user that has been invalidated or has outlived the cache TTL. Returns false
+	 * if there was nothing to refresh.
+	 */
+	bool RefreshStaleWalletInfo(int32 LocalUserNum);
+
+	/**
+	 * Read the last known balance for a currency without touching the backend. The value may be stale, use
+	 * OutVersion to detect changes between reads and the OnWalletInfoInvalidated delegate to know when to refresh.
+	 */
 	bool GetWalletInfoFromCache(int32 LocalUserNum, const FString& CurrencyCode, FAccelByteModelsWalletInfo& OutWalletInfo);
+	bool GetWalletInfoFromCache(int32 LocalUserNum, const FString& CurrencyCode, FAccelByteModelsWalletInfo& OutWalletInfo, uint32& OutVersion);
 
 	void AddWalletInfoToList(int32 LocalUserNum, const FString& CurrencyCode, const TSharedRef<FAccelByteModelsWalletInfo>& InWalletInfo);
 
 	bool ListWalletTransactionsByCurrencyCode(int32 LocalUserNum, const FString& CurrencyCode, int32 Offset = 0, int32 Limit = 20);
 
+	/**
+	 * Open a cursor over the transaction history for a currency, discarding any stream already open for it. The first
+	 * page is requested right away and OnWalletTransactionStreamPageReady fires once it has been buffered.
+	 */
+	bool OpenWalletTransactionStream(int32 LocalUserNum, const FString& CurrencyCode, int32 PageSize = 20);
+
+	/**
+	 * Move up to one page of buffered transactions into OutTransactions and prefetch the next page in the background.
+	 * OutTransactions is reset but keeps its allocation, so the same array can be reused for every page. Returns false
+	 * if nothing is buffered yet, in which case OnWalletTransactionStreamPageReady fires when the next page arrives.
+	 */
+	bool ReadWalletTransactionStream(int32 LocalUserNum, const FString& CurrencyCode, TArray<FAccelByteModelsWalletTransactionInfo>& OutTransactions);
+
+	/** Whether the stream still has buffered entries or pages left on the backend */
+	bool HasMoreWalletTransactions(int32 LocalUserNum, const FString& CurrencyCode) const;
+
+	/** Release the buffers held by a transaction stream */
+	void CloseWalletTransactionStream(int32 LocalUserNum, const FString& CurrencyCode);
+
 protected:
 	/** Hidden default constructor, the constructor that takes in a subsystem instance should be used instead. */
 	FOnlineWalletAccelByte()